@@ -0,0 +1,30 @@
+/// \file       include/gslcpp/doc/d-fft.hpp
+/// \brief      Narrative documentation for fast Fourier transforms.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_fft About Fast Fourier Transforms
+///
+/// gsl::fft_forward(), gsl::fft_backward(), and gsl::fft_inverse() transform
+/// a gsl::v_iface of gsl::complex in place; gsl::fft_real(),
+/// gsl::fft_halfcomplex_backward(), and gsl::fft_halfcomplex_inverse()
+/// transform a real gsl::v_iface in place, to and from GSL's half-complex
+/// representation.  Each works on `double` or on `float`, for any length, via
+/// GSL's mixed-radix routines, and on a contiguous or a strided view.
+///
+/// - Each wavetable is computed once for each length and then shared by every
+///   thread (see gsl::fft_cache).  Each thread keeps its own workspace for
+///   each length.  So a repeated transform costs no allocation and no
+///   recomputation of trigonometric factors.
+///
+/// - Each `*_batch` function transforms consecutive segments of equal length
+///   in parallel over a gsl::thread_pool.
+///
+/// - gsl::halfcomplex_unpack() expands the half-complex representation into a
+///   complex vector.
+///
+/// \code
+/// gsl::vector<gsl::complex<double>> z(1024 * 64);
+/// gsl::fft_forward_batch(z, 1024); // 64 transforms, each of length 1024.
+/// \endcode
+
+// EOF
@@ -0,0 +1,34 @@
+/// \file       include/gslcpp/doc/d-filter.hpp
+/// \brief      Narrative documentation for digital filters.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_filter About Digital Filters
+///
+/// gsl::median_filter, gsl::gaussian_filter, gsl::impulse_filter, and
+/// gsl::rmedian_filter wrap GSL's `gsl_filter` for input and output of type
+/// gsl::v_iface, including a strided gsl::vector_view.  Each filter owns its
+/// workspaces, which are allocated on construction and reused by every call.
+///
+/// - The median, Gaussian, and impulse-detection filters split a long vector
+///   into blocks of fixed size, which are filtered in parallel over a
+///   gsl::thread_pool.  Each block reads `h` samples on each side of it, so
+///   that the result is identical to that of a single call to GSL and does
+///   not depend on the number of threads.
+///
+/// - The recursive median filter depends on its own earlier outputs, and so
+///   it is applied by a single call to GSL, directly on the (possibly
+///   strided) vectors.
+///
+/// - gsl::filter_stream applies the median or Gaussian filter to input that
+///   arrives chunk by chunk.  The output lags the input by `h` samples until
+///   the stream is finished, and the concatenated output matches that of the
+///   filter on the concatenated input.
+///
+/// \code
+/// gsl::median_filter f(5); // Window of five samples.
+/// gsl::filter_stream s(f);
+/// gsl::vector<double> y(chunk.size());
+/// size_t const k= s.push(chunk, y); // First `k` elements of `y` are ready.
+/// \endcode
+
+// EOF
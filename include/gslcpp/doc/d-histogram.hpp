@@ -0,0 +1,30 @@
+/// \file       include/gslcpp/doc/d-histogram.hpp
+/// \brief      Narrative documentation for histograms.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_histogram About Histograms
+///
+/// gsl::histogram and gsl::histogram2d own GSL's histograms, so that GSL's
+/// functions for statistics of a histogram may be applied to `h()`, but they
+/// bin values natively.
+///
+/// - gsl::bin_index finds the bin in constant time when the ranges are
+///   uniform, and otherwise by a binary search without branches.
+///
+/// - A whole gsl::v_iface (or, for gsl::histogram2d, a pair of them) is
+///   binned at once.  Above gsl::hist_grain values, chunks are spread over a
+///   gsl::thread_pool, and each worker fills its own private copy of the
+///   bins; the copies are added at the end.  Counts are exact and do not
+///   depend on the number of threads.
+///
+/// \code
+/// gsl::vector<double> x(10000000), y(10000000);
+/// // ... fill x and y ...
+/// gsl::histogram h(100, -5.0, 5.0);
+/// h.increment(x); // Parallel.
+/// gsl::histogram2d h2(50, -5.0, 5.0, 50, -5.0, 5.0);
+/// h2.increment(x, y);
+/// double const m= gsl_histogram_mean(h.h());
+/// \endcode
+
+// EOF
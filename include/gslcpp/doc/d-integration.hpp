@@ -0,0 +1,54 @@
+/// \file       include/gslcpp/doc/d-integration.hpp
+/// \brief      Narrative documentation for numerical integration.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_integration About Numerical Integration
+///
+/// Each of gsl::qng(), gsl::qag(), gsl::qags(), gsl::qagi(), gsl::qagiu(),
+/// gsl::qagil(), and gsl::cquad() wraps the corresponding function in GSL
+/// and returns a gsl::quad_result.
+///
+/// - The integrand is any callable with signature `double(double)`, such as a
+///   lambda.  It is a template-parameter, and GSL calls a static trampoline
+///   (gsl::integrand) that calls the integrand directly, so that the
+///   integrand can be inlined into the trampoline.
+///
+/// - No call allocates a workspace in the steady state.  Each adaptive
+///   routine leases its workspace from a thread-local gsl::workspace_pool.
+///   After the first call on a thread, subsequent calls on the same thread
+///   reuse the same workspace.  A nested integral simply leases a second
+///   workspace.
+///
+/// Here is an example:
+/// \code
+/// double const alpha= 1.0;
+/// auto const r= gsl::qags(
+///       [alpha](double x) { return std::log(alpha * x) / std::sqrt(x); },
+///       0.0, 1.0, 0.0, 1.0E-7);
+/// // r.value is -4, and r.abserr is the estimated absolute error.
+/// \endcode
+///
+/// \section d_integration_fixed Fixed-Order Rules over Many Parameters
+///
+/// gsl::fixed_quad computes the nodes and weights of one of GSL's fixed rules
+/// (Gauss-Legendre by default) once, on construction, and then integrates a
+/// family of integrands `f(x, p)` for every parameter `p` in a vector.
+///
+/// - Parameters are processed in blocks of 64.  Within a block, the loop over
+///   parameters is innermost and unit-stride, so that the compiler can
+///   vectorize an inlined integrand across parameters.
+///
+/// - Blocks are distributed over a gsl::thread_pool.  The integrand is called
+///   concurrently and so must be safe to call from several threads.
+///
+/// - If a vector for the error be supplied, then each estimate of error is
+///   the difference from a rule with half as many nodes.
+///
+/// \code
+/// gsl::fixed_quad const q(16, 0.0, 1.0);
+/// gsl::vector<double> p({1.0, 2.0, 3.0}), r(3), e(3);
+/// q([](double x, double a) { return std::exp(a * x); }, p, r, e);
+/// // r[i] is (exp(p[i]) - 1) / p[i].
+/// \endcode
+
+// EOF
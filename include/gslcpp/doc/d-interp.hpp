@@ -0,0 +1,32 @@
+/// \file       include/gslcpp/doc/d-interp.hpp
+/// \brief      Narrative documentation for interpolation.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_interp About Interpolation
+///
+/// gsl::interp combines GSL's `gsl_interp` with the data, as `gsl_spline`
+/// does, but it refers to contiguous data rather than copying them.
+///
+/// Given a vector of queries and a vector for output, eval(), deriv(), and
+/// deriv2() evaluate at every query.
+///
+/// - Chunks of gsl::interp_grain queries are spread over a gsl::thread_pool,
+///   and each chunk has its own accelerator.
+///
+/// - gsl::interp_locate() finds each query's interval by galloping forward
+///   from the previous query's, so that sorted queries cost a short sweep
+///   rather than a binary search each.  GSL's accelerator is set to the
+///   interval found, so that GSL does no search.
+///
+/// - Linear interpolation is evaluated natively.
+///
+/// A query out of range yields NaN and is counted in the returned value.
+///
+/// \code
+/// gsl::vector<double> x(1000), y(1000), q(10000000), v(10000000);
+/// // ... fill x, y, and q ...
+/// gsl::interp s(x, y, gsl_interp_steffen);
+/// size_t const bad= s.eval(q, v);
+/// \endcode
+
+// EOF
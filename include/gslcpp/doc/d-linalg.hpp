@@ -0,0 +1,48 @@
+/// \file       include/gslcpp/doc/d-linalg.hpp
+/// \brief      Narrative documentation for linear algebra.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_linalg About Linear Algebra
+///
+/// gsl::lu, gsl::cholesky, and gsl::qr own the factors, permutation, and
+/// workspace needed by GSL's decompositions.  Each is allocated once, for a
+/// given size, and reused by every call to `factor()`, which copies the
+/// matrix and leaves it unmodified.  Any GSL matrix may be passed, including
+/// a view of a C-style array via `gsl_matrix_const_view_array()`.
+///
+/// After `factor()`, right-hand sides are solved either one at a time, as any
+/// gsl::v_iface, or as the columns of a matrix.  The columns are distributed
+/// over a gsl::thread_pool.
+///
+/// GSL's decompositions are recursive, blocked algorithms built on level-3
+/// CBLAS, and so most of their time is spent in CBLAS.  The CMake cache
+/// variable `GSLCPP_CBLAS` selects the CBLAS linked with GSL, replacing
+/// GSL's reference CBLAS when set to another library; an optimized
+/// CBLAS is much faster than GSL's reference CBLAS for large matrices.
+///
+/// To factor many independent systems, give each worker its own
+/// decomposition.
+///
+/// \code
+/// gsl::thread_pool &p= gsl::thread_pool::global();
+/// std::vector<gsl::lu> d;
+/// for(unsigned w= 0; w < p.size(); ++w) d.emplace_back(500);
+/// p.for_each(systems.size(), [&](size_t k, unsigned w) {
+///   d[w].factor(systems[k].a);
+///   d[w].solve(systems[k].b, systems[k].x);
+/// });
+/// \endcode
+///
+/// For many tiny systems (say, 3x3 through 8x8), GSL's per-call overhead
+/// dominates.  gsl::small_systems instead stores a batch as a structure of
+/// arrays, and gsl::small_kernel solves gsl::small_lanes systems at once,
+/// with the size of each system known at compile-time and with the systems
+/// innermost in every loop, so that the compiler vectorizes across systems.
+///
+/// \code
+/// gsl::small_systems<4> s(100000);
+/// // ... fill s.a(k, i, j) and s.b(k, i) ...
+/// size_t const singular= s.lu_solve(); // Solutions replace s.b(k, i).
+/// \endcode
+
+// EOF
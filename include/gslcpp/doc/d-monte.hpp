@@ -0,0 +1,40 @@
+/// \file       include/gslcpp/doc/d-monte.hpp
+/// \brief      Narrative documentation for Monte Carlo integration.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_monte About Monte Carlo Integration
+///
+/// Each integrator takes the integrand as a template-parameter, with
+/// signature `double(gsl::point_view const &)`, and the limits of the
+/// hyperrectangular region as any pair of gsl::v_iface.  Every integrator
+/// calls the integrand from several threads at once.
+///
+/// - gsl::monte_plain samples natively, in chunks of gsl::monte_grain calls.
+///   Each chunk has its own generator, seeded by gsl::ran_seed(), and the
+///   moments of the chunks are merged in order.  The result does not depend
+///   on the number of threads.
+///
+/// - gsl::monte_miser and gsl::monte_vegas run independent replicas of GSL's
+///   adaptive algorithm, one per task on a gsl::thread_pool, and combine the
+///   replicas by inverse variance.  GSL's adaptive loop is serial, and so
+///   parallelism comes from replication.  The result depends on the seed and
+///   on the number of replicas, but not on the number of threads.
+///
+/// Every integrator keeps its states and generators between calls.  VEGAS
+/// refines the grid of the previous call only if its parameter `stage` be set
+/// to one, as in the example below; GSL's default starts a new grid.
+///
+/// \code
+/// auto f= [](gsl::point_view const &x) { return x[0] * x[1]; };
+/// gsl::vector<double> lo({0.0, 0.0}), hi({1.0, 1.0});
+/// gsl::monte_plain plain(2);
+/// auto a= plain.integrate(f, lo, hi, 1000000, 12345);
+/// gsl::monte_vegas vegas(2, 8, 12345);
+/// vegas.integrate(f, lo, hi, 80000); // Warm up grid.
+/// auto q= vegas.params();
+/// q.stage= 1; // Keep grid.
+/// vegas.set_params(q);
+/// auto b= vegas.integrate(f, lo, hi, 800000);
+/// \endcode
+
+// EOF
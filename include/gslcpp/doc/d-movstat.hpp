@@ -0,0 +1,34 @@
+/// \file       include/gslcpp/doc/d-movstat.hpp
+/// \brief      Narrative documentation for moving-window statistics.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_movstat About Moving-Window Statistics
+///
+/// gsl::movstat wraps GSL's `gsl_movstat` for input and output of type
+/// gsl::v_iface, including a strided gsl::vector_view.  The window for output
+/// `y[i]` is `x[i - h]` through `x[i + j]`, and the treatment of the ends is
+/// given by `gsl_movstat_end_t`, as in GSL.
+///
+/// - Every workspace is allocated on construction and reused by each call.
+///
+/// - The output is split into chunks of fixed size, which are computed in
+///   parallel over a gsl::thread_pool.  Each chunk reads `h` samples before it
+///   and `j` samples after it, so that the result does not depend on the
+///   number of threads.
+///
+/// - The mean, sum, minimum, maximum, and median are computed by native
+///   kernels with O(1) or O(log k) cost per step, where k is the size of the
+///   window: a running sum, a monotonic deque (gsl::window_extremum), and two
+///   indexed heaps (gsl::window_median).  These accept input of any real type.
+///
+/// - The variance, standard deviation, MAD, quantile range, S_n, and Q_n are
+///   computed by GSL on each chunk.  These require input of type `double`.
+///
+/// \code
+/// gsl::vector<double> x({1.0, 5.0, 2.0, 8.0, 3.0});
+/// gsl::vector<double> y(x.size());
+/// gsl::movstat m(3); // Window of three samples, centered.
+/// m.median(x, y); // {1.0, 2.0, 5.0, 3.0, 3.0}
+/// \endcode
+
+// EOF
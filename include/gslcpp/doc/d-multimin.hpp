@@ -0,0 +1,51 @@
+/// \file       include/gslcpp/doc/d-multimin.hpp
+/// \brief      Narrative documentation for multidimensional minimization.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_multimin About Multidimensional Minimization
+///
+/// Two classes wrap GSL's multidimensional minimizers:
+///
+/// - gsl::fdf_minimizer wraps `gsl_multimin_fdfminimizer` and uses the
+///   gradient of the objective.
+///
+/// - gsl::f_minimizer wraps `gsl_multimin_fminimizer` and uses only the
+///   value of the objective.
+///
+/// Each is designed for many small, successive solves:
+///
+/// - GSL's state is allocated once, on construction, and is reused by every
+///   call to `set()` or `minimize()`.  No solve allocates memory.
+///
+/// - The starting point may be any gsl::v_iface, including a
+///   gsl::vector_view of existing storage.  `minimize()` writes the location
+///   of the minimum back through the same view.
+///
+/// - The objective is a template-parameter.  GSL calls a static trampoline
+///   (gsl::multimin_f or gsl::multimin_fdf), which calls the objective
+///   directly, so that the objective can be inlined into the trampoline.
+///   There is no `std::function`.
+///
+/// - The objective receives gsl::point_view and gsl::gradient_view, each of
+///   which refers directly to GSL's storage, so that no element is copied.
+///
+/// For gsl::fdf_minimizer, the objective must have member-functions `f()`
+/// and `df()`, and it may have `fdf()`.  For gsl::f_minimizer, the objective
+/// is any callable, such as a lambda.
+///
+/// ## Batches of Independent Problems
+///
+/// gsl::batch_minimizer solves many independent problems of the same
+/// dimension by distributing them over a gsl::thread_pool.  One minimizer is
+/// preallocated per worker.  The result for each problem includes its status,
+/// its number of iterations, and the wall-clock time that it took.
+///
+/// ## Objectives without Analytic Gradient
+///
+/// gsl::fd_gradient wraps an objective that has only a value and estimates
+/// its gradient by forward or central differences.  The perturbed evaluations
+/// run concurrently on a gsl::thread_pool, each worker reusing its own
+/// scratch-vector.  An instance can be passed directly to
+/// gsl::fdf_minimizer.
+
+// EOF
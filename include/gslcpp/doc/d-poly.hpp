@@ -0,0 +1,44 @@
+/// \file       include/gslcpp/doc/d-poly.hpp
+/// \brief      Narrative documentation for polynomials over vectors.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_poly About Polynomials over Vectors
+///
+/// gsl::poly_eval() evaluates a polynomial, whose coefficients are in any
+/// gsl::v_iface in order of ascending power, at every point of another
+/// vector, writing the values into a third vector, or into the same one.
+/// Coefficients and points may each be real or complex; the values are
+/// complex if either be complex.  gsl::poly_eval_derivs() writes the value
+/// and the derivatives of a real polynomial at each point into one row of a
+/// `gsl_matrix`, as gsl_poly_eval_derivs() does for a single point.
+///
+/// - Horner's rule runs across a block of gsl::poly_block points at once,
+///   so that the loop over points is vectorized by the compiler.  Compile
+///   with, e.g., `-O3 -march=native` to use the widest registers.  Each
+///   point sees the same operations in the same order as in GSL, up to
+///   contraction of multiply-add by the compiler.
+///
+/// - Points are evaluated in chunks of gsl::poly_grain over a
+///   gsl::thread_pool, and the result does not depend on the number of
+///   threads.
+///
+/// gsl::batch_poly_solver finds the complex roots of many real polynomials
+/// of the same degree, packed end to end in one vector, and distributes the
+/// polynomials over a gsl::thread_pool.  Degrees up to three are solved in
+/// closed form; higher degrees by gsl_poly_complex_solve(), with one
+/// workspace per worker.  The status of each polynomial is returned.
+///
+/// \code
+/// gsl::vector<double> c({0.1, 2.0, -0.03}); // 0.1 + 2 x - 0.03 x^2
+/// gsl::vector<double> x(1000000), d(3 * 1000000);
+/// // ... fill x ...
+/// gsl::vector<double> y= gsl::poly_eval(c, x);
+/// gsl_matrix *m= gsl_matrix_alloc(1000000, 2); // value and slope
+/// gsl::poly_eval_derivs(c, x, m);
+/// // ... fill d with 1000000 quadratics ...
+/// gsl::vector<gsl::complex<double>> z(2 * 1000000);
+/// gsl::batch_poly_solver s(3);
+/// std::vector<int> status= s.solve(d, z);
+/// \endcode
+
+// EOF
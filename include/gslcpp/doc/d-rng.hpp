@@ -0,0 +1,32 @@
+/// \file       include/gslcpp/doc/d-rng.hpp
+/// \brief      Narrative documentation for random numbers.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_rng About Random Numbers
+///
+/// gsl::rng owns a GSL generator.  Each distribution, like gsl::ran_gaussian
+/// or gsl::ran_poisson, is a small function-object holding the parameters of
+/// a `gsl_ran` function.
+///
+/// gsl::ran_fill() fills any gsl::v_iface with variates.
+///
+/// - Given a gsl::rng, it fills the vector serially, in order, from that
+///   generator.
+///
+/// - Given a seed, it fills the vector in parallel over a gsl::thread_pool.
+///   Each chunk of gsl::rng_grain elements has its own generator, seeded by
+///   gsl::ran_seed() from the seed and the offset of the chunk.  The result
+///   is reproducible and does not depend on the number of threads.
+///
+/// The type of the distribution is known at compile-time, and so the only
+/// indirect call per variate is the one inside GSL's generator.
+///
+/// \code
+/// gsl::vector<double> v(100000000);
+/// gsl::ran_fill(v, gsl::ran_gaussian{2.0}, 12345); // Parallel, reproducible.
+/// gsl::rng r(7);
+/// gsl::vector<unsigned> k(1000);
+/// gsl::ran_fill(k, gsl::ran_poisson{3.5}, r); // Serial, from `r`.
+/// \endcode
+
+// EOF
@@ -0,0 +1,46 @@
+/// \file       include/gslcpp/doc/d-scan.hpp
+/// \brief      Narrative documentation for prefix sums and scans.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_scan About Prefix Sums and Scans
+///
+/// gsl::inclusive_scan() and gsl::exclusive_scan() combine the elements of
+/// any gsl::v_iface by an associative operation (addition by default) and
+/// write each partial result into another vector, or into the same one.
+/// gsl::cumsum() and gsl::cumprod() are inclusive scans by addition and by
+/// multiplication, either in place or into another vector.
+///
+/// - The vector is split into chunks of gsl::scan_grain elements.  With
+///   only one chunk, or with only one worker in the gsl::thread_pool, the
+///   chunks are scanned in order, in a single pass.
+///
+/// - Otherwise, there are two passes.  The first reduces every chunk but the
+///   last, in parallel.  The carry into each chunk is then accumulated
+///   serially over the reductions, and the second pass scans each chunk in
+///   parallel from its carry.
+///
+/// - Within a chunk, four elements at a time are combined by a log-step scan
+///   in registers, so that only one operation in four waits on the running
+///   total.
+///
+/// - Because the chunks and the blocks of four are fixed by offset, the
+///   result is the same for any number of threads.  For an integral type,
+///   it is also exactly that of the serial loop.  For a floating-point type,
+///   the association differs from that of the serial loop, and so the last
+///   bits may differ.
+///
+/// A call that passes a function-object from namespace `std`, like
+/// `std::multiplies`, should be qualified as `gsl::inclusive_scan()` or
+/// `gsl::exclusive_scan()`, lest argument-dependent lookup find the
+/// algorithm of the same name in `std`.
+///
+/// The exclusive scan is the usual way to turn counts into offsets for
+/// bucketing:
+///
+/// \code
+/// gsl::vector<unsigned long> count(256), offset(256);
+/// // ... count[b] is number of items in bucket b ...
+/// gsl::exclusive_scan(count, offset); // offset[b] is first slot of bucket b.
+/// \endcode
+
+// EOF
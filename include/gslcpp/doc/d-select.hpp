@@ -0,0 +1,47 @@
+/// \file       include/gslcpp/doc/d-select.hpp
+/// \brief      Narrative documentation for selection by predicate or mask.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_select About Selection by Predicate or Mask
+///
+/// These functions filter and blend any gsl::v_iface without a loop over
+/// gsl::v_iterator and without an intermediate `std::vector`.
+///
+/// - gsl::count_if() counts the elements that satisfy a predicate.
+/// - gsl::compress() copies those elements, in order, either to the front of
+///   a destination, returning their number, or into a new gsl::vector of
+///   exactly that size.
+/// - gsl::mask_if() returns a mask, a gsl::vector of `unsigned char` with 1
+///   where the predicate is true.
+/// - gsl::where() chooses each element from one of two vectors, by mask.
+/// - gsl::transform_where(), gsl::add_where(), gsl::sub_where(),
+///   gsl::mul_where(), and gsl::div_where() modify a vector in place only
+///   where the mask is nonzero.
+///
+/// Compaction writes every element to a small buffer on the stack and
+/// advances the output-count by the value of the predicate, so that there is
+/// no branch on the predicate, whose outcome is often unpredictable.  The
+/// masked operations are likewise written as blends.
+///
+/// A vector of more than gsl::select_grain elements is processed in chunks
+/// over a gsl::thread_pool.  Parallel compaction takes two passes: the
+/// selected elements of each chunk are counted, the counts are turned into
+/// offsets by an exclusive scan, and each chunk is then compacted into
+/// place.  Because the order of elements is kept, the result does not
+/// depend on the number of threads.  The predicate is evaluated twice for
+/// each element and so should have no side-effect.
+///
+/// \code
+/// gsl::vector<double> v(1000000);
+/// // ... fill v ...
+/// auto const big= [](double x) { return x > 0.5; };
+/// size_t const k= gsl::count_if(v, big);
+/// if(k) {
+///   gsl::vector<double> const kept= gsl::compress(v, big);
+/// }
+/// gsl::vector<unsigned char> const m= gsl::mask_if(v, big);
+/// gsl::vector<double> w(1000000);
+/// gsl::where(m, v, w, w); // w[i]= v[i] where v[i] > 0.5
+/// \endcode
+
+// EOF
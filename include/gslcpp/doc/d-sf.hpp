@@ -0,0 +1,43 @@
+/// \file       include/gslcpp/doc/d-sf.hpp
+/// \brief      Narrative documentation for special functions over vectors.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_sf About Special Functions over Vectors
+///
+/// gsl::sf_eval() evaluates a special function of GSL at every element of
+/// any gsl::v_iface, writing the values into another vector, or into the
+/// same one, and, optionally, GSL's estimates of absolute error into a third
+/// vector.  The function is any callable `f(double, gsl_sf_result *)` that
+/// returns GSL's status: a gsl_sf function in its `_e` form, like
+/// `gsl_sf_bessel_J0_e`, or one of the function-objects gsl::sf_bessel_Jn,
+/// gsl::sf_bessel_Yn, gsl::sf_gamma, gsl::sf_lngamma, gsl::sf_erf,
+/// gsl::sf_erfc, and gsl::sf_legendre_Pl, whose members hold parameters like
+/// order or degree.
+///
+/// For a range of orders at each argument, gsl::sf_bessel_Jn_array(),
+/// gsl::sf_bessel_Yn_array(), and gsl::sf_legendre_Pl_array() call GSL's
+/// array-functions, each of which runs a recurrence over order instead of
+/// evaluating each order by itself.  Each argument fills one row of a
+/// `gsl_matrix`.
+///
+/// - Elements are evaluated in chunks of gsl::sf_grain over a
+///   gsl::thread_pool, and rows of a matrix in chunks of about as many
+///   values.  Every element is evaluated independently, so the result does
+///   not depend on the number of threads.
+///
+/// - Each function returns zero, or the nonzero status of the first element
+///   (in order) for which GSL failed.  Every other element is still
+///   evaluated.  GSL's default handler of errors aborts the program; call
+///   `gsl_set_error_handler_off()` to get the status instead.
+///
+/// \code
+/// gsl_set_error_handler_off();
+/// gsl::vector<double> x(100000), y(100000), e(100000);
+/// // ... fill x ...
+/// int s= gsl::sf_eval(x, y, gsl::sf_bessel_Jn{3});
+/// s= gsl::sf_eval(x, y, e, gsl_sf_erf_e); // with errors
+/// gsl_matrix *j= gsl_matrix_alloc(100000, 11);
+/// s= gsl::sf_bessel_Jn_array(0, 10, x, j); // orders 0 through 10
+/// \endcode
+
+// EOF
@@ -0,0 +1,35 @@
+/// \file       include/gslcpp/doc/d-sort.hpp
+/// \brief      Narrative documentation for sorting.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_sort About Sorting
+///
+/// gsl::sort(), gsl::sort_index(), gsl::partial_sort(), and
+/// gsl::nth_element() operate on any gsl::v_iface, including a strided
+/// gsl::vector_view.  They replace GSL's `gsl_sort_vector` family, and they
+/// are much faster than `std::sort` over gsl::v_iterator.
+///
+/// - A strided vector is gathered into contiguous storage, sorted there, and
+///   scattered back.  A contiguous vector is sorted in place.
+///
+/// - A large vector is split into chunks of 65536 elements.  Each chunk is
+///   sorted by gsl::radix_sort() (for an integral type, for `float`, and for
+///   `double`) or by `std::sort` (for `long double`).  Then gsl::merge_sort()
+///   merges the chunks in parallel over a gsl::thread_pool.  Every merge,
+///   including the last, is split across every worker.
+///
+/// - gsl::sort_index() is stable and returns a gsl::vector of `size_t`, or
+///   writes into an existing one.
+///
+/// - For `float` and `double`, the order is total: -0 precedes +0, and NaN
+///   sorts to one end or the other according to its sign-bit.
+///
+/// - Scratch space as large as the vector is allocated for each call.
+///
+/// \code
+/// gsl::vector<double> v({3.0, 1.0, 2.0});
+/// auto const perm= gsl::sort_index(v); // {1, 2, 0}
+/// gsl::sort(v); // {1.0, 2.0, 3.0}
+/// \endcode
+
+// EOF
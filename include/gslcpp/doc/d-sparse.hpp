@@ -0,0 +1,58 @@
+/// \file       include/gslcpp/doc/d-sparse.hpp
+/// \brief      Narrative documentation for sparse vectors and matrices.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_sparse About Sparse Vectors and Matrices
+///
+/// gsl::sparse_vector stores only the offsets and values of its nonzero
+/// elements, in order of offset.  It combines with any gsl::v_iface through
+/// the free functions
+///
+/// - gsl::dot(), whose cost is proportional to the number of stored elements;
+/// - gsl::axpy(), which adds a multiple of the sparse vector to a dense one;
+/// - gsl::scatter(), which writes the stored elements into a dense vector;
+///   and
+/// - gsl::gather(), which reads a dense vector at the stored offsets.
+///
+/// gsl::spmatrix owns GSL's sparse matrix.  It is built in coordinate storage
+/// and compressed by `csr()` or `csc()`.  gsl::spmv() multiplies a sparse
+/// matrix by a dense vector over a gsl::thread_pool.  Compressed-row storage
+/// is preferred: each thread computes whole elements of the product, which
+/// is then independent of the number of threads.
+///
+/// \code
+/// gsl::spmatrix coo(1000000, 1000000);
+/// // ... coo.set(i, j, x) for each nonzero ...
+/// gsl::spmatrix const a= coo.csr();
+/// gsl::vector<double> x(1000000), y(1000000);
+/// gsl::spmv(a, x, y); // y= a * x, in parallel.
+/// \endcode
+///
+/// The same names, with a vector of integral indices in place of the sparse
+/// vector, move elements between two dense vectors.
+///
+/// - gsl::gather(src, idx, dst) sets `dst[i]= src[idx[i]]`, in parallel.
+/// - gsl::scatter(src, idx, dst) sets `dst[idx[i]]= src[i]`, in order, so
+///   that the last of repeated indices wins.
+/// - gsl::scatter_add(src, idx, dst) adds `src[i]` to `dst[idx[i]]`, in
+///   parallel but without atomic operations: the pairs of index and value
+///   are first partitioned by block of destination, and each thread adds
+///   only into its own block.  The result is identical to that of the
+///   serial loop.
+///
+/// Every index is checked, and `std::out_of_range` is thrown before any
+/// element is written, if an index be beyond the size of the indexed vector.
+/// With `-mavx2` or `-mavx512f` (or `-march=native` on such a machine),
+/// gather of contiguous `double` by contiguous indices uses the hardware's
+/// gather-instruction.  Each loop prefetches the element that it will need
+/// gsl::gather_ahead indices later.
+///
+/// \code
+/// gsl::vector<double> table(1000000), rows(4096), grad(4096);
+/// gsl::vector<int> idx(4096);
+/// // ... fill idx with offsets into table ...
+/// gsl::gather(table, idx, rows); // rows[i]= table[idx[i]]
+/// gsl::scatter_add(grad, idx, table); // table[idx[i]]+= grad[i]
+/// \endcode
+
+// EOF
@@ -0,0 +1,76 @@
+/// \file       include/gslcpp/doc/d-statistics.hpp
+/// \brief      Narrative documentation for statistics.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_statistics About Statistics
+///
+/// gsl::mean(), gsl::variance(), gsl::sd(), gsl::skew(), gsl::kurtosis(),
+/// gsl::covariance(), and gsl::correlation() accept any gsl::v_iface,
+/// including a strided gsl::vector_view, and match the definitions of the
+/// corresponding `gsl_stats` functions.
+///
+/// - Each reads the vector only once.  gsl::moments_of() returns a
+///   gsl::moments, from which every univariate statistic is available, and
+///   gsl::comoments_of() returns a gsl::comoments for a pair of vectors.
+///
+/// - The vector is processed in blocks of 1024 elements.  For each block, the
+///   mean is found first and then the central moments about it, while the
+///   block is still in cache.  Each loop uses four independent accumulators,
+///   so that the compiler can vectorize it without reordering any sum.  The
+///   block is merged into the running total by Pébay's formulas.
+///
+/// - Chunks of 65536 elements are reduced in parallel over a
+///   gsl::thread_pool and merged in order, so that the result does not depend
+///   on the number of threads.
+///
+/// - gsl::moments and gsl::comoments may also be used directly, to accumulate
+///   values one at a time or array by array, and to merge accumulators of
+///   disjoint data.
+///
+/// \code
+/// gsl::vector<double> v({1.0, 2.0, 3.0, 4.0});
+/// gsl::moments const m= gsl::moments_of(v);
+/// // m.mean() is 2.5; m.variance() is 5/3.
+/// \endcode
+///
+/// \section d_statistics_quantile Quantiles
+///
+/// gsl::median(), gsl::quantile(), and gsl::quantiles() match
+/// `gsl_stats_median()` and `gsl_stats_quantile_from_sorted_data()`, but no
+/// sorted copy is needed.
+///
+/// - The vector is copied into a gsl::quantile_workspace, which is reused
+///   across calls.  By default, the calling thread's workspace is used, so
+///   that repeated queries allocate nothing.
+///
+/// - Each quantile is found by selection (`std::nth_element`), in expected
+///   linear time.  gsl::quantiles() computes several quantiles from a single
+///   copy by gsl::select_many(), which recursively partitions around the
+///   middle requested offset.
+///
+/// For a very large vector, gsl::tdigest_of() builds an approximate sketch, a
+/// gsl::tdigest, in parallel over a gsl::thread_pool.  Its size is bounded by
+/// the compression, and its error is smallest near the tails.
+///
+/// \code
+/// gsl::vector<double> f({0.5, 0.9, 0.99}), r(3);
+/// gsl::quantiles(v, f, r); // Exact p50, p90, and p99.
+/// gsl::tdigest t= gsl::tdigest_of(v);
+/// double const p99= t.quantile(0.99); // Approximate p99.
+/// \endcode
+///
+/// \section d_statistics_rstat Running Statistics
+///
+/// gsl::rstat replaces GSL's `gsl_rstat_workspace` for a stream that arrives
+/// in chunks.  Each call to `add()` ingests a whole gsl::v_iface in parallel,
+/// and accumulators kept by different threads may be merged by `+=`.  The
+/// median comes from a gsl::tdigest rather than from GSL's P-squared
+/// algorithm, because a t-digest can be merged.
+///
+/// \code
+/// gsl::rstat r;
+/// while(read_chunk(chunk)) r.add(chunk);
+/// double const m= r.mean(), s= r.sd(), med= r.median();
+/// \endcode
+
+// EOF
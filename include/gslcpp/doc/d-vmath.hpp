@@ -0,0 +1,55 @@
+/// \file       include/gslcpp/doc/d-vmath.hpp
+/// \brief      Narrative documentation for elementwise math on vectors.
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+
+/// \page d_vmath About Elementwise Math on Vectors
+///
+/// gsl::exp(), gsl::log(), gsl::sqrt(), gsl::sin(), and gsl::cos() apply a
+/// function to every element of any gsl::v_iface.  Each has two forms: one
+/// writes a destination of the same size, which may be the source itself,
+/// and the other returns a new gsl::vector.  gsl::pow() raises every
+/// element to a power, and gsl::elementwise() applies any function of one
+/// argument.  For special functions of GSL, with estimates of error and
+/// status, see \ref d_sf.
+///
+/// - For elements of type `double` or `float`, exp, log, sin, and cos are
+///   evaluated by kernels that take gsl::math_lanes elements at a time, in a
+///   gsl::math_pack as wide as the target's vector-registers: eight lanes
+///   with AVX-512, four with AVX, and two with SSE2 or NEON.  The width is
+///   chosen at compile-time, so compile with, e.g., `-march=native` for the
+///   widest registers.
+///
+/// - Each kernel has no branch.  The reductions and polynomials are those of
+///   fdlibm; the error is less than one ULP for `double`, over the whole
+///   domain, including subnormal numbers, zeros, infinities, and NaN.  A
+///   `float` is computed through `double` and rounded once, so that its
+///   error, too, is less than one ULP.  The square root is correctly
+///   rounded.
+///
+/// - An argument of sin or cos larger than 1e5 in magnitude, or very near a
+///   multiple of pi/2, is passed to the standard library, whose reduction is
+///   exact.  Such lanes are rare, and the rest of the pack is unaffected.
+///
+/// - Elements of any other type, such as `long double` or gsl::complex, are
+///   passed to `std::exp`, `std::log`, etc., one at a time; so are all
+///   elements for gsl::pow() and gsl::elementwise().
+///
+/// - A vector of more than gsl::math_grain elements is processed in chunks
+///   over a gsl::thread_pool.  The result does not depend on the number of
+///   threads.
+///
+/// These functions have the same names as those of the standard library.
+/// Within namespace `gsl`, which hides the global scalar functions, call
+/// them as `std::exp`, etc.
+///
+/// \code
+/// gsl::vector<double> x(1000000);
+/// // ... fill x ...
+/// gsl::vector<double> const y= gsl::exp(x);
+/// gsl::log(y, x); // into existing vector
+/// gsl::sin(x, x); // in place
+/// gsl::vector<double> j(1000000);
+/// gsl::elementwise(x, j, gsl_sf_bessel_J0);
+/// \endcode
+
+// EOF
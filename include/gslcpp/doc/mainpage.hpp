@@ -16,5 +16,23 @@
 /// - \ref d_vector "About gsl::vector"
 /// - \ref d_vector_view "About gsl::vector_view"
 /// - \ref d_v_iface "About gsl::v_iface"
+/// - \ref d_multimin "About multidimensional minimization"
+/// - \ref d_integration "About numerical integration"
+/// - \ref d_sort "About sorting"
+/// - \ref d_statistics "About statistics"
+/// - \ref d_movstat "About moving-window statistics"
+/// - \ref d_filter "About digital filters"
+/// - \ref d_fft "About fast Fourier transforms"
+/// - \ref d_rng "About random numbers"
+/// - \ref d_monte "About Monte Carlo integration"
+/// - \ref d_histogram "About histograms"
+/// - \ref d_interp "About interpolation"
+/// - \ref d_linalg "About linear algebra"
+/// - \ref d_sparse "About sparse vectors and matrices"
+/// - \ref d_scan "About prefix sums and scans"
+/// - \ref d_select "About selection by predicate or mask"
+/// - \ref d_vmath "About elementwise math on vectors"
+/// - \ref d_sf "About special functions over vectors"
+/// - \ref d_poly "About polynomials over vectors"
 
 // EOF
@@ -0,0 +1,10 @@
+/// \file       include/gslcpp/fft.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for fast Fourier transforms.
+
+#pragma once
+
+#include "fft/fft-cache.hpp" // fft_cache
+#include "fft/v-fft.hpp" // fft_forward, fft_real, etc.
+
+// EOF
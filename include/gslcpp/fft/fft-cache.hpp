@@ -0,0 +1,140 @@
+/// \file       include/gslcpp/fft/fft-cache.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::fft_cache.
+
+#pragma once
+
+#include "fft-traits.hpp" // fft_traits
+#include <map> // map
+#include <memory> // shared_ptr, unique_ptr
+#include <mutex> // lock_guard, mutex
+
+namespace gsl {
+
+
+/// Cache, by length, of wavetables and of workspaces for GSL's mixed-radix
+/// FFT.
+///
+/// Computing a wavetable costs about as much as a transform, and so each
+/// wavetable is computed once for each length and then shared.  A wavetable
+/// is never modified by a transform, and so the shared wavetable may be used
+/// by every thread at once.  Lookup of a wavetable is protected by a mutex.
+///
+/// A workspace is modified by a transform, and so each thread has its own
+/// workspace for each length; lookup of a workspace requires no lock.
+///
+/// \tparam T  Type of each real component, `double` or `float`.
+template<typename T> class fft_cache {
+  using traits= fft_traits<T>; ///< Types and functions of GSL.
+
+  /// Function-object that free wavetable or workspace.
+  struct deleter {
+    /// Free wavetable or workspace.
+    /// \tparam W  Type of wavetable or workspace.
+    /// @param w  Pointer to wavetable or workspace.
+    template<typename W> void operator()(W *w) const { traits::free(w); }
+  };
+
+  /// Map from length to shared wavetable.
+  /// \tparam W  Type of wavetable.
+  template<typename W> using tables= std::map<size_t, std::shared_ptr<W>>;
+
+  /// Map from length to thread's own workspace.
+  /// \tparam W  Type of workspace.
+  template<typename W>
+  using spaces= std::map<size_t, std::unique_ptr<W, deleter>>;
+
+  /// Mutex that protect every map of wavetables.
+  /// @return  Reference to mutex.
+  static std::mutex &mutex() {
+    static std::mutex m;
+    return m;
+  }
+
+  /// Map of wavetables of type `W`.
+  /// \tparam W  Type of wavetable.
+  /// @return  Reference to map.
+  template<typename W> static tables<W> &all_tables() {
+    static tables<W> t;
+    return t;
+  }
+
+  /// Find or allocate shared wavetable.
+  /// \tparam W  Type of wavetable.
+  /// @param n  Length of transform.
+  /// @return  Pointer to wavetable.
+  template<typename W> static std::shared_ptr<W const> table(size_t n) {
+    std::lock_guard<std::mutex> lock(mutex());
+    std::shared_ptr<W> &t= all_tables<W>()[n];
+    if(!t) t.reset(traits::alloc((W *)nullptr, n), deleter());
+    return t;
+  }
+
+  /// Find or allocate calling thread's workspace.
+  /// \tparam W  Type of workspace.
+  /// @param n  Length of transform.
+  /// @return  Pointer to workspace.
+  template<typename W> static W *space(size_t n) {
+    static thread_local spaces<W> s;
+    std::unique_ptr<W, deleter> &w= s[n];
+    if(!w) w.reset(traits::alloc((W *)nullptr, n));
+    return w.get();
+  }
+
+public:
+  /// Type of wavetable for complex transform.
+  using complex_wavetable= typename traits::complex_wavetable;
+
+  /// Type of workspace for complex transform.
+  using complex_workspace= typename traits::complex_workspace;
+
+  /// Type of wavetable for real transform.
+  using real_wavetable= typename traits::real_wavetable;
+
+  /// Type of wavetable for inverse of real transform.
+  using halfcomplex_wavetable= typename traits::halfcomplex_wavetable;
+
+  /// Type of workspace for real transform and for its inverse.
+  using real_workspace= typename traits::real_workspace;
+
+  /// Shared wavetable for complex transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to wavetable.
+  static auto complex_table(size_t n) { return table<complex_wavetable>(n); }
+
+  /// Shared wavetable for real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to wavetable.
+  static auto real_table(size_t n) { return table<real_wavetable>(n); }
+
+  /// Shared wavetable for inverse of real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to wavetable.
+  static auto halfcomplex_table(size_t n) {
+    return table<halfcomplex_wavetable>(n);
+  }
+
+  /// Calling thread's workspace for complex transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to workspace.
+  static auto complex_space(size_t n) { return space<complex_workspace>(n); }
+
+  /// Calling thread's workspace for real transform and for its inverse.
+  /// @param n  Length of transform.
+  /// @return  Pointer to workspace.
+  static auto real_space(size_t n) { return space<real_workspace>(n); }
+
+  /// Release every cached wavetable.  A wavetable still in use by a
+  /// transform is freed when the transform finishes.
+  static void clear() {
+    std::lock_guard<std::mutex> lock(mutex());
+    all_tables<complex_wavetable>().clear();
+    all_tables<real_wavetable>().clear();
+    all_tables<halfcomplex_wavetable>().clear();
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
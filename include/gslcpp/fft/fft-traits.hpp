@@ -0,0 +1,242 @@
+/// \dir        include/gslcpp/fft
+/// \brief      Types and functions specific to fast Fourier transforms.
+
+/// \file       include/gslcpp/fft/fft-traits.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::fft_traits.
+
+#pragma once
+
+#include <gsl/gsl_fft_complex.h> // gsl_fft_complex_forward, etc.
+#include <gsl/gsl_fft_complex_float.h> // gsl_fft_complex_float_forward, etc.
+#include <gsl/gsl_fft_halfcomplex.h> // gsl_fft_halfcomplex_inverse, etc.
+#include <gsl/gsl_fft_halfcomplex_float.h> // gsl_fft_halfcomplex_float_inverse
+#include <gsl/gsl_fft_real.h> // gsl_fft_real_transform, etc.
+#include <gsl/gsl_fft_real_float.h> // gsl_fft_real_float_transform, etc.
+
+namespace gsl {
+
+
+/// Types and functions of GSL's mixed-radix FFT for each type of component.
+/// This is the generic declaration; see each specialization for details.
+/// \sa gsl::fft_traits<double>
+/// \sa gsl::fft_traits<float>
+/// \tparam T  Type of each real component.
+template<typename T> struct fft_traits;
+
+
+/// Specialization of \ref gsl::fft_traits for double.
+template<> struct fft_traits<double> {
+  /// Type of wavetable for complex transform.
+  using complex_wavetable= gsl_fft_complex_wavetable;
+
+  /// Type of workspace for complex transform.
+  using complex_workspace= gsl_fft_complex_workspace;
+
+  /// Type of wavetable for real transform.
+  using real_wavetable= gsl_fft_real_wavetable;
+
+  /// Type of wavetable for inverse of real transform.
+  using halfcomplex_wavetable= gsl_fft_halfcomplex_wavetable;
+
+  /// Type of workspace for real transform and for its inverse.
+  using real_workspace= gsl_fft_real_workspace;
+
+  /// Allocate wavetable for complex transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new wavetable.
+  static auto alloc(complex_wavetable *, size_t n) {
+    return gsl_fft_complex_wavetable_alloc(n);
+  }
+
+  /// Allocate workspace for complex transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new workspace.
+  static auto alloc(complex_workspace *, size_t n) {
+    return gsl_fft_complex_workspace_alloc(n);
+  }
+
+  /// Allocate wavetable for real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new wavetable.
+  static auto alloc(real_wavetable *, size_t n) {
+    return gsl_fft_real_wavetable_alloc(n);
+  }
+
+  /// Allocate wavetable for inverse of real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new wavetable.
+  static auto alloc(halfcomplex_wavetable *, size_t n) {
+    return gsl_fft_halfcomplex_wavetable_alloc(n);
+  }
+
+  /// Allocate workspace for real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new workspace.
+  static auto alloc(real_workspace *, size_t n) {
+    return gsl_fft_real_workspace_alloc(n);
+  }
+
+  /// Free wavetable for complex transform.
+  /// @param w  Pointer to wavetable.
+  static void free(complex_wavetable *w) {
+    gsl_fft_complex_wavetable_free(w);
+  }
+
+  /// Free workspace for complex transform.
+  /// @param w  Pointer to workspace.
+  static void free(complex_workspace *w) {
+    gsl_fft_complex_workspace_free(w);
+  }
+
+  /// Free wavetable for real transform.
+  /// @param w  Pointer to wavetable.
+  static void free(real_wavetable *w) { gsl_fft_real_wavetable_free(w); }
+
+  /// Free wavetable for inverse of real transform.
+  /// @param w  Pointer to wavetable.
+  static void free(halfcomplex_wavetable *w) {
+    gsl_fft_halfcomplex_wavetable_free(w);
+  }
+
+  /// Free workspace for real transform.
+  /// @param w  Pointer to workspace.
+  static void free(real_workspace *w) { gsl_fft_real_workspace_free(w); }
+
+  /// Forward complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_forward
+  static constexpr auto forward= gsl_fft_complex_forward;
+
+  /// Backward complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_backward
+  static constexpr auto backward= gsl_fft_complex_backward;
+
+  /// Inverse complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_inverse
+  static constexpr auto inverse= gsl_fft_complex_inverse;
+
+  /// Real transform, to half-complex.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_real_transform
+  static constexpr auto real= gsl_fft_real_transform;
+
+  /// Backward half-complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_backward
+  static constexpr auto hc_backward= gsl_fft_halfcomplex_backward;
+
+  /// Inverse half-complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_inverse
+  static constexpr auto hc_inverse= gsl_fft_halfcomplex_inverse;
+};
+
+
+/// Specialization of \ref gsl::fft_traits for float.
+template<> struct fft_traits<float> {
+  /// Type of wavetable for complex transform.
+  using complex_wavetable= gsl_fft_complex_wavetable_float;
+
+  /// Type of workspace for complex transform.
+  using complex_workspace= gsl_fft_complex_workspace_float;
+
+  /// Type of wavetable for real transform.
+  using real_wavetable= gsl_fft_real_wavetable_float;
+
+  /// Type of wavetable for inverse of real transform.
+  using halfcomplex_wavetable= gsl_fft_halfcomplex_wavetable_float;
+
+  /// Type of workspace for real transform and for its inverse.
+  using real_workspace= gsl_fft_real_workspace_float;
+
+  /// Allocate wavetable for complex transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new wavetable.
+  static auto alloc(complex_wavetable *, size_t n) {
+    return gsl_fft_complex_wavetable_float_alloc(n);
+  }
+
+  /// Allocate workspace for complex transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new workspace.
+  static auto alloc(complex_workspace *, size_t n) {
+    return gsl_fft_complex_workspace_float_alloc(n);
+  }
+
+  /// Allocate wavetable for real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new wavetable.
+  static auto alloc(real_wavetable *, size_t n) {
+    return gsl_fft_real_wavetable_float_alloc(n);
+  }
+
+  /// Allocate wavetable for inverse of real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new wavetable.
+  static auto alloc(halfcomplex_wavetable *, size_t n) {
+    return gsl_fft_halfcomplex_wavetable_float_alloc(n);
+  }
+
+  /// Allocate workspace for real transform.
+  /// @param n  Length of transform.
+  /// @return  Pointer to new workspace.
+  static auto alloc(real_workspace *, size_t n) {
+    return gsl_fft_real_workspace_float_alloc(n);
+  }
+
+  /// Free wavetable for complex transform.
+  /// @param w  Pointer to wavetable.
+  static void free(complex_wavetable *w) {
+    gsl_fft_complex_wavetable_float_free(w);
+  }
+
+  /// Free workspace for complex transform.
+  /// @param w  Pointer to workspace.
+  static void free(complex_workspace *w) {
+    gsl_fft_complex_workspace_float_free(w);
+  }
+
+  /// Free wavetable for real transform.
+  /// @param w  Pointer to wavetable.
+  static void free(real_wavetable *w) {
+    gsl_fft_real_wavetable_float_free(w);
+  }
+
+  /// Free wavetable for inverse of real transform.
+  /// @param w  Pointer to wavetable.
+  static void free(halfcomplex_wavetable *w) {
+    gsl_fft_halfcomplex_wavetable_float_free(w);
+  }
+
+  /// Free workspace for real transform.
+  /// @param w  Pointer to workspace.
+  static void free(real_workspace *w) {
+    gsl_fft_real_workspace_float_free(w);
+  }
+
+  /// Forward complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_forward
+  static constexpr auto forward= gsl_fft_complex_float_forward;
+
+  /// Backward complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_backward
+  static constexpr auto backward= gsl_fft_complex_float_backward;
+
+  /// Inverse complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_inverse
+  static constexpr auto inverse= gsl_fft_complex_float_inverse;
+
+  /// Real transform, to half-complex.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_real_transform
+  static constexpr auto real= gsl_fft_real_float_transform;
+
+  /// Backward half-complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_backward
+  static constexpr auto hc_backward= gsl_fft_halfcomplex_float_backward;
+
+  /// Inverse half-complex transform.
+  /// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_inverse
+  static constexpr auto hc_inverse= gsl_fft_halfcomplex_float_inverse;
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,354 @@
+/// \file       include/gslcpp/fft/v-fft.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for FFT of gsl::v_iface.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/complex.hpp" // complex
+#include "fft-cache.hpp" // fft_cache
+#include <gsl/gsl_errno.h> // GSL_SUCCESS
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Apply transform, in place, to each of consecutive segments of vector.
+///
+/// The wavetable for the length of a segment is fetched once from
+/// gsl::fft_cache, and each worker uses its own cached workspace.
+///
+/// \tparam X  Type of element in vector, real or complex.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam R  Type of real component.
+/// \tparam F  Type of function `f(d, s, n, table, space)` from GSL.
+/// \tparam G  Type of function `g(n)` that return shared wavetable.
+/// \tparam H  Type of function `h(n)` that return thread's workspace.
+/// @param v  Vector.
+/// @param n  Length of each segment.
+/// @param d  Pointer to first real component of first element.
+/// @param r  Number of real components per element (1 or 2).
+/// @param f  Transform from GSL.
+/// @param g  Function that return shared wavetable.
+/// @param h  Function that return thread's workspace.
+/// @param p  Pool over which to distribute segments.
+/// @return  Zero only on success.
+template<
+      typename X,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename R,
+      typename F,
+      typename G,
+      typename H>
+int fft_segments(
+      v_iface<X, N, V> &v,
+      size_t n,
+      R *d,
+      size_t r,
+      F f,
+      G g,
+      H h,
+      thread_pool &p) {
+  size_t const size= v.size(), s= v.v()->stride;
+  if(size == 0) return GSL_SUCCESS;
+  if(n == 0 || size % n) {
+    throw std::invalid_argument("size not multiple of length");
+  }
+  auto const table= g(n);
+  if(size == n) return f(d, s, n, table.get(), h(n));
+  std::vector<int> status(p.size(), GSL_SUCCESS);
+  p.for_each(size / n, [&](size_t i, unsigned w) {
+    int const e= f(d + i * n * s * r, s, n, table.get(), h(n));
+    if(e != GSL_SUCCESS) status[w]= e;
+  });
+  for(int e: status) {
+    if(e != GSL_SUCCESS) return e;
+  }
+  return GSL_SUCCESS;
+}
+
+
+/// Apply complex transform, in place, to each of consecutive segments.
+/// \tparam T  Type of each real component.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam F  Type of transform from GSL.
+/// @param v  Vector.
+/// @param n  Length of each segment.
+/// @param f  Transform from GSL.
+/// @param p  Pool over which to distribute segments.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V, typename F>
+int fft_complex_segments(
+      v_iface<complex<T>, N, V> &v, size_t n, F f, thread_pool &p) {
+  using cache= fft_cache<T>;
+  return fft_segments(
+        v, n, reinterpret_cast<T *>(v.data()), 2, f,
+        [](size_t m) { return cache::complex_table(m); },
+        [](size_t m) { return cache::complex_space(m); }, p);
+}
+
+
+/// Apply real or half-complex transform, in place, to each of consecutive
+/// segments.
+/// \tparam T  Type of each real component.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam F  Type of transform from GSL.
+/// \tparam G  Type of function `g(n)` that return shared wavetable.
+/// @param v  Vector.
+/// @param n  Length of each segment.
+/// @param f  Transform from GSL.
+/// @param g  Function that return shared wavetable.
+/// @param p  Pool over which to distribute segments.
+/// @return  Zero only on success.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename F,
+      typename G>
+int fft_real_segments(
+      v_iface<T, N, V> &v, size_t n, F f, G g, thread_pool &p) {
+  using cache= fft_cache<T>;
+  return fft_segments(
+        v, n, v.data(), 1, f, g,
+        [](size_t m) { return cache::real_space(m); }, p);
+}
+
+
+/// Forward FFT of complex vector, in place.
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_forward
+/// \tparam T  Type of each real component, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, which may be strided view.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_forward(v_iface<complex<T>, N, V> &v) {
+  return fft_complex_segments(
+        v, v.size(), fft_traits<T>::forward, thread_pool::global());
+}
+
+
+/// Backward FFT (inverse without normalization) of complex vector, in place.
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_backward
+/// \tparam T  Type of each real component, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, which may be strided view.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_backward(v_iface<complex<T>, N, V> &v) {
+  return fft_complex_segments(
+        v, v.size(), fft_traits<T>::backward, thread_pool::global());
+}
+
+
+/// Inverse FFT of complex vector, in place.
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_complex_inverse
+/// \tparam T  Type of each real component, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, which may be strided view.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_inverse(v_iface<complex<T>, N, V> &v) {
+  return fft_complex_segments(
+        v, v.size(), fft_traits<T>::inverse, thread_pool::global());
+}
+
+
+/// Forward FFT of each of consecutive segments of complex vector, in place
+/// and in parallel.
+/// \tparam T  Type of each real component, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose size is multiple of `n`.
+/// @param n  Length of each transform.
+/// @param p  Pool over which to distribute transforms.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_forward_batch(
+      v_iface<complex<T>, N, V> &v,
+      size_t n,
+      thread_pool &p= thread_pool::global()) {
+  return fft_complex_segments(v, n, fft_traits<T>::forward, p);
+}
+
+
+/// Backward FFT of each of consecutive segments of complex vector, in place
+/// and in parallel.
+/// \tparam T  Type of each real component, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose size is multiple of `n`.
+/// @param n  Length of each transform.
+/// @param p  Pool over which to distribute transforms.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_backward_batch(
+      v_iface<complex<T>, N, V> &v,
+      size_t n,
+      thread_pool &p= thread_pool::global()) {
+  return fft_complex_segments(v, n, fft_traits<T>::backward, p);
+}
+
+
+/// Inverse FFT of each of consecutive segments of complex vector, in place
+/// and in parallel.
+/// \tparam T  Type of each real component, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose size is multiple of `n`.
+/// @param n  Length of each transform.
+/// @param p  Pool over which to distribute transforms.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_inverse_batch(
+      v_iface<complex<T>, N, V> &v,
+      size_t n,
+      thread_pool &p= thread_pool::global()) {
+  return fft_complex_segments(v, n, fft_traits<T>::inverse, p);
+}
+
+
+/// FFT of each of consecutive segments of real vector, in place and in
+/// parallel, to half-complex representation.
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose size is multiple of `n`.
+/// @param n  Length of each transform.
+/// @param p  Pool over which to distribute transforms.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_real_batch(
+      v_iface<T, N, V> &v, size_t n, thread_pool &p= thread_pool::global()) {
+  return fft_real_segments(
+        v, n, fft_traits<T>::real,
+        [](size_t m) { return fft_cache<T>::real_table(m); }, p);
+}
+
+
+/// FFT of real vector, in place, to half-complex representation.
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_real_transform
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, which may be strided view.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_real(v_iface<T, N, V> &v) {
+  return fft_real_batch(v, v.size());
+}
+
+
+/// Backward FFT of each of consecutive segments of half-complex vector, in
+/// place and in parallel.
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose size is multiple of `n`.
+/// @param n  Length of each transform.
+/// @param p  Pool over which to distribute transforms.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_halfcomplex_backward_batch(
+      v_iface<T, N, V> &v, size_t n, thread_pool &p= thread_pool::global()) {
+  return fft_real_segments(
+        v, n, fft_traits<T>::hc_backward,
+        [](size_t m) { return fft_cache<T>::halfcomplex_table(m); }, p);
+}
+
+
+/// Inverse FFT of each of consecutive segments of half-complex vector, in
+/// place and in parallel.
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose size is multiple of `n`.
+/// @param n  Length of each transform.
+/// @param p  Pool over which to distribute transforms.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_halfcomplex_inverse_batch(
+      v_iface<T, N, V> &v, size_t n, thread_pool &p= thread_pool::global()) {
+  return fft_real_segments(
+        v, n, fft_traits<T>::hc_inverse,
+        [](size_t m) { return fft_cache<T>::halfcomplex_table(m); }, p);
+}
+
+
+/// Inverse FFT of half-complex vector, in place, to real vector.
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_inverse
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, which may be strided view.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_halfcomplex_inverse(v_iface<T, N, V> &v) {
+  return fft_halfcomplex_inverse_batch(v, v.size());
+}
+
+
+/// Backward FFT (inverse without normalization) of half-complex vector, in
+/// place, to real vector.
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_backward
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, which may be strided view.
+/// @return  Zero only on success.
+template<typename T, size_t N, template<typename, size_t> class V>
+int fft_halfcomplex_backward(v_iface<T, N, V> &v) {
+  return fft_halfcomplex_backward_batch(v, v.size());
+}
+
+
+/// Convert half-complex representation to full complex vector.
+///
+/// This is like GSL's `gsl_fft_halfcomplex_unpack()`, except that the input
+/// and the output may have different strides.
+///
+/// https://www.gnu.org/software/gsl/doc/html/fft.html#c.gsl_fft_halfcomplex_unpack
+/// \tparam T  Type of element, `double` or `float`.
+/// \tparam N  Compile-time number of elements in input.
+/// \tparam NZ  Compile-time number of elements in output.
+/// \tparam V  Type of interface to storage for input.
+/// \tparam VZ  Type of interface to storage for output.
+/// @param hc  Half-complex input.
+/// @param z  Complex output, whose size must equal that of `hc`.
+template<
+      typename T,
+      size_t N,
+      size_t NZ,
+      template<typename, size_t>
+      class V,
+      template<typename, size_t>
+      class VZ>
+void halfcomplex_unpack(
+      v_iface<T, N, V> const &hc, v_iface<complex<T>, NZ, VZ> &z) {
+  size_t const n= hc.size();
+  if(z.size() != n) throw std::invalid_argument("mismatch in size");
+  if(n == 0) return;
+  z[0]= complex<T>(hc[0], T(0));
+  for(size_t i= 1; 2 * i < n; ++i) {
+    T const re= hc[2 * i - 1], im= hc[2 * i];
+    z[i]= complex<T>(re, im);
+    z[n - i]= complex<T>(re, -im);
+  }
+  if(n % 2 == 0) z[n / 2]= complex<T>(hc[n - 1], T(0));
+}
+
+
+} // namespace gsl
+
+// EOF
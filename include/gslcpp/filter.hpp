@@ -0,0 +1,12 @@
+/// \file       include/gslcpp/filter.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for digital filters.
+
+#pragma once
+
+#include "filter/gaussian.hpp" // gaussian_filter
+#include "filter/impulse.hpp" // impulse_filter
+#include "filter/median.hpp" // median_filter, rmedian_filter
+#include "filter/stream.hpp" // filter_stream
+
+// EOF
@@ -0,0 +1,155 @@
+/// \dir        include/gslcpp/filter
+/// \brief      Types specific to digital filters.
+
+/// \file       include/gslcpp/filter/filter-base.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::filter_base.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include <algorithm> // max, min
+#include <gsl/gsl_filter.h> // gsl_filter_end_t
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Common base for filter whose output at each sample depends only on input
+/// within `h` samples, so that a long vector may be processed in overlapping
+/// blocks.
+///
+/// The output is split into blocks of fixed size.  Each block is computed by
+/// one worker of a gsl::thread_pool, which calls GSL on the block of input
+/// extended by `h` samples on each side.  Because the boundaries of the blocks
+/// depend only on the length of the vector and on the window, the result does
+/// not depend on the number of threads, and it is identical to the result of
+/// a single call to GSL on the whole vector.
+///
+/// One GSL workspace for each worker is allocated on construction and reused
+/// by every call.
+///
+/// \tparam W  Type of GSL's workspace.
+template<typename W> class filter_base {
+  filter_base(filter_base const &)= delete; ///< Disable copying.
+  filter_base &operator=(filter_base const &)= delete; ///< Disable copying.
+
+  void (*free_)(W *); ///< Function that free workspace.
+  std::vector<std::vector<double>> out_; ///< Scratch output per worker.
+
+protected:
+  using end_type= gsl_filter_end_t; ///< Treatment of ends of input.
+
+  size_t h_; ///< Number of samples on each side of current sample in window.
+  end_type end_; ///< Treatment of ends of input.
+  thread_pool *pool_; ///< Pool over which to distribute blocks.
+  std::vector<W *> w_; ///< GSL's workspace per worker.
+
+  /// Allocate workspace for each worker.
+  /// @param k  Number of samples in window.
+  /// @param e  Treatment of ends of input.
+  /// @param p  Pool over which to distribute blocks.
+  /// @param alloc  Function that allocate workspace.
+  /// @param free  Function that free workspace.
+  filter_base(
+        size_t k,
+        end_type e,
+        thread_pool &p,
+        W *(*alloc)(size_t),
+        void (*free)(W *)):
+      free_(free),
+      out_(p.size()),
+      h_(k / 2),
+      end_(e),
+      pool_(&p),
+      w_(p.size()) {
+    for(auto &w: w_) w= alloc(k);
+  }
+
+  /// Deallocate workspaces.
+  ~filter_base() {
+    for(auto w: w_) free_(w);
+  }
+
+  /// Number of outputs in each block.
+  /// @return  Number of outputs in each block.
+  size_t grain() const { return std::max(size_t(1) << 16, 16 * (h_ + 1)); }
+
+  /// Check that sizes of input and output agree.
+  /// @param n  Size of input.
+  /// @param m  Size of output.
+  static void check(size_t n, size_t m) {
+    if(n != m) throw std::invalid_argument("mismatch in size");
+  }
+
+  /// Copy portion of block's scratch output into final output.
+  /// \tparam O  Type of element in scratch.
+  /// \tparam T  Type of element in output.
+  /// \tparam N  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for output.
+  /// @param o  Pointer to scratch output for extended block.
+  /// @param lo  Offset in input of first sample in extended block.
+  /// @param b  Offset of first output in block.
+  /// @param e  Offset one past last output in block.
+  /// @param y  Final output.
+  template<
+        typename O,
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V>
+  static void
+  emit(O const *o, size_t lo, size_t b, size_t e, v_iface<T, N, V> &y) {
+    for(size_t i= b; i < e; ++i) y[i]= o[i - lo];
+  }
+
+  /// Call function on each extended block of input, in parallel.
+  /// \tparam T  Type of element in input, `double` or `double const`.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam F  Type of function `f(xv, lo, b, e, o, w)`, which returns GSL's
+  ///            status.
+  /// @param x  Input.
+  /// @param k  Number of outputs per sample in scratch.
+  /// @param f  Function that filter view `xv` of input, beginning at offset
+  ///           `lo`, into scratch `o`, via workspace `w_[w]` of worker `w`,
+  ///           and then store outputs for offsets `b` through `e - 1`.
+  /// @return  Zero only on success.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename F>
+  int blocks(v_iface<T, N, V> const &x, size_t k, F &&f) {
+    size_t const n= x.size(), g= grain();
+    std::vector<int> status(w_.size(), GSL_SUCCESS);
+    pool_->for_chunks(n, g, [&](size_t b, size_t e, unsigned w) {
+      size_t const lo= (b > h_ ? b - h_ : 0), hi= std::min(n, e + h_);
+      std::vector<double> &o= out_[w];
+      o.resize(k * (g + 2 * h_));
+      int const r= f(x.subvector(hi - lo, lo), lo, b, e, o.data(), w);
+      if(r != GSL_SUCCESS) status[w]= r;
+    });
+    for(int r: status) {
+      if(r != GSL_SUCCESS) return r;
+    }
+    return GSL_SUCCESS;
+  }
+
+public:
+  /// Number of samples on each side of current sample in window.
+  /// @return  Number of samples on each side.
+  size_t h() const { return h_; }
+
+  /// Number of samples in window.
+  /// @return  Number of samples in window, `2 * h() + 1`.
+  size_t k() const { return 2 * h_ + 1; }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,95 @@
+/// \file       include/gslcpp/filter/gaussian.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::gaussian_filter.
+
+#pragma once
+
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "filter-base.hpp" // filter_base
+
+namespace gsl {
+
+
+/// Gaussian filter (or its derivative), over blocks in parallel.
+/// https://www.gnu.org/software/gsl/doc/html/filter.html#gaussian-filter
+class gaussian_filter: public filter_base<gsl_filter_gaussian_workspace> {
+  double alpha_; ///< Number of standard deviations in half-window.
+  size_t order_; ///< Order of derivative of Gaussian.
+
+public:
+  /// Allocate workspace for each worker.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_gaussian_alloc
+  /// @param k  Number of samples in window; if even, then window has `k + 1`
+  ///           samples.
+  /// @param alpha  Number of standard deviations in half-window.
+  /// @param order  Order of derivative of Gaussian (0 for smoothing).
+  /// @param e  Treatment of ends of input.
+  /// @param p  Pool over which to distribute blocks.
+  gaussian_filter(
+        size_t k,
+        double alpha,
+        size_t order= 0,
+        end_type e= GSL_FILTER_END_PADVALUE,
+        thread_pool &p= thread_pool::global()):
+      filter_base(
+            k, e, p, gsl_filter_gaussian_alloc, gsl_filter_gaussian_free),
+      alpha_(alpha),
+      order_(order) {}
+
+  /// Number of standard deviations in half-window.
+  /// @return  Number of standard deviations.
+  double alpha() const { return alpha_; }
+
+  /// Order of derivative of Gaussian.
+  /// @return  Order of derivative.
+  size_t order() const { return order_; }
+
+  /// Compute kernel of filter.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_gaussian_kernel
+  /// \tparam N  Compile-time number of elements in kernel.
+  /// \tparam V  Type of interface to storage for kernel.
+  /// @param kernel  On return, kernel, whose size should be k().
+  /// @param normalize  True if sum of kernel should be unity.
+  /// @return  Zero only on success.
+  template<size_t N, template<typename, size_t> class V>
+  int kernel(v_iface<double, N, V> &kernel, bool normalize= true) const {
+    return gsl_filter_gaussian_kernel(alpha_, order_, normalize, kernel.v());
+  }
+
+  /// Apply filter.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_gaussian
+  /// \tparam T  Type of element in input, `double` or `double const`.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int operator()(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) {
+    check(x.size(), y.size());
+    end_type const e= end_;
+    double const a= alpha_;
+    size_t const d= order_;
+    return blocks(x, 1, [&](auto xv, size_t lo, size_t b, size_t f,
+                            double *o, unsigned w) {
+      auto ov= w_vector_view_array(o, 1, xv.size());
+      int const r= gsl_filter_gaussian(e, a, d, xv.v(), &ov.vector, w_[w]);
+      emit(o, lo, b, f, y);
+      return r;
+    });
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
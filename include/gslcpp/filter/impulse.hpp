@@ -0,0 +1,130 @@
+/// \file       include/gslcpp/filter/impulse.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::impulse_filter.
+
+#pragma once
+
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "filter-base.hpp" // filter_base
+
+namespace gsl {
+
+
+/// Impulse-detection filter, over blocks in parallel.
+///
+/// A sample is an outlier if it differ from the median of its window by more
+/// than `t` times the robust scale-estimate of its window.  Each outlier is
+/// replaced by the median in the output.
+///
+/// https://www.gnu.org/software/gsl/doc/html/filter.html#impulse-detection-filter
+class impulse_filter: public filter_base<gsl_filter_impulse_workspace> {
+  using scale_type= gsl_filter_scale_t; ///< Type of scale-estimate.
+
+  double t_; ///< Threshold, in units of scale-estimate.
+  scale_type scale_; ///< Type of scale-estimate.
+  std::vector<std::vector<int>> flag_; ///< Scratch for outliers per worker.
+
+public:
+  /// Allocate workspace for each worker.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_impulse_alloc
+  /// @param k  Number of samples in window; if even, then window has `k + 1`
+  ///           samples.
+  /// @param t  Threshold, in units of scale-estimate.
+  /// @param s  Type of scale-estimate.
+  /// @param e  Treatment of ends of input.
+  /// @param p  Pool over which to distribute blocks.
+  impulse_filter(
+        size_t k,
+        double t,
+        scale_type s= GSL_FILTER_SCALE_MAD,
+        end_type e= GSL_FILTER_END_PADVALUE,
+        thread_pool &p= thread_pool::global()):
+      filter_base(k, e, p, gsl_filter_impulse_alloc, gsl_filter_impulse_free),
+      t_(t),
+      scale_(s),
+      flag_(p.size()) {}
+
+  /// Apply filter.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_impulse
+  /// \tparam T  Type of element in input, `double` or `double const`.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam NM  Compile-time number of elements in output of median.
+  /// \tparam NS  Compile-time number of elements in output of scale.
+  /// \tparam NO  Compile-time number of elements in output of outliers.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// \tparam VM  Type of interface to storage for output of median.
+  /// \tparam VS  Type of interface to storage for output of scale.
+  /// \tparam VO  Type of interface to storage for output of outliers.
+  /// @param x  Input.
+  /// @param y  Output, in which each outlier is replaced by median.
+  /// @param xmedian  Output of median of each window.
+  /// @param xsigma  Output of scale-estimate of each window.
+  /// @param noutlier  On return, number of outliers.
+  /// @param ioutlier  Output of 1 for each outlier and 0 for each other
+  ///                  sample.
+  /// @return  Zero only on success.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        size_t NM,
+        size_t NS,
+        size_t NO,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY,
+        template<typename, size_t>
+        class VM,
+        template<typename, size_t>
+        class VS,
+        template<typename, size_t>
+        class VO>
+  int operator()(
+        v_iface<T, N, V> const &x,
+        v_iface<double, NY, VY> &y,
+        v_iface<double, NM, VM> &xmedian,
+        v_iface<double, NS, VS> &xsigma,
+        size_t &noutlier,
+        v_iface<int, NO, VO> &ioutlier) {
+    size_t const n= x.size();
+    check(n, y.size());
+    check(n, xmedian.size());
+    check(n, xsigma.size());
+    check(n, ioutlier.size());
+    end_type const e= end_;
+    scale_type const s= scale_;
+    double const t= t_;
+    std::vector<size_t> count(w_.size(), 0);
+    int const r= blocks(x, 3, [&](auto xv, size_t lo, size_t b, size_t f,
+                                  double *o, unsigned w) {
+      size_t const m= xv.size();
+      std::vector<int> &flag= flag_[w];
+      flag.resize(m);
+      auto yv= w_vector_view_array(o, 1, m);
+      auto mv= w_vector_view_array(o + m, 1, m);
+      auto sv= w_vector_view_array(o + 2 * m, 1, m);
+      auto iv= w_vector_view_array(flag.data(), 1, m);
+      size_t c;
+      int const r= gsl_filter_impulse(
+            e, s, t, xv.v(), &yv.vector, &mv.vector, &sv.vector, &c,
+            &iv.vector, w_[w]);
+      emit(o, lo, b, f, y);
+      emit(o + m, lo, b, f, xmedian);
+      emit(o + 2 * m, lo, b, f, xsigma);
+      emit(flag.data(), lo, b, f, ioutlier);
+      for(size_t i= b; i < f; ++i) count[w]+= (flag[i - lo] != 0);
+      return r;
+    });
+    noutlier= 0;
+    for(size_t c: count) noutlier+= c;
+    return r;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,116 @@
+/// \file       include/gslcpp/filter/median.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::median_filter and gsl::rmedian_filter.
+
+#pragma once
+
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "filter-base.hpp" // filter_base
+
+namespace gsl {
+
+
+/// Standard median filter, over blocks in parallel.
+/// https://www.gnu.org/software/gsl/doc/html/filter.html#standard-median-filter
+class median_filter: public filter_base<gsl_filter_median_workspace> {
+public:
+  /// Allocate workspace for each worker.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_median_alloc
+  /// @param k  Number of samples in window; if even, then window has `k + 1`
+  ///           samples.
+  /// @param e  Treatment of ends of input.
+  /// @param p  Pool over which to distribute blocks.
+  explicit median_filter(
+        size_t k,
+        end_type e= GSL_FILTER_END_PADVALUE,
+        thread_pool &p= thread_pool::global()):
+      filter_base(k, e, p, gsl_filter_median_alloc, gsl_filter_median_free) {}
+
+  /// Apply filter.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_median
+  /// \tparam T  Type of element in input, `double` or `double const`.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int operator()(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) {
+    check(x.size(), y.size());
+    end_type const e= end_;
+    return blocks(x, 1, [&](auto xv, size_t lo, size_t b, size_t f,
+                            double *o, unsigned w) {
+      auto ov= w_vector_view_array(o, 1, xv.size());
+      int const r= gsl_filter_median(e, xv.v(), &ov.vector, w_[w]);
+      emit(o, lo, b, f, y);
+      return r;
+    });
+  }
+};
+
+
+/// Recursive median filter.
+///
+/// Because each output depends on earlier outputs, the filter cannot be
+/// split into independent blocks, and so GSL is called once, directly on the
+/// (possibly strided) input and output, without copying.
+///
+/// https://www.gnu.org/software/gsl/doc/html/filter.html#recursive-median-filter
+class rmedian_filter {
+  using end_type= gsl_filter_end_t; ///< Treatment of ends of input.
+
+  end_type end_; ///< Treatment of ends of input.
+  gsl_filter_rmedian_workspace *w_; ///< GSL's workspace.
+
+  rmedian_filter(rmedian_filter const &)= delete; ///< Disable copying.
+  rmedian_filter &operator=(rmedian_filter const &)= delete; ///< No copying.
+
+public:
+  /// Allocate workspace.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_rmedian_alloc
+  /// @param k  Number of samples in window; if even, then window has `k + 1`
+  ///           samples.
+  /// @param e  Treatment of ends of input.
+  explicit rmedian_filter(size_t k, end_type e= GSL_FILTER_END_PADVALUE):
+      end_(e), w_(gsl_filter_rmedian_alloc(k)) {}
+
+  /// Deallocate workspace.
+  ~rmedian_filter() { gsl_filter_rmedian_free(w_); }
+
+  /// Apply filter.
+  /// https://www.gnu.org/software/gsl/doc/html/filter.html#c.gsl_filter_rmedian
+  /// \tparam T  Type of element in input, `double` or `double const`.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int operator()(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) {
+    if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+    return gsl_filter_rmedian(end_, x.v(), y.v(), w_);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
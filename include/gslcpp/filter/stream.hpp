@@ -0,0 +1,116 @@
+/// \file       include/gslcpp/filter/stream.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::filter_stream.
+
+#pragma once
+
+#include "../vector-view.hpp" // vector_view
+#include <gsl/gsl_errno.h> // GSL_SUCCESS
+#include <stdexcept> // invalid_argument, runtime_error
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Streaming application of filter to input that arrives chunk by chunk.
+///
+/// The output for each sample is emitted as soon as the `h` samples after it
+/// have arrived, and so the output lags the input by `h` samples until
+/// finish() is called.  Only the last `2 * h` samples of input are retained
+/// between chunks.  The concatenation of the outputs is identical to the
+/// output of the filter on the concatenation of the inputs.
+///
+/// \tparam F  Type of filter, like gsl::median_filter or gsl::gaussian_filter,
+///            whose output at each sample depends only on input within
+///            `F::h()` samples and which is applied by `F::operator()(x, y)`.
+template<typename F> class filter_stream {
+  F *f_; ///< Filter.
+  std::vector<double> in_; ///< Retained input.
+  std::vector<double> out_; ///< Scratch output.
+  size_t base_= 0; ///< Offset in stream of first retained sample.
+  size_t next_= 0; ///< Offset in stream of next output.
+  size_t seen_= 0; ///< Number of samples received.
+
+  /// Emit output for each sample up to (but not including) offset `ready`.
+  /// \tparam N  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for output.
+  /// @param ready  Offset in stream one past last sample to emit.
+  /// @param y  Output.
+  /// @return  Number of elements written to `y`.
+  template<size_t N, template<typename, size_t> class V>
+  size_t emit(size_t ready, v_iface<double, N, V> &y) {
+    if(ready <= next_) return 0;
+    size_t const k= ready - next_, m= in_.size(), h= f_->h();
+    if(y.size() < k) throw std::invalid_argument("output too short");
+    out_.resize(m);
+    vector_view<double> xv(in_.data(), m), yv(out_.data(), m);
+    if((*f_)(xv, yv) != GSL_SUCCESS) {
+      throw std::runtime_error("filter failed");
+    }
+    for(size_t i= 0; i < k; ++i) y[i]= out_[next_ - base_ + i];
+    next_= ready;
+    if(next_ > base_ + h) {
+      size_t const drop= next_ - h - base_;
+      in_.erase(in_.begin(), in_.begin() + drop);
+      base_+= drop;
+    }
+    return k;
+  }
+
+public:
+  /// Initialize stream.
+  /// @param f  Filter, which must outlive stream.
+  explicit filter_stream(F &f): f_(&f) {}
+
+  /// Discard every sample, so that next chunk begins new stream.
+  void reset() {
+    in_.clear();
+    base_= next_= seen_= 0;
+  }
+
+  /// Number of samples received but not yet emitted.
+  /// @return  Number of samples pending.
+  size_t pending() const { return seen_ - next_; }
+
+  /// Add chunk of input, and emit every output that is ready.
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Chunk of input.
+  /// @param y  Output, whose size must be at least that of `x`.
+  /// @return  Number of elements written to beginning of `y`.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  size_t push(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) {
+    size_t const m= x.size(), h= f_->h();
+    for(size_t i= 0; i < m; ++i) in_.push_back(double(x[i]));
+    seen_+= m;
+    return emit(seen_ > h ? seen_ - h : 0, y);
+  }
+
+  /// Emit output for every pending sample, treating last sample received as
+  /// end of input, and then reset().
+  /// \tparam N  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for output.
+  /// @param y  Output, whose size must be at least pending().
+  /// @return  Number of elements written to beginning of `y`.
+  template<size_t N, template<typename, size_t> class V>
+  size_t finish(v_iface<double, N, V> &y) {
+    size_t const k= emit(seen_, y);
+    reset();
+    return k;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
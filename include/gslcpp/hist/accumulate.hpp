@@ -0,0 +1,51 @@
+/// \file       include/gslcpp/hist/accumulate.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::hist_accumulate().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "bin-index.hpp" // hist_grain
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Accumulate values into bins, in parallel, through private bins.
+///
+/// If there be more than gsl::hist_grain values, then each worker of `p`
+/// accumulates its chunks into its own private copy of the bins, so that no
+/// two threads write the same memory, and the private copies are added to
+/// `bin` in order of worker at the end.  A count is a sum of whole numbers
+/// and so is exact regardless of the number of threads; a sum of fractional
+/// weights may differ in the last bit from that of a serial accumulation.
+///
+/// \tparam F  Type of function `add(b, e, bin)` that add values at offsets
+///            `[b, e)` into bins at `bin`.
+/// @param bin  Pointer to first bin.
+/// @param nb  Number of bins.
+/// @param n  Number of values.
+/// @param add  Function that add chunk of values into bins.
+/// @param p  Pool over which to distribute chunks.
+template<typename F>
+void hist_accumulate(
+      double *bin, size_t nb, size_t n, F const &add, thread_pool &p) {
+  if(n <= hist_grain || p.size() == 1) {
+    add(0, n, bin);
+    return;
+  }
+  unsigned const workers= p.size();
+  std::vector<double> priv(workers * nb, 0.0);
+  p.for_chunks(n, hist_grain, [&](size_t b, size_t e, unsigned w) {
+    add(b, e, priv.data() + w * nb);
+  });
+  for(unsigned w= 0; w < workers; ++w) {
+    double const *const q= priv.data() + w * nb;
+    for(size_t i= 0; i < nb; ++i) bin[i]+= q[i];
+  }
+}
+
+
+} // namespace gsl
+
+// EOF
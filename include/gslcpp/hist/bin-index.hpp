@@ -0,0 +1,82 @@
+/// \dir        include/gslcpp/hist
+/// \brief      Types and functions specific to histograms.
+
+/// \file       include/gslcpp/hist/bin-index.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::bin_index and gsl::hist_grain.
+
+#pragma once
+
+#include <cmath> // abs
+#include <cstddef> // size_t
+
+namespace gsl {
+
+
+/// Number of values binned in each chunk by parallel accumulation of
+/// histogram.
+constexpr size_t hist_grain= size_t(1) << 16;
+
+
+/// Lookup of bin that contains value, for ranges like those of GSL's
+/// histogram, in which bin `i` covers `[r[i], r[i+1])`.
+///
+/// When the ranges are uniform (within a quarter of a bin), the offset of the
+/// bin is computed directly from the value, and a correction of at most one
+/// bin, in either direction, absorbs rounding.  Otherwise, the bin is found
+/// by a binary search whose number of iterations depends only on the number
+/// of bins, and whose every step is a conditional move rather than a branch.
+/// In either case, the result agrees with `gsl_histogram_find()`.
+///
+/// The ranges are referred to, not copied, and so must outlive the lookup.
+class bin_index {
+  double const *r_; ///< Pointer to `n_ + 1` ranges.
+  size_t n_; ///< Number of bins.
+  double lo_; ///< Lower limit of first bin.
+  double hi_; ///< Upper limit of last bin.
+  double scale_; ///< Number of bins per unit of value.
+  bool uniform_; ///< True only if ranges be uniform.
+
+public:
+  /// Initialize lookup, and determine whether ranges be uniform.
+  /// @param r  Pointer to `n + 1` strictly increasing ranges.
+  /// @param n  Number of bins, at least one.
+  bin_index(double const *r, size_t n):
+      r_(r), n_(n), lo_(r[0]), hi_(r[n]), scale_(n / (r[n] - r[0])) {
+    double const w= (hi_ - lo_) / n;
+    uniform_= true;
+    for(size_t i= 1; i < n; ++i) {
+      uniform_&= (std::abs(r[i] - (lo_ + i * w)) <= 0.25 * w);
+    }
+  }
+
+  /// True only if bin be computed directly.
+  /// @return  True only if ranges be uniform.
+  bool uniform() const { return uniform_; }
+
+  /// Offset of bin that contain value.
+  /// @param x  Value.
+  /// @return  Offset of bin, or number of bins if `x` be out of range or NaN.
+  size_t operator()(double x) const {
+    if(!(x >= lo_ && x < hi_)) return n_;
+    if(uniform_) {
+      size_t i= size_t((x - lo_) * scale_);
+      i= (i < n_ ? i : n_ - 1);
+      i-= (x < r_[i]);
+      i+= (x >= r_[i + 1]);
+      return i;
+    }
+    size_t b= 0, m= n_;
+    while(m > 1) {
+      size_t const h= m / 2;
+      b= (r_[b + h] <= x ? b + h : b);
+      m-= h;
+    }
+    return b;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
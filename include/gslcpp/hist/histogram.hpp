@@ -0,0 +1,226 @@
+/// \file       include/gslcpp/hist/histogram.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::histogram.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "accumulate.hpp" // hist_accumulate, thread_pool
+#include "bin-index.hpp" // bin_index
+#include <gsl/gsl_histogram.h> // gsl_histogram, etc.
+#include <stdexcept> // invalid_argument
+
+namespace gsl {
+
+
+/// One-dimensional histogram, owning GSL's histogram.
+/// https://www.gnu.org/software/gsl/doc/html/histogram.html
+///
+/// Values are binned natively rather than by `gsl_histogram_increment()`.
+/// Each lookup is done by gsl::bin_index, which is constant-time for uniform
+/// ranges, and a whole gsl::v_iface of values is binned at once, in parallel
+/// by gsl::hist_accumulate().  As in GSL, a value out of range is ignored.
+///
+/// GSL's own functions (for statistics of the histogram, for the PDF, etc.)
+/// may be applied to h().
+class histogram {
+  gsl_histogram *h_; ///< GSL's histogram.
+  bin_index find_; ///< Lookup of bin.
+
+  histogram(histogram const &)= delete; ///< Disable copying.
+  histogram &operator=(histogram const &)= delete; ///< Disable copying.
+
+  /// Allocate GSL's histogram with uniform ranges.
+  /// @param n  Number of bins.
+  /// @param lo  Lower limit of first bin.
+  /// @param hi  Upper limit of last bin.
+  /// @return  Pointer to GSL's histogram.
+  static gsl_histogram *alloc(size_t n, double lo, double hi) {
+    gsl_histogram *const h= gsl_histogram_alloc(n);
+    gsl_histogram_set_ranges_uniform(h, lo, hi);
+    return h;
+  }
+
+  /// Allocate GSL's histogram with arbitrary ranges.
+  /// \tparam T  Type of element in vector of ranges.
+  /// \tparam N  Compile-time number of ranges.
+  /// \tparam V  Type of interface to storage of ranges.
+  /// @param r  Ranges.
+  /// @return  Pointer to GSL's histogram.
+  template<typename T, size_t N, template<typename, size_t> class V>
+  static gsl_histogram *alloc(v_iface<T, N, V> const &r) {
+    if(r.size() < 2) throw std::invalid_argument("too few ranges");
+    gsl_histogram *const h= gsl_histogram_alloc(r.size() - 1);
+    for(size_t i= 0; i < r.size(); ++i) h->range[i]= double(r[i]);
+    gsl_histogram_reset(h);
+    return h;
+  }
+
+public:
+  /// Allocate histogram with uniform ranges.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_set_ranges_uniform
+  /// @param n  Number of bins.
+  /// @param lo  Lower limit of first bin.
+  /// @param hi  Upper limit of last bin.
+  histogram(size_t n, double lo, double hi):
+      h_(alloc(n, lo, hi)), find_(h_->range, n) {}
+
+  /// Allocate histogram with arbitrary ranges.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_set_ranges
+  /// \tparam T  Type of element in vector of ranges.
+  /// \tparam N  Compile-time number of ranges.
+  /// \tparam V  Type of interface to storage of ranges.
+  /// @param r  Strictly increasing ranges, one more than number of bins.
+  template<typename T, size_t N, template<typename, size_t> class V>
+  explicit histogram(v_iface<T, N, V> const &r):
+      h_(alloc(r)), find_(h_->range, h_->n) {}
+
+  /// Move on construction.
+  /// @param src  Histogram to move.
+  histogram(histogram &&src): h_(src.h_), find_(src.find_) {
+    src.h_= nullptr;
+  }
+
+  /// Deallocate histogram.
+  ~histogram() {
+    if(h_) gsl_histogram_free(h_);
+  }
+
+  /// Pointer to GSL's histogram.
+  /// @return  Pointer to GSL's histogram.
+  gsl_histogram *h() const { return h_; }
+
+  /// Number of bins.
+  /// @return  Number of bins.
+  size_t size() const { return h_->n; }
+
+  /// True only if bin be computed directly from value.
+  /// @return  True only if ranges be uniform.
+  bool uniform() const { return find_.uniform(); }
+
+  /// View of ranges, one more than number of bins.
+  /// @return  View of ranges.
+  v_iface<double const, 0, v_view> ranges() const {
+    return w_vector_view_array((double const *)h_->range, 1, h_->n + 1);
+  }
+
+  /// View of bins.
+  /// @return  View of bins.
+  v_iface<double, 0, v_view> bins() {
+    return w_vector_view_array(h_->bin, 1, h_->n);
+  }
+
+  /// View of immutable bins.
+  /// @return  View of bins.
+  v_iface<double const, 0, v_view> bins() const {
+    return w_vector_view_array((double const *)h_->bin, 1, h_->n);
+  }
+
+  /// Content of bin.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_get
+  /// @param i  Offset of bin.
+  /// @return  Content of bin.
+  double operator[](size_t i) const { return h_->bin[i]; }
+
+  /// Offset of bin that contain value.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_find
+  /// @param x  Value.
+  /// @return  Offset of bin, or size() if `x` be out of range.
+  size_t find(double x) const { return find_(x); }
+
+  /// Zero every bin.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_reset
+  void reset() { gsl_histogram_reset(h_); }
+
+  /// Add one to bin that contain value.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_increment
+  /// @param x  Value.
+  /// @return  True only if `x` be in range.
+  bool increment(double x) { return accumulate(x, 1.0); }
+
+  /// Add weight to bin that contain value.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_accumulate
+  /// @param x  Value.
+  /// @param w  Weight.
+  /// @return  True only if `x` be in range.
+  bool accumulate(double x, double w) {
+    size_t const i= find_(x);
+    if(i == h_->n) return false;
+    h_->bin[i]+= w;
+    return true;
+  }
+
+  /// Add one to bin of each element of vector.
+  /// \tparam T  Type of element in vector.
+  /// \tparam N  Compile-time number of elements.
+  /// \tparam V  Type of interface to storage.
+  /// @param v  Values.
+  /// @param p  Pool over which to distribute chunks.
+  template<typename T, size_t N, template<typename, size_t> class V>
+  void increment(
+        v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+    size_t const nb= h_->n, s= v.v()->stride;
+    auto const *const x= v.data();
+    bin_index const find= find_;
+    auto const add= [&](size_t b, size_t e, double *bin) {
+      for(size_t i= b; i < e; ++i) {
+        size_t const k= find(double(x[i * s]));
+        if(k < nb) bin[k]+= 1.0;
+      }
+    };
+    hist_accumulate(h_->bin, nb, v.size(), add, p);
+  }
+
+  /// Add weight to bin of each element of vector.
+  /// \tparam T  Type of element in vector of values.
+  /// \tparam N  Compile-time number of values.
+  /// \tparam V  Type of interface to storage of values.
+  /// \tparam U  Type of element in vector of weights.
+  /// \tparam M  Compile-time number of weights.
+  /// \tparam W  Type of interface to storage of weights.
+  /// @param v  Values.
+  /// @param w  Weights, one per value.
+  /// @param p  Pool over which to distribute chunks.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  void accumulate(
+        v_iface<T, N, V> const &v,
+        v_iface<U, M, W> const &w,
+        thread_pool &p= thread_pool::global()) {
+    if(v.size() != w.size()) throw std::invalid_argument("mismatch in size");
+    size_t const nb= h_->n, s= v.v()->stride, sw= w.v()->stride;
+    auto const *const x= v.data();
+    auto const *const y= w.data();
+    bin_index const find= find_;
+    auto const add= [&](size_t b, size_t e, double *bin) {
+      for(size_t i= b; i < e; ++i) {
+        size_t const k= find(double(x[i * s]));
+        if(k < nb) bin[k]+= double(y[i * sw]);
+      }
+    };
+    hist_accumulate(h_->bin, nb, v.size(), add, p);
+  }
+
+  /// Add bins of other histogram with identical ranges.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram_add
+  /// @param o  Other histogram.
+  /// @return  Reference to this instance.
+  histogram &operator+=(histogram const &o) {
+    if(o.h_->n != h_->n) throw std::invalid_argument("mismatch in size");
+    for(size_t i= 0; i < h_->n; ++i) h_->bin[i]+= o.h_->bin[i];
+    return *this;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,212 @@
+/// \file       include/gslcpp/hist/histogram2d.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::histogram2d.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include "accumulate.hpp" // hist_accumulate, thread_pool
+#include "bin-index.hpp" // bin_index
+#include <gsl/gsl_histogram2d.h> // gsl_histogram2d, etc.
+#include <stdexcept> // invalid_argument
+
+namespace gsl {
+
+
+/// Two-dimensional histogram, owning GSL's histogram.
+/// https://www.gnu.org/software/gsl/doc/html/histogram.html#two-dimensional-histograms
+///
+/// Pairs of values are binned natively, as by gsl::histogram, with a
+/// gsl::bin_index along each axis.  A pair of which either value is out of
+/// range is ignored.
+class histogram2d {
+  gsl_histogram2d *h_; ///< GSL's histogram.
+  bin_index fx_; ///< Lookup of bin along x.
+  bin_index fy_; ///< Lookup of bin along y.
+
+  histogram2d(histogram2d const &)= delete; ///< Disable copying.
+  histogram2d &operator=(histogram2d const &)= delete; ///< Disable copying.
+
+  /// Allocate GSL's histogram with uniform ranges.
+  /// @param nx  Number of bins along x.
+  /// @param xlo  Lower limit of first bin along x.
+  /// @param xhi  Upper limit of last bin along x.
+  /// @param ny  Number of bins along y.
+  /// @param ylo  Lower limit of first bin along y.
+  /// @param yhi  Upper limit of last bin along y.
+  /// @return  Pointer to GSL's histogram.
+  static gsl_histogram2d *alloc(
+        size_t nx, double xlo, double xhi, size_t ny, double ylo, double yhi) {
+    gsl_histogram2d *const h= gsl_histogram2d_alloc(nx, ny);
+    gsl_histogram2d_set_ranges_uniform(h, xlo, xhi, ylo, yhi);
+    return h;
+  }
+
+  /// Add values from pair of vectors, with weight for each pair.
+  /// \tparam T  Type of element in vector of x-values.
+  /// \tparam U  Type of element in vector of y-values.
+  /// \tparam G  Type of function `g(i)` that return weight of pair `i`.
+  /// @param x  Pointer to first x-value.
+  /// @param sx  Stride of x-values.
+  /// @param y  Pointer to first y-value.
+  /// @param sy  Stride of y-values.
+  /// @param n  Number of pairs.
+  /// @param g  Weight of each pair.
+  /// @param p  Pool over which to distribute chunks.
+  template<typename T, typename U, typename G>
+  void add(
+        T const *x,
+        size_t sx,
+        U const *y,
+        size_t sy,
+        size_t n,
+        G const &g,
+        thread_pool &p) {
+    size_t const nx= h_->nx, ny= h_->ny;
+    bin_index const fx= fx_, fy= fy_;
+    auto const add= [&](size_t b, size_t e, double *bin) {
+      for(size_t i= b; i < e; ++i) {
+        size_t const ix= fx(double(x[i * sx])), iy= fy(double(y[i * sy]));
+        if(ix < nx && iy < ny) bin[ix * ny + iy]+= g(i);
+      }
+    };
+    hist_accumulate(h_->bin, nx * ny, n, add, p);
+  }
+
+public:
+  /// Allocate histogram with uniform ranges.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram2d_set_ranges_uniform
+  /// @param nx  Number of bins along x.
+  /// @param xlo  Lower limit of first bin along x.
+  /// @param xhi  Upper limit of last bin along x.
+  /// @param ny  Number of bins along y.
+  /// @param ylo  Lower limit of first bin along y.
+  /// @param yhi  Upper limit of last bin along y.
+  histogram2d(
+        size_t nx, double xlo, double xhi, size_t ny, double ylo, double yhi):
+      h_(alloc(nx, xlo, xhi, ny, ylo, yhi)),
+      fx_(h_->xrange, nx),
+      fy_(h_->yrange, ny) {}
+
+  /// Move on construction.
+  /// @param src  Histogram to move.
+  histogram2d(histogram2d &&src): h_(src.h_), fx_(src.fx_), fy_(src.fy_) {
+    src.h_= nullptr;
+  }
+
+  /// Deallocate histogram.
+  ~histogram2d() {
+    if(h_) gsl_histogram2d_free(h_);
+  }
+
+  /// Pointer to GSL's histogram.
+  /// @return  Pointer to GSL's histogram.
+  gsl_histogram2d *h() const { return h_; }
+
+  /// Number of bins along x.
+  /// @return  Number of bins along x.
+  size_t nx() const { return h_->nx; }
+
+  /// Number of bins along y.
+  /// @return  Number of bins along y.
+  size_t ny() const { return h_->ny; }
+
+  /// Content of bin.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram2d_get
+  /// @param i  Offset of bin along x.
+  /// @param j  Offset of bin along y.
+  /// @return  Content of bin.
+  double operator()(size_t i, size_t j) const {
+    return h_->bin[i * h_->ny + j];
+  }
+
+  /// Zero every bin.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram2d_reset
+  void reset() { gsl_histogram2d_reset(h_); }
+
+  /// Add one to bin that contain pair of values.
+  /// https://www.gnu.org/software/gsl/doc/html/histogram.html#c.gsl_histogram2d_increment
+  /// @param x  Value along x.
+  /// @param y  Value along y.
+  /// @return  True only if pair be in range.
+  bool increment(double x, double y) {
+    size_t const i= fx_(x), j= fy_(y);
+    if(i == h_->nx || j == h_->ny) return false;
+    h_->bin[i * h_->ny + j]+= 1.0;
+    return true;
+  }
+
+  /// Add one to bin of each pair of corresponding elements.
+  /// \tparam T  Type of element in vector of x-values.
+  /// \tparam N  Compile-time number of x-values.
+  /// \tparam V  Type of interface to storage of x-values.
+  /// \tparam U  Type of element in vector of y-values.
+  /// \tparam M  Compile-time number of y-values.
+  /// \tparam W  Type of interface to storage of y-values.
+  /// @param x  Values along x.
+  /// @param y  Values along y, one per value along x.
+  /// @param p  Pool over which to distribute chunks.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  void increment(
+        v_iface<T, N, V> const &x,
+        v_iface<U, M, W> const &y,
+        thread_pool &p= thread_pool::global()) {
+    if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+    auto const one= [](size_t) { return 1.0; };
+    add(x.data(), x.v()->stride, y.data(), y.v()->stride, x.size(), one, p);
+  }
+
+  /// Add weight to bin of each pair of corresponding elements.
+  /// \tparam T  Type of element in vector of x-values.
+  /// \tparam N  Compile-time number of x-values.
+  /// \tparam V  Type of interface to storage of x-values.
+  /// \tparam U  Type of element in vector of y-values.
+  /// \tparam M  Compile-time number of y-values.
+  /// \tparam W  Type of interface to storage of y-values.
+  /// \tparam R  Type of element in vector of weights.
+  /// \tparam L  Compile-time number of weights.
+  /// \tparam Q  Type of interface to storage of weights.
+  /// @param x  Values along x.
+  /// @param y  Values along y, one per value along x.
+  /// @param w  Weights, one per value along x.
+  /// @param p  Pool over which to distribute chunks.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W,
+        typename R,
+        size_t L,
+        template<typename, size_t>
+        class Q>
+  void accumulate(
+        v_iface<T, N, V> const &x,
+        v_iface<U, M, W> const &y,
+        v_iface<R, L, Q> const &w,
+        thread_pool &p= thread_pool::global()) {
+    if(x.size() != y.size() || x.size() != w.size()) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    auto const *const d= w.data();
+    size_t const s= w.v()->stride;
+    auto const g= [d, s](size_t i) { return double(d[i * s]); };
+    add(x.data(), x.v()->stride, y.data(), y.v()->stride, x.size(), g, p);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
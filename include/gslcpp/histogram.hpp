@@ -0,0 +1,10 @@
+/// \file       include/gslcpp/histogram.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for histograms.
+
+#pragma once
+
+#include "hist/histogram.hpp" // histogram
+#include "hist/histogram2d.hpp" // histogram2d
+
+// EOF
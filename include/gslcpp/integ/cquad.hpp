@@ -0,0 +1,39 @@
+/// \file       include/gslcpp/integ/cquad.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::cquad().
+
+#pragma once
+
+#include "function.hpp" // make_function, quad_result
+#include "workspace-pool.hpp" // acquire
+
+namespace gsl {
+
+
+/// Doubly adaptive integration of `f` over `[a, b]`, robust for integrands
+/// with singularities or with non-finite values at some points.
+/// The workspace is leased from the current thread's gsl::workspace_pool.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_cquad
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param a  Lower limit of integration.
+/// @param b  Upper limit of integration.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @param n  Maximum number of intervals in workspace (at least 3).
+/// @return  Status, estimate, error, and number of evaluations.
+template<typename F>
+quad_result
+cquad(F &&f, double a, double b, double epsabs, double epsrel, size_t n= 100) {
+  gsl_function const gf= make_function(f);
+  auto const w= acquire<gsl_integration_cquad_workspace>(n);
+  quad_result r{};
+  r.status= gsl_integration_cquad(
+        &gf, a, b, epsabs, epsrel, w.get(), &r.value, &r.abserr, &r.neval);
+  return r;
+}
+
+
+} // namespace gsl
+
+// EOF
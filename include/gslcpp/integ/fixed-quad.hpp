@@ -0,0 +1,247 @@
+/// \file       include/gslcpp/integ/fixed-quad.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::fixed_quad.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include <algorithm> // max, min
+#include <cmath> // abs
+#include <gsl/gsl_integration.h> // gsl_integration_fixed_workspace, etc.
+#include <stdexcept> // invalid_argument
+
+namespace gsl {
+
+
+/// Fixed-order quadrature over a family of integrands `f(x, p)`, evaluated
+/// for every parameter `p` in a vector.
+///
+/// Nodes and weights are computed once, on construction, by
+/// `gsl_integration_fixed_alloc()`.  Gauss-Legendre is the default rule, but
+/// any of GSL's fixed rules (Chebyshev, Laguerre, Hermite, etc.) may be
+/// selected.
+///
+/// For a vector of parameters, the parameters are processed in blocks.
+/// Within each block, the loop over nodes is outermost, and the loop over
+/// parameters is innermost and unit-stride, so that the compiler can
+/// vectorize evaluation of an inlined `f` across parameters.  Blocks are
+/// distributed over a gsl::thread_pool.
+///
+/// Optionally, an estimate of the absolute error is produced as the difference
+/// from a second rule of the same type with about half as many nodes.  This
+/// estimate is conservative, because it is really the error of the
+/// lower-order rule.  With a single node, there is no lower-order rule, and
+/// so an estimate of error requires at least two nodes.
+class fixed_quad {
+  gsl_integration_fixed_workspace *hi_; ///< Rule of requested order.
+  gsl_integration_fixed_workspace *lo_; ///< Rule for estimate of error.
+
+  /// Number of parameters in each block.
+  enum { BLOCK= 64 };
+
+  fixed_quad(fixed_quad const &)= delete; ///< Disable copying.
+  fixed_quad &operator=(fixed_quad const &)= delete; ///< Disable copying.
+
+  /// Apply rule `w` to block of parameters.
+  /// \tparam F  Type of callable with signature `double(double, double)`.
+  /// @param w  Rule.
+  /// @param f  Integrand.
+  /// @param p  Contiguous parameters.
+  /// @param n  Number of parameters (at most BLOCK).
+  /// @param r  On return, contains integral for each parameter.
+  template<typename F>
+  static void apply(
+        gsl_integration_fixed_workspace const *w,
+        F &f,
+        double const *p,
+        size_t n,
+        double *r) {
+    double const *const x= gsl_integration_fixed_nodes(w);
+    double const *const wt= gsl_integration_fixed_weights(w);
+    size_t const m= gsl_integration_fixed_n(w);
+    for(size_t j= 0; j < n; ++j) r[j]= 0.0;
+    for(size_t k= 0; k < m; ++k) {
+      double const xk= x[k], wk= wt[k];
+      for(size_t j= 0; j < n; ++j) r[j]+= wk * f(xk, p[j]);
+    }
+  }
+
+  /// Integrate for every parameter, optionally estimating error.
+  /// \tparam F  Type of callable with signature `double(double, double)`.
+  /// \tparam TP  Type of element in `p` (`double` or `double const`).
+  /// \tparam NP  Compile-time number of elements in `p`.
+  /// \tparam NR  Compile-time number of elements in `r`.
+  /// \tparam NE  Compile-time number of elements in `e`.
+  /// \tparam VP  Type of interface to storage for `p`.
+  /// \tparam VR  Type of interface to storage for `r`.
+  /// \tparam VE  Type of interface to storage for `e`.
+  /// @param f  Integrand.
+  /// @param p  Parameters.
+  /// @param r  On return, integral for each parameter.
+  /// @param e  If not null, on return, estimated error for each parameter.
+  /// @param pool  Pool over which to distribute blocks.
+  template<
+        typename F,
+        typename TP,
+        size_t NP,
+        size_t NR,
+        size_t NE,
+        template<typename, size_t>
+        class VP,
+        template<typename, size_t>
+        class VR,
+        template<typename, size_t>
+        class VE>
+  void batch(
+        F &f,
+        v_iface<TP, NP, VP> const &p,
+        v_iface<double, NR, VR> &r,
+        v_iface<double, NE, VE> *e,
+        thread_pool &pool) const {
+    size_t const n= p.size();
+    if(r.size() != n || (e && e->size() != n)) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    if(e && size() < 2) throw std::invalid_argument("fewer than two nodes");
+    pool.for_chunks(n, BLOCK, [&](size_t b, size_t end, unsigned) {
+      double pb[BLOCK], rb[BLOCK], lb[BLOCK];
+      size_t const m= end - b;
+      for(size_t j= 0; j < m; ++j) pb[j]= p[b + j];
+      apply(hi_, f, pb, m, rb);
+      for(size_t j= 0; j < m; ++j) r[b + j]= rb[j];
+      if(!e) return;
+      apply(lo_, f, pb, m, lb);
+      for(size_t j= 0; j < m; ++j) (*e)[b + j]= std::abs(rb[j] - lb[j]);
+    });
+  }
+
+public:
+  /// Type of fixed rule.
+  using type= gsl_integration_fixed_type;
+
+  /// Compute nodes and weights.
+  /// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_fixed_alloc
+  /// @param n  Number of nodes.
+  /// @param a  First parameter of interval (lower limit for Legendre).
+  /// @param b  Second parameter of interval (upper limit for Legendre).
+  /// @param t  Type of rule.
+  /// @param alpha  Parameter `alpha` of weighting function, if any.
+  /// @param beta  Parameter `beta` of weighting function, if any.
+  fixed_quad(
+        size_t n,
+        double a,
+        double b,
+        type const *t= gsl_integration_fixed_legendre,
+        double alpha= 0.0,
+        double beta= 0.0):
+      hi_(gsl_integration_fixed_alloc(t, n, a, b, alpha, beta)),
+      lo_(gsl_integration_fixed_alloc(
+            t, std::max(n / 2, size_t(1)), a, b, alpha, beta)) {}
+
+  /// Deallocate nodes and weights.
+  ~fixed_quad() {
+    gsl_integration_fixed_free(lo_);
+    gsl_integration_fixed_free(hi_);
+  }
+
+  /// Number of nodes.
+  /// @return  Number of nodes.
+  size_t size() const { return gsl_integration_fixed_n(hi_); }
+
+  /// View of nodes.
+  /// @return  View of nodes.
+  v_iface<double const, 0, v_view> nodes() const {
+    return w_vector_view_array(
+          (double const *)gsl_integration_fixed_nodes(hi_), 1, size());
+  }
+
+  /// View of weights.
+  /// @return  View of weights.
+  v_iface<double const, 0, v_view> weights() const {
+    return w_vector_view_array(
+          (double const *)gsl_integration_fixed_weights(hi_), 1, size());
+  }
+
+  /// Integrate single integrand.
+  /// \tparam F  Type of callable with signature `double(double)`.
+  /// @param f  Integrand.
+  /// @return  Estimate of integral.
+  template<typename F> double operator()(F &&f) const {
+    double const *const x= gsl_integration_fixed_nodes(hi_);
+    double const *const wt= gsl_integration_fixed_weights(hi_);
+    double s= 0.0;
+    for(size_t k= 0, m= size(); k < m; ++k) s+= wt[k] * f(x[k]);
+    return s;
+  }
+
+  /// Integrate `f(x, p[i])` for every parameter `p[i]`.
+  /// \tparam F  Type of callable with signature `double(double, double)`.
+  /// \tparam TP  Type of element in `p` (`double` or `double const`).
+  /// \tparam NP  Compile-time number of elements in `p`.
+  /// \tparam NR  Compile-time number of elements in `r`.
+  /// \tparam VP  Type of interface to storage for `p`.
+  /// \tparam VR  Type of interface to storage for `r`.
+  /// @param f  Integrand, called concurrently from several threads.
+  /// @param p  Parameters.
+  /// @param r  On return, integral for each parameter.
+  /// @param pool  Pool over which to distribute blocks of parameters.
+  template<
+        typename F,
+        typename TP,
+        size_t NP,
+        size_t NR,
+        template<typename, size_t>
+        class VP,
+        template<typename, size_t>
+        class VR>
+  void operator()(
+        F &&f,
+        v_iface<TP, NP, VP> const &p,
+        v_iface<double, NR, VR> &r,
+        thread_pool &pool= thread_pool::global()) const {
+    batch(f, p, r, (v_iface<double, NR, VR> *)nullptr, pool);
+  }
+
+  /// Integrate `f(x, p[i])` for every parameter `p[i]`, and estimate error.
+  /// \tparam F  Type of callable with signature `double(double, double)`.
+  /// \tparam TP  Type of element in `p` (`double` or `double const`).
+  /// \tparam NP  Compile-time number of elements in `p`.
+  /// \tparam NR  Compile-time number of elements in `r`.
+  /// \tparam NE  Compile-time number of elements in `e`.
+  /// \tparam VP  Type of interface to storage for `p`.
+  /// \tparam VR  Type of interface to storage for `r`.
+  /// \tparam VE  Type of interface to storage for `e`.
+  /// @param f  Integrand, called concurrently from several threads.
+  /// @param p  Parameters.
+  /// @param r  On return, integral for each parameter.
+  /// @param e  On return, estimated absolute error for each parameter.
+  ///           Rule must have at least two nodes.
+  /// @param pool  Pool over which to distribute blocks of parameters.
+  template<
+        typename F,
+        typename TP,
+        size_t NP,
+        size_t NR,
+        size_t NE,
+        template<typename, size_t>
+        class VP,
+        template<typename, size_t>
+        class VR,
+        template<typename, size_t>
+        class VE>
+  void operator()(
+        F &&f,
+        v_iface<TP, NP, VP> const &p,
+        v_iface<double, NR, VR> &r,
+        v_iface<double, NE, VE> &e,
+        thread_pool &pool= thread_pool::global()) const {
+    batch(f, p, r, &e, pool);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,59 @@
+/// \dir        include/gslcpp/integ
+/// \brief      Types and functions specific to numerical integration.
+
+/// \file       include/gslcpp/integ/function.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::integrand and gsl::quad_result.
+
+#pragma once
+
+#include <gsl/gsl_math.h> // gsl_function
+#include <type_traits> // remove_reference_t
+
+namespace gsl {
+
+
+/// Outcome of numerical integration.
+struct quad_result {
+  int status; ///< Zero only on success.
+  double value; ///< Estimate of integral.
+  double abserr; ///< Estimate of absolute error.
+  size_t neval; ///< Number of evaluations of integrand, when known.
+};
+
+
+/// Trampoline from GSL's gsl_function to instance of `F`.
+///
+/// Because `F` is a template-parameter, the call from the trampoline into the
+/// integrand is direct and may be inlined.  The only indirect call is GSL's
+/// own call into the trampoline.
+///
+/// \tparam F  Type of callable with signature `double(double)`.
+template<typename F> struct integrand {
+  /// Evaluate integrand.
+  /// @param x  Abscissa.
+  /// @param p  Pointer to instance of `F`.
+  /// @return  Value of integrand at `x`.
+  static double call(double x, void *p) { return (*static_cast<F *>(p))(x); }
+
+  /// GSL's descriptor for integrand.
+  /// @param f  Reference to integrand, which must outlive descriptor.
+  /// @return  GSL's descriptor for integrand.
+  static gsl_function function(F &f) {
+    return {&integrand::call, const_cast<void *>(static_cast<void const *>(&f))};
+  }
+};
+
+
+/// GSL's descriptor for integrand `f`.
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Reference to integrand, which must outlive descriptor.
+/// @return  GSL's descriptor for integrand.
+template<typename F> gsl_function make_function(F &f) {
+  return integrand<F>::function(f);
+}
+
+
+} // namespace gsl
+
+// EOF
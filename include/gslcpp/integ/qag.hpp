@@ -0,0 +1,158 @@
+/// \file       include/gslcpp/integ/qag.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::qng(), gsl::qag(), gsl::qags(), gsl::qagi(),
+///             gsl::qagiu(), and gsl::qagil().
+
+#pragma once
+
+#include "function.hpp" // make_function, quad_result
+#include "workspace-pool.hpp" // acquire
+
+namespace gsl {
+
+
+/// Non-adaptive Gauss-Kronrod integration of `f` over `[a, b]`.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_qng
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param a  Lower limit of integration.
+/// @param b  Upper limit of integration.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @return  Status, estimate, error, and number of evaluations.
+template<typename F>
+quad_result qng(F &&f, double a, double b, double epsabs, double epsrel) {
+  gsl_function const gf= make_function(f);
+  quad_result r{};
+  r.status= gsl_integration_qng(
+        &gf, a, b, epsabs, epsrel, &r.value, &r.abserr, &r.neval);
+  return r;
+}
+
+
+/// Adaptive Gauss-Kronrod integration of `f` over `[a, b]`.
+/// The workspace is leased from the current thread's gsl::workspace_pool.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_qag
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param a  Lower limit of integration.
+/// @param b  Upper limit of integration.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @param key  Rule (GSL_INTEG_GAUSS15, ..., GSL_INTEG_GAUSS61).
+/// @param limit  Maximum number of subintervals.
+/// @return  Status, estimate, and error.
+template<typename F>
+quad_result qag(
+      F &&f,
+      double a,
+      double b,
+      double epsabs,
+      double epsrel,
+      int key= GSL_INTEG_GAUSS21,
+      size_t limit= 1000) {
+  gsl_function const gf= make_function(f);
+  auto const w= acquire<gsl_integration_workspace>(limit);
+  quad_result r{};
+  r.status= gsl_integration_qag(
+        &gf, a, b, epsabs, epsrel, limit, key, w.get(), &r.value, &r.abserr);
+  return r;
+}
+
+
+/// Adaptive integration of `f` over `[a, b]` with extrapolation, suitable for
+/// integrable singularities.
+/// The workspace is leased from the current thread's gsl::workspace_pool.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_qags
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param a  Lower limit of integration.
+/// @param b  Upper limit of integration.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @param limit  Maximum number of subintervals.
+/// @return  Status, estimate, and error.
+template<typename F>
+quad_result qags(
+      F &&f,
+      double a,
+      double b,
+      double epsabs,
+      double epsrel,
+      size_t limit= 1000) {
+  gsl_function const gf= make_function(f);
+  auto const w= acquire<gsl_integration_workspace>(limit);
+  quad_result r{};
+  r.status= gsl_integration_qags(
+        &gf, a, b, epsabs, epsrel, limit, w.get(), &r.value, &r.abserr);
+  return r;
+}
+
+
+/// Adaptive integration of `f` over `(-inf, +inf)`.
+/// The workspace is leased from the current thread's gsl::workspace_pool.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_qagi
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @param limit  Maximum number of subintervals.
+/// @return  Status, estimate, and error.
+template<typename F>
+quad_result qagi(F &&f, double epsabs, double epsrel, size_t limit= 1000) {
+  gsl_function gf= make_function(f);
+  auto const w= acquire<gsl_integration_workspace>(limit);
+  quad_result r{};
+  r.status= gsl_integration_qagi(
+        &gf, epsabs, epsrel, limit, w.get(), &r.value, &r.abserr);
+  return r;
+}
+
+
+/// Adaptive integration of `f` over `[a, +inf)`.
+/// The workspace is leased from the current thread's gsl::workspace_pool.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_qagiu
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param a  Lower limit of integration.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @param limit  Maximum number of subintervals.
+/// @return  Status, estimate, and error.
+template<typename F>
+quad_result
+qagiu(F &&f, double a, double epsabs, double epsrel, size_t limit= 1000) {
+  gsl_function gf= make_function(f);
+  auto const w= acquire<gsl_integration_workspace>(limit);
+  quad_result r{};
+  r.status= gsl_integration_qagiu(
+        &gf, a, epsabs, epsrel, limit, w.get(), &r.value, &r.abserr);
+  return r;
+}
+
+
+/// Adaptive integration of `f` over `(-inf, b]`.
+/// The workspace is leased from the current thread's gsl::workspace_pool.
+/// https://www.gnu.org/software/gsl/doc/html/integration.html#c.gsl_integration_qagil
+/// \tparam F  Type of callable with signature `double(double)`.
+/// @param f  Integrand.
+/// @param b  Upper limit of integration.
+/// @param epsabs  Absolute tolerance.
+/// @param epsrel  Relative tolerance.
+/// @param limit  Maximum number of subintervals.
+/// @return  Status, estimate, and error.
+template<typename F>
+quad_result
+qagil(F &&f, double b, double epsabs, double epsrel, size_t limit= 1000) {
+  gsl_function gf= make_function(f);
+  auto const w= acquire<gsl_integration_workspace>(limit);
+  quad_result r{};
+  r.status= gsl_integration_qagil(
+        &gf, b, epsabs, epsrel, limit, w.get(), &r.value, &r.abserr);
+  return r;
+}
+
+
+} // namespace gsl
+
+// EOF
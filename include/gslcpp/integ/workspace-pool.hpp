@@ -0,0 +1,151 @@
+/// \file       include/gslcpp/integ/workspace-pool.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::workspace_pool.
+
+#pragma once
+
+#include <gsl/gsl_integration.h> // gsl_integration_workspace, etc.
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Via specialization, define allocation, deallocation, and capacity for each
+/// type of GSL's workspace held by gsl::workspace_pool.
+/// \tparam W  Type of GSL's workspace.
+template<typename W> struct workspace_traits;
+
+
+/// Specialization for adaptive integration (QAG, QAGS, QAGI, etc.).
+template<> struct workspace_traits<gsl_integration_workspace> {
+  /// Type of GSL's workspace.
+  using W= gsl_integration_workspace;
+
+  /// Allocate workspace.
+  /// @param n  Maximum number of subintervals.
+  /// @return  Pointer to new workspace.
+  static W *alloc(size_t n) { return gsl_integration_workspace_alloc(n); }
+
+  /// Deallocate workspace.
+  /// @param w  Pointer to workspace.
+  static void free(W *w) { gsl_integration_workspace_free(w); }
+
+  /// Capacity of workspace.
+  /// @param w  Pointer to workspace.
+  /// @return  Maximum number of subintervals.
+  static size_t size(W const *w) { return w->limit; }
+};
+
+
+/// Specialization for doubly adaptive integration (CQUAD).
+template<> struct workspace_traits<gsl_integration_cquad_workspace> {
+  /// Type of GSL's workspace.
+  using W= gsl_integration_cquad_workspace;
+
+  /// Allocate workspace.
+  /// @param n  Maximum number of intervals.
+  /// @return  Pointer to new workspace.
+  static W *alloc(size_t n) { return gsl_integration_cquad_workspace_alloc(n); }
+
+  /// Deallocate workspace.
+  /// @param w  Pointer to workspace.
+  static void free(W *w) { gsl_integration_cquad_workspace_free(w); }
+
+  /// Capacity of workspace.
+  /// @param w  Pointer to workspace.
+  /// @return  Maximum number of intervals.
+  static size_t size(W const *w) { return w->size; }
+};
+
+
+/// Thread-local cache of GSL's workspaces of type `W`.
+///
+/// acquire() returns a lease on a workspace whose capacity is at least what
+/// was requested.  A workspace is allocated only if no idle workspace in the
+/// current thread's pool be large enough.  When the lease is destroyed, the
+/// workspace returns to the pool and is reused by the next call on the same
+/// thread.  A nested call (for example, from an integrand that itself
+/// integrates) simply leases a second workspace.
+///
+/// Every workspace is deallocated when its thread exits.
+///
+/// \tparam W  Type of GSL's workspace.
+template<typename W> class workspace_pool {
+  using traits= workspace_traits<W>; ///< Allocation and capacity for `W`.
+
+  std::vector<W *> idle_; ///< Workspaces not currently leased.
+
+  workspace_pool()= default; ///< Construct only via local().
+  workspace_pool(workspace_pool const &)= delete; ///< Disable copying.
+  workspace_pool &operator=(workspace_pool const &)= delete; ///< No copying.
+
+public:
+  /// Deallocate every idle workspace.
+  ~workspace_pool() {
+    for(W *w: idle_) traits::free(w);
+  }
+
+  /// Pool for current thread.
+  /// @return  Reference to thread-local pool.
+  static workspace_pool &local() {
+    static thread_local workspace_pool p;
+    return p;
+  }
+
+  /// Exclusive use of workspace until destruction of %lease.
+  class lease {
+    W *w_; ///< Leased workspace.
+    workspace_pool *p_; ///< Pool to which workspace is returned.
+
+    lease(lease const &)= delete; ///< Disable copying.
+    lease &operator=(lease const &)= delete; ///< Disable copying.
+
+  public:
+    /// Take ownership of workspace.
+    /// @param w  Pointer to workspace.
+    /// @param p  Pool to which workspace is returned.
+    lease(W *w, workspace_pool *p): w_(w), p_(p) {}
+
+    /// Move on construction.
+    /// @param src  Lease to move.
+    lease(lease &&src): w_(src.w_), p_(src.p_) { src.w_= nullptr; }
+
+    /// Return workspace to pool.
+    ~lease() {
+      if(w_) p_->idle_.push_back(w_);
+    }
+
+    /// Pointer to leased workspace.
+    /// @return  Pointer to leased workspace.
+    W *get() const { return w_; }
+  };
+
+  /// Lease workspace with capacity at least `n`.
+  /// @param n  Minimum capacity of workspace.
+  /// @return  Lease on workspace.
+  lease acquire(size_t n) {
+    for(size_t i= idle_.size(); i-- > 0;) {
+      W *const w= idle_[i];
+      if(traits::size(w) >= n) {
+        idle_[i]= idle_.back();
+        idle_.pop_back();
+        return lease(w, this);
+      }
+    }
+    return lease(traits::alloc(n), this);
+  }
+};
+
+
+/// Lease workspace with capacity at least `n` from current thread's pool.
+/// \tparam W  Type of GSL's workspace.
+/// @param n  Minimum capacity of workspace.
+/// @return  Lease on workspace.
+template<typename W> typename workspace_pool<W>::lease acquire(size_t n) {
+  return workspace_pool<W>::local().acquire(n);
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,11 @@
+/// \file       include/gslcpp/integration.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for numerical integration (quadrature).
+
+#pragma once
+
+#include "integ/cquad.hpp" // cquad
+#include "integ/fixed-quad.hpp" // fixed_quad
+#include "integ/qag.hpp" // qag, qags, etc.
+
+// EOF
@@ -0,0 +1,311 @@
+/// \file       include/gslcpp/interp/interp.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::interp.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "locate.hpp" // interp_locate
+#include <cmath> // NAN
+#include <gsl/gsl_interp.h> // gsl_interp, gsl_interp_accel, etc.
+#include <stdexcept> // invalid_argument
+#include <type_traits> // is_same_v, remove_const_t
+#include <utility> // move
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of queries in each chunk of batch-evaluation by gsl::interp.
+constexpr size_t interp_grain= size_t(1) << 14;
+
+
+/// Interpolation over data referred to, not copied.
+/// https://www.gnu.org/software/gsl/doc/html/interp.html
+///
+/// Like `gsl_spline`, an instance keeps the data with the interpolation, but
+/// unlike `gsl_spline`, it refers to the caller's abscissas and ordinates if
+/// they be contiguous; only strided data are copied.  Data referred to must
+/// outlive the instance and must not be modified.
+///
+/// Besides evaluation at a single point, eval(), deriv(), and deriv2()
+/// evaluate at every element of a vector of queries.
+///
+/// - The queries are split into chunks of gsl::interp_grain over a
+///   gsl::thread_pool, and each chunk has its own `gsl_interp_accel`.
+///
+/// - The interval of each query is found by gsl::interp_locate(), starting
+///   from the interval of the previous query, so that sorted queries are
+///   located by a short forward sweep.  The accelerator is then set to that
+///   interval, so that GSL does no search of its own.
+///
+/// - For `gsl_interp_linear`, eval() computes the value natively, with the
+///   same arithmetic as GSL, and without any indirect call.
+///
+/// A query out of range yields NaN, and is counted, rather than being
+/// reported to GSL's error-handler.
+class interp {
+  gsl_interp *i_; ///< GSL's interpolation.
+  std::vector<double> own_; ///< Copy of data, only if strided.
+  double const *x_; ///< Pointer to first abscissa.
+  double const *y_; ///< Pointer to first ordinate.
+  size_t n_; ///< Number of points.
+
+  interp(interp const &)= delete; ///< Disable copying.
+  interp &operator=(interp const &)= delete; ///< Disable copying.
+
+  /// Evaluate at every query by `op(i, q, a)`, where `i` is the offset of the
+  /// interval containing `q`, and `a` is an accelerator set to `i`.
+  /// \tparam Q  Type of vector of queries.
+  /// \tparam O  Type of vector of output.
+  /// \tparam F  Type of operation.
+  /// @param q  Queries.
+  /// @param o  Output, one per query.
+  /// @param op  Operation.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Number of queries out of range.
+  template<typename Q, typename O, typename F>
+  size_t batch(Q const &q, O &o, F const &op, thread_pool &p) const {
+    size_t const n= q.size(), sq= q.v()->stride, so= o.v()->stride;
+    if(o.size() != n) throw std::invalid_argument("mismatch in size");
+    auto const *const qd= q.data();
+    auto *const od= o.data();
+    using U= std::remove_reference_t<decltype(*od)>;
+    double const lo= x_[0], hi= x_[n_ - 1];
+    std::vector<size_t> bad(p.size());
+    p.for_chunks(n, interp_grain, [&](size_t b, size_t e, unsigned w) {
+      gsl_interp_accel a{0, 0, 0};
+      size_t i= 0, m= 0;
+      for(size_t k= b; k < e; ++k) {
+        double const xq= double(qd[k * sq]);
+        if(!(xq >= lo && xq <= hi)) {
+          od[k * so]= U(NAN);
+          ++m;
+          continue;
+        }
+        i= interp_locate(x_, n_, xq, i);
+        a.cache= i;
+        od[k * so]= U(op(i, xq, a));
+      }
+      bad[w]+= m;
+    });
+    size_t total= 0;
+    for(size_t m: bad) total+= m;
+    return total;
+  }
+
+public:
+  /// Type of interpolation.
+  using type= gsl_interp_type;
+
+  /// Initialize interpolation.
+  /// https://www.gnu.org/software/gsl/doc/html/interp.html#c.gsl_interp_init
+  /// \tparam T  Type of element in vector of abscissas.
+  /// \tparam N  Compile-time number of abscissas.
+  /// \tparam V  Type of interface to storage of abscissas.
+  /// \tparam U  Type of element in vector of ordinates.
+  /// \tparam M  Compile-time number of ordinates.
+  /// \tparam W  Type of interface to storage of ordinates.
+  /// @param x  Strictly increasing abscissas.
+  /// @param y  Ordinates, one per abscissa.
+  /// @param t  Type of interpolation, like `gsl_interp_cspline`.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  interp(
+        v_iface<T, N, V> const &x,
+        v_iface<U, M, W> const &y,
+        type const *t= gsl_interp_cspline):
+      i_(nullptr), x_(x.data()), y_(y.data()), n_(x.size()) {
+    static_assert(std::is_same_v<std::remove_const_t<T>, double>);
+    static_assert(std::is_same_v<std::remove_const_t<U>, double>);
+    if(y.size() != n_) throw std::invalid_argument("mismatch in size");
+    if(n_ < gsl_interp_type_min_size(t) || n_ < 2) {
+      throw std::invalid_argument("too few points");
+    }
+    size_t const sx= x.v()->stride, sy= y.v()->stride;
+    if(sx != 1 || sy != 1) {
+      own_.resize(2 * n_);
+      for(size_t k= 0; k < n_; ++k) {
+        own_[k]= x_[k * sx];
+        own_[n_ + k]= y_[k * sy];
+      }
+      x_= own_.data();
+      y_= own_.data() + n_;
+    }
+    i_= gsl_interp_alloc(t, n_);
+    gsl_interp_init(i_, x_, y_, n_);
+  }
+
+  /// Move on construction.
+  /// @param src  Interpolation to move.
+  interp(interp &&src):
+      i_(src.i_),
+      own_(std::move(src.own_)),
+      x_(src.x_),
+      y_(src.y_),
+      n_(src.n_) {
+    src.i_= nullptr;
+  }
+
+  /// Deallocate interpolation.
+  ~interp() {
+    if(i_) gsl_interp_free(i_);
+  }
+
+  /// Pointer to GSL's interpolation.
+  /// @return  Pointer to GSL's interpolation.
+  gsl_interp const *i() const { return i_; }
+
+  /// Name of type of interpolation.
+  /// https://www.gnu.org/software/gsl/doc/html/interp.html#c.gsl_interp_name
+  /// @return  Name of type.
+  char const *name() const { return gsl_interp_name(i_); }
+
+  /// Number of points.
+  /// @return  Number of points.
+  size_t size() const { return n_; }
+
+  /// Interpolated value at single point.
+  /// https://www.gnu.org/software/gsl/doc/html/interp.html#c.gsl_interp_eval
+  /// @param xq  Point at which to evaluate.
+  /// @param a  Accelerator, or null.
+  /// @return  Value, or NaN if `xq` be out of range.
+  double eval(double xq, gsl_interp_accel *a= nullptr) const {
+    double v;
+    gsl_interp_eval_e(i_, x_, y_, xq, a, &v);
+    return v;
+  }
+
+  /// Interpolated first derivative at single point.
+  /// https://www.gnu.org/software/gsl/doc/html/interp.html#c.gsl_interp_eval_deriv
+  /// @param xq  Point at which to evaluate.
+  /// @param a  Accelerator, or null.
+  /// @return  Derivative, or NaN if `xq` be out of range.
+  double deriv(double xq, gsl_interp_accel *a= nullptr) const {
+    double v;
+    gsl_interp_eval_deriv_e(i_, x_, y_, xq, a, &v);
+    return v;
+  }
+
+  /// Interpolated second derivative at single point.
+  /// https://www.gnu.org/software/gsl/doc/html/interp.html#c.gsl_interp_eval_deriv2
+  /// @param xq  Point at which to evaluate.
+  /// @param a  Accelerator, or null.
+  /// @return  Second derivative, or NaN if `xq` be out of range.
+  double deriv2(double xq, gsl_interp_accel *a= nullptr) const {
+    double v;
+    gsl_interp_eval_deriv2_e(i_, x_, y_, xq, a, &v);
+    return v;
+  }
+
+  /// Interpolated value at each query.
+  /// \tparam T  Type of element in vector of queries.
+  /// \tparam N  Compile-time number of queries.
+  /// \tparam V  Type of interface to storage of queries.
+  /// \tparam U  Type of element in vector of output.
+  /// \tparam M  Compile-time number of output-elements.
+  /// \tparam W  Type of interface to storage of output.
+  /// @param q  Queries, fastest when sorted.
+  /// @param o  Output, one per query.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Number of queries out of range.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  size_t eval(
+        v_iface<T, N, V> const &q,
+        v_iface<U, M, W> &o,
+        thread_pool &p= thread_pool::global()) const {
+    if(i_->type == gsl_interp_linear) {
+      double const *const x= x_, *const y= y_;
+      auto const op= [x, y](size_t i, double xq, gsl_interp_accel &) {
+        double const dx= x[i + 1] - x[i];
+        return y[i] + (xq - x[i]) / dx * (y[i + 1] - y[i]);
+      };
+      return batch(q, o, op, p);
+    }
+    auto const op= [this](size_t, double xq, gsl_interp_accel &a) {
+      return eval(xq, &a);
+    };
+    return batch(q, o, op, p);
+  }
+
+  /// Interpolated first derivative at each query.
+  /// \tparam T  Type of element in vector of queries.
+  /// \tparam N  Compile-time number of queries.
+  /// \tparam V  Type of interface to storage of queries.
+  /// \tparam U  Type of element in vector of output.
+  /// \tparam M  Compile-time number of output-elements.
+  /// \tparam W  Type of interface to storage of output.
+  /// @param q  Queries, fastest when sorted.
+  /// @param o  Output, one per query.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Number of queries out of range.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  size_t deriv(
+        v_iface<T, N, V> const &q,
+        v_iface<U, M, W> &o,
+        thread_pool &p= thread_pool::global()) const {
+    auto const op= [this](size_t, double xq, gsl_interp_accel &a) {
+      return deriv(xq, &a);
+    };
+    return batch(q, o, op, p);
+  }
+
+  /// Interpolated second derivative at each query.
+  /// \tparam T  Type of element in vector of queries.
+  /// \tparam N  Compile-time number of queries.
+  /// \tparam V  Type of interface to storage of queries.
+  /// \tparam U  Type of element in vector of output.
+  /// \tparam M  Compile-time number of output-elements.
+  /// \tparam W  Type of interface to storage of output.
+  /// @param q  Queries, fastest when sorted.
+  /// @param o  Output, one per query.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Number of queries out of range.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  size_t deriv2(
+        v_iface<T, N, V> const &q,
+        v_iface<U, M, W> &o,
+        thread_pool &p= thread_pool::global()) const {
+    auto const op= [this](size_t, double xq, gsl_interp_accel &a) {
+      return deriv2(xq, &a);
+    };
+    return batch(q, o, op, p);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,44 @@
+/// \dir        include/gslcpp/interp
+/// \brief      Types and functions specific to interpolation.
+
+/// \file       include/gslcpp/interp/locate.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::interp_locate().
+
+#pragma once
+
+#include <algorithm> // min, upper_bound
+#include <cstddef> // size_t
+
+namespace gsl {
+
+
+/// Offset of interval of abscissas that contain value, searching from hint.
+///
+/// If `q` be at or after `x[i]`, then the search gallops forward from `i` (by
+/// steps of 1, 2, 4, ...) and finishes with a binary search of the last step.
+/// For sorted queries, each call thus costs a constant on average, rather than
+/// the logarithm of `n` for a binary search from scratch.  If `q` be before
+/// `x[i]`, then the search is a binary search of `[0, i)`.
+///
+/// @param x  Pointer to `n` strictly increasing abscissas.
+/// @param n  Number of abscissas, at least two.
+/// @param q  Value, in `[x[0], x[n-1]]`.
+/// @param i  Hint, less than `n - 1`, like result of previous call.
+/// @return  Offset `j < n - 1` such that `x[j] <= q`, and `q < x[j+1]` unless
+///          `q == x[n-1]`.
+inline size_t interp_locate(double const *x, size_t n, double q, size_t i) {
+  if(q < x[i]) return size_t(std::upper_bound(x, x + i, q) - x) - 1;
+  size_t lo= i, step= 1;
+  while(lo + step < n - 1 && x[lo + step] <= q) {
+    lo+= step;
+    step*= 2;
+  }
+  size_t const hi= std::min(lo + step, n - 1);
+  return size_t(std::upper_bound(x + lo, x + hi, q) - x) - 1;
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,10 @@
+/// \file       include/gslcpp/interpolation.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for interpolation.
+
+#pragma once
+
+#include "interp/interp.hpp" // interp, interp_grain
+#include "interp/locate.hpp" // interp_locate
+
+// EOF
@@ -0,0 +1,12 @@
+/// \file       include/gslcpp/linalg.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for linear algebra.
+
+#pragma once
+
+#include "linalg/cholesky.hpp" // cholesky
+#include "linalg/lu.hpp" // lu
+#include "linalg/qr.hpp" // qr
+#include "linalg/small-batch.hpp" // small_systems, small_lu_solve, etc.
+
+// EOF
@@ -0,0 +1,138 @@
+/// \file       include/gslcpp/linalg/cholesky.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::cholesky.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include "columns.hpp" // solve_columns, thread_pool
+#include <cmath> // log
+#include <gsl/gsl_linalg.h> // gsl_linalg_cholesky_decomp1, etc.
+#include <stdexcept> // invalid_argument
+#include <type_traits> // is_same_v, remove_const_t
+
+namespace gsl {
+
+
+/// Cholesky-decomposition of symmetric, positive-definite matrix.
+/// https://www.gnu.org/software/gsl/doc/html/linalg.html#cholesky-decomposition
+///
+/// As for gsl::lu, the factor is allocated once and reused by every call to
+/// factor(), and solve() of a matrix of right-hand sides distributes the
+/// columns over a gsl::thread_pool.
+class cholesky {
+  gsl_matrix *l_; ///< Factor L and its transpose.
+
+  cholesky(cholesky const &)= delete; ///< Disable copying.
+  cholesky &operator=(cholesky const &)= delete; ///< Disable copying.
+
+public:
+  /// Allocate factor.
+  /// @param n  Number of rows and of columns.
+  explicit cholesky(size_t n): l_(gsl_matrix_alloc(n, n)) {}
+
+  /// Move on construction.
+  /// @param src  Decomposition to move.
+  cholesky(cholesky &&src): l_(src.l_) { src.l_= nullptr; }
+
+  /// Deallocate factor.
+  ~cholesky() {
+    if(l_) gsl_matrix_free(l_);
+  }
+
+  /// Number of rows and of columns.
+  /// @return  Number of rows.
+  size_t size() const { return l_->size1; }
+
+  /// Factor L in lower triangle, and its transpose in upper, as by GSL.
+  /// @return  Pointer to GSL's matrix.
+  gsl_matrix const *matrix() const { return l_; }
+
+  /// Factor matrix, which is copied and not modified.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_cholesky_decomp1
+  /// @param a  Symmetric, positive-definite matrix with size() rows.
+  /// @return  GSL's status, which is `GSL_EDOM` if `a` be not positive
+  ///          definite.
+  int factor(gsl_matrix const *a) {
+    if(a->size1 != size() || a->size2 != size()) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    gsl_matrix_memcpy(l_, a);
+    return gsl_linalg_cholesky_decomp1(l_);
+  }
+
+  /// Solve for single right-hand side.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_cholesky_solve
+  /// \tparam T  Type of element in right-hand side.
+  /// \tparam N  Compile-time number of elements in right-hand side.
+  /// \tparam V  Type of interface to storage of right-hand side.
+  /// \tparam M  Compile-time number of elements in solution.
+  /// \tparam W  Type of interface to storage of solution.
+  /// @param b  Right-hand side.
+  /// @param x  Solution.
+  /// @return  GSL's status.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  int solve(v_iface<T, N, V> const &b, v_iface<double, M, W> &x) const {
+    static_assert(std::is_same_v<std::remove_const_t<T>, double>);
+    return gsl_linalg_cholesky_solve(l_, b.v(), x.v());
+  }
+
+  /// Solve in place for single right-hand side.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_cholesky_svx
+  /// \tparam N  Compile-time number of elements.
+  /// \tparam V  Type of interface to storage.
+  /// @param x  On input, right-hand side; on output, solution.
+  /// @return  GSL's status.
+  template<size_t N, template<typename, size_t> class V>
+  int svx(v_iface<double, N, V> &x) const {
+    return gsl_linalg_cholesky_svx(l_, x.v());
+  }
+
+  /// Solve for each column of matrix of right-hand sides, in parallel.
+  /// @param b  Right-hand sides, one per column.
+  /// @param x  Solutions, one per column.
+  /// @param p  Pool over which to distribute columns.
+  /// @return  Zero, or first nonzero status of GSL.
+  int solve(
+        gsl_matrix const *b,
+        gsl_matrix *x,
+        thread_pool &p= thread_pool::global()) const {
+    if(b->size1 != size()) throw std::invalid_argument("mismatch in size");
+    auto const f= [this](gsl_vector const *bj, gsl_vector *xj, unsigned) {
+      return gsl_linalg_cholesky_solve(l_, bj, xj);
+    };
+    return solve_columns(b, x, size(), f, p);
+  }
+
+  /// Inverse of matrix.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_cholesky_invert
+  /// @param inv  On output, inverse.
+  /// @return  GSL's status.
+  int invert(gsl_matrix *inv) const {
+    gsl_matrix_memcpy(inv, l_);
+    return gsl_linalg_cholesky_invert(inv);
+  }
+
+  /// Logarithm of determinant, which is twice sum of logarithms of diagonal
+  /// of L.
+  /// @return  Logarithm of determinant.
+  double lndet() const {
+    double s= 0.0;
+    for(size_t i= 0; i < size(); ++i) {
+      s+= std::log(l_->data[i * l_->tda + i]);
+    }
+    return 2.0 * s;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
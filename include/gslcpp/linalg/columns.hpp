@@ -0,0 +1,58 @@
+/// \dir        include/gslcpp/linalg
+/// \brief      Types and functions specific to linear algebra.
+
+/// \file       include/gslcpp/linalg/columns.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::solve_columns().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include <gsl/gsl_matrix.h> // gsl_matrix, gsl_matrix_column, etc.
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Solve for each column of right-hand side, in parallel.
+///
+/// Each column is an independent solve against the same factorization, and so
+/// columns are distributed over a gsl::thread_pool.  A factorization is only
+/// read by a solve, and so every thread may share it.
+///
+/// \tparam F  Type of function `f(b, x, w)` that solve for one column, given
+///            pointers to GSL's vectors and offset of worker.
+/// @param b  Right-hand sides, one per column.
+/// @param x  Solutions, one per column; same number of columns as `b`.
+/// @param m  Number of rows required in `x`.
+/// @param f  Solver for one column.
+/// @param p  Pool over which to distribute columns.
+/// @return  Zero, or first nonzero status of any worker.
+template<typename F>
+int solve_columns(
+      gsl_matrix const *b,
+      gsl_matrix *x,
+      size_t m,
+      F const &f,
+      thread_pool &p) {
+  if(b->size2 != x->size2 || x->size1 != m) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  std::vector<int> status(p.size());
+  p.for_each(b->size2, [&](size_t j, unsigned w) {
+    gsl_vector_const_view const bj= gsl_matrix_const_column(b, j);
+    gsl_vector_view xj= gsl_matrix_column(x, j);
+    int const s= f(&bj.vector, &xj.vector, w);
+    if(s && !status[w]) status[w]= s;
+  });
+  for(int s: status) {
+    if(s) return s;
+  }
+  return 0;
+}
+
+
+} // namespace gsl
+
+// EOF
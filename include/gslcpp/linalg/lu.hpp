@@ -0,0 +1,161 @@
+/// \file       include/gslcpp/linalg/lu.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::lu.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include "columns.hpp" // solve_columns, thread_pool
+#include <gsl/gsl_linalg.h> // gsl_linalg_LU_decomp, etc.
+#include <gsl/gsl_permutation.h> // gsl_permutation
+#include <stdexcept> // invalid_argument
+#include <type_traits> // is_same_v, remove_const_t
+
+namespace gsl {
+
+
+/// LU-decomposition, with partial pivoting, of square matrix.
+/// https://www.gnu.org/software/gsl/doc/html/linalg.html#lu-decomposition
+///
+/// An instance owns the factor and the permutation, which are allocated once,
+/// at construction, and reused by every subsequent call to factor().  After
+/// factor(), any number of right-hand sides may be solved; solve() of a
+/// matrix of right-hand sides distributes the columns over a
+/// gsl::thread_pool.
+///
+/// GSL's decomposition is recursive and spends most of its time in level-3
+/// CBLAS.  Its speed thus depends mostly on the CBLAS linked with GSL; see
+/// `GSLCPP_CBLAS` in `CMakeLists.txt`.
+class lu {
+  gsl_matrix *lu_; ///< Factors L and U, packed.
+  gsl_permutation *p_; ///< Permutation of rows.
+  int signum_= 1; ///< Sign of permutation.
+
+  lu(lu const &)= delete; ///< Disable copying.
+  lu &operator=(lu const &)= delete; ///< Disable copying.
+
+public:
+  /// Allocate factor and permutation.
+  /// @param n  Number of rows and of columns.
+  explicit lu(size_t n):
+      lu_(gsl_matrix_alloc(n, n)), p_(gsl_permutation_alloc(n)) {}
+
+  /// Move on construction.
+  /// @param src  Decomposition to move.
+  lu(lu &&src): lu_(src.lu_), p_(src.p_), signum_(src.signum_) {
+    src.lu_= nullptr;
+    src.p_= nullptr;
+  }
+
+  /// Deallocate factor and permutation.
+  ~lu() {
+    if(lu_) gsl_matrix_free(lu_);
+    if(p_) gsl_permutation_free(p_);
+  }
+
+  /// Number of rows and of columns.
+  /// @return  Number of rows.
+  size_t size() const { return lu_->size1; }
+
+  /// Factors L and U, packed as by GSL.
+  /// @return  Pointer to GSL's matrix.
+  gsl_matrix const *matrix() const { return lu_; }
+
+  /// Permutation of rows.
+  /// @return  Pointer to GSL's permutation.
+  gsl_permutation const *permutation() const { return p_; }
+
+  /// Sign of permutation.
+  /// @return  +1 or -1.
+  int signum() const { return signum_; }
+
+  /// Factor matrix, which is copied and not modified.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_decomp
+  /// @param a  Square matrix with size() rows.
+  /// @return  GSL's status.
+  int factor(gsl_matrix const *a) {
+    if(a->size1 != size() || a->size2 != size()) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    gsl_matrix_memcpy(lu_, a);
+    return gsl_linalg_LU_decomp(lu_, p_, &signum_);
+  }
+
+  /// Solve for single right-hand side.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_solve
+  /// \tparam T  Type of element in right-hand side.
+  /// \tparam N  Compile-time number of elements in right-hand side.
+  /// \tparam V  Type of interface to storage of right-hand side.
+  /// \tparam M  Compile-time number of elements in solution.
+  /// \tparam W  Type of interface to storage of solution.
+  /// @param b  Right-hand side.
+  /// @param x  Solution.
+  /// @return  GSL's status.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  int solve(v_iface<T, N, V> const &b, v_iface<double, M, W> &x) const {
+    static_assert(std::is_same_v<std::remove_const_t<T>, double>);
+    return gsl_linalg_LU_solve(lu_, p_, b.v(), x.v());
+  }
+
+  /// Solve in place for single right-hand side.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_svx
+  /// \tparam N  Compile-time number of elements.
+  /// \tparam V  Type of interface to storage.
+  /// @param x  On input, right-hand side; on output, solution.
+  /// @return  GSL's status.
+  template<size_t N, template<typename, size_t> class V>
+  int svx(v_iface<double, N, V> &x) const {
+    return gsl_linalg_LU_svx(lu_, p_, x.v());
+  }
+
+  /// Solve for each column of matrix of right-hand sides, in parallel.
+  /// @param b  Right-hand sides, one per column.
+  /// @param x  Solutions, one per column.
+  /// @param p  Pool over which to distribute columns.
+  /// @return  Zero, or first nonzero status of GSL.
+  int solve(
+        gsl_matrix const *b,
+        gsl_matrix *x,
+        thread_pool &p= thread_pool::global()) const {
+    if(b->size1 != size()) throw std::invalid_argument("mismatch in size");
+    auto const f= [this](gsl_vector const *bj, gsl_vector *xj, unsigned) {
+      return gsl_linalg_LU_solve(lu_, p_, bj, xj);
+    };
+    return solve_columns(b, x, size(), f, p);
+  }
+
+  /// Inverse of matrix.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_invert
+  /// @param inv  On output, inverse.
+  /// @return  GSL's status.
+  int invert(gsl_matrix *inv) const {
+    return gsl_linalg_LU_invert(lu_, p_, inv);
+  }
+
+  /// Determinant of matrix.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_det
+  /// @return  Determinant.
+  double det() const { return gsl_linalg_LU_det(lu_, signum_); }
+
+  /// Logarithm of absolute value of determinant.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_lndet
+  /// @return  Logarithm of absolute value of determinant.
+  double lndet() const { return gsl_linalg_LU_lndet(lu_); }
+
+  /// Sign of determinant.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_LU_sgndet
+  /// @return  +1, -1, or 0.
+  int sgndet() const { return gsl_linalg_LU_sgndet(lu_, signum_); }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,168 @@
+/// \file       include/gslcpp/linalg/qr.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::qr.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "columns.hpp" // solve_columns, thread_pool
+#include <cmath> // sqrt
+#include <gsl/gsl_linalg.h> // gsl_linalg_QR_decomp_r, etc.
+#include <stdexcept> // invalid_argument
+#include <type_traits> // is_same_v, remove_const_t
+#include <utility> // move
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// QR-decomposition of matrix with at least as many rows as columns, for
+/// solution of square or of least-squares problems.
+/// https://www.gnu.org/software/gsl/doc/html/linalg.html#qr-decomposition
+///
+/// GSL's recursive (`_r`) form of the decomposition is used; it is based on
+/// level-3 CBLAS and keeps the block-reflector T alongside the packed factor.
+/// The factor, T, and the workspace for a solve are allocated once and
+/// reused.  GSL writes the solution of a least-squares problem into the
+/// first cols() elements of a vector with rows() elements, and the rest of
+/// the vector describes the residual; so each solve goes through a scratch
+/// vector with rows() elements, from which the solution is copied.  Because
+/// the workspace and the scratch vector are modified, lssolve() of a single
+/// right-hand side is not `const`; lssolve() of a matrix of right-hand sides
+/// gives each worker its own workspace and scratch vector.
+class qr {
+  gsl_matrix *qr_; ///< Packed factors Q and R.
+  gsl_matrix *t_; ///< Block-reflector T.
+  std::vector<double> work_; ///< Workspace for solve.
+  std::vector<double> sol_; ///< Solution and residual-part of last solve.
+
+  qr(qr const &)= delete; ///< Disable copying.
+  qr &operator=(qr const &)= delete; ///< Disable copying.
+
+public:
+  /// Allocate factor, block-reflector, workspace, and scratch vector.
+  /// @param m  Number of rows.
+  /// @param n  Number of columns, at most `m`.
+  qr(size_t m, size_t n):
+      qr_(n > m ? throw std::invalid_argument("more columns than rows")
+                : gsl_matrix_alloc(m, n)),
+      t_(gsl_matrix_alloc(n, n)),
+      work_(n),
+      sol_(m) {}
+
+  /// Move on construction.
+  /// @param src  Decomposition to move.
+  qr(qr &&src):
+      qr_(src.qr_),
+      t_(src.t_),
+      work_(std::move(src.work_)),
+      sol_(std::move(src.sol_)) {
+    src.qr_= nullptr;
+    src.t_= nullptr;
+  }
+
+  /// Deallocate factor and block-reflector.
+  ~qr() {
+    if(qr_) gsl_matrix_free(qr_);
+    if(t_) gsl_matrix_free(t_);
+  }
+
+  /// Number of rows.
+  /// @return  Number of rows.
+  size_t rows() const { return qr_->size1; }
+
+  /// Number of columns.
+  /// @return  Number of columns.
+  size_t cols() const { return qr_->size2; }
+
+  /// Packed factors Q and R, as by GSL.
+  /// @return  Pointer to GSL's matrix.
+  gsl_matrix const *matrix() const { return qr_; }
+
+  /// Block-reflector T, as by GSL.
+  /// @return  Pointer to GSL's matrix.
+  gsl_matrix const *t() const { return t_; }
+
+  /// Factor matrix, which is copied and not modified.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_QR_decomp_r
+  /// @param a  Matrix with rows() rows and cols() columns.
+  /// @return  GSL's status.
+  int factor(gsl_matrix const *a) {
+    if(a->size1 != rows() || a->size2 != cols()) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    gsl_matrix_memcpy(qr_, a);
+    return gsl_linalg_QR_decomp_r(qr_, t_);
+  }
+
+  /// Solve, in least-squares sense, for single right-hand side.
+  /// https://www.gnu.org/software/gsl/doc/html/linalg.html#c.gsl_linalg_QR_lssolve_r
+  /// \tparam T  Type of element in right-hand side.
+  /// \tparam N  Compile-time number of elements in right-hand side.
+  /// \tparam V  Type of interface to storage of right-hand side.
+  /// \tparam M  Compile-time number of elements in solution.
+  /// \tparam W  Type of interface to storage of solution.
+  /// @param b  Right-hand side, with rows() elements.
+  /// @param x  Solution, with cols() elements.
+  /// @return  GSL's status.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  int lssolve(v_iface<T, N, V> const &b, v_iface<double, M, W> &x) {
+    static_assert(std::is_same_v<std::remove_const_t<T>, double>);
+    size_t const n= cols();
+    if(b.size() != rows() || x.size() != n) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    auto w= w_vector_view_array(work_.data(), 1, n);
+    auto s= w_vector_view_array(sol_.data(), 1, rows());
+    int const r= gsl_linalg_QR_lssolve_r(qr_, t_, b.v(), &s.vector, &w.vector);
+    for(size_t i= 0; i < n; ++i) x[i]= sol_[i];
+    return r;
+  }
+
+  /// Euclidean norm of residual `b - A x` of last lssolve() of single
+  /// right-hand side, from the last rows() - cols() elements that GSL
+  /// writes after the solution.
+  /// @return  Norm of residual.
+  double residual_norm() const {
+    double s= 0.0;
+    for(size_t i= cols(); i < rows(); ++i) s+= sol_[i] * sol_[i];
+    return std::sqrt(s);
+  }
+
+  /// Solve, in least-squares sense, for each column of matrix of right-hand
+  /// sides, in parallel.
+  /// @param b  Right-hand sides, one per column, each with rows() elements.
+  /// @param x  Solutions, one per column, each with cols() elements.
+  /// @param p  Pool over which to distribute columns.
+  /// @return  Zero, or first nonzero status of GSL.
+  int lssolve(
+        gsl_matrix const *b,
+        gsl_matrix *x,
+        thread_pool &p= thread_pool::global()) const {
+    if(b->size1 != rows()) throw std::invalid_argument("mismatch in size");
+    size_t const m= rows(), n= cols();
+    std::vector<double> work(n * p.size()), sol(m * p.size());
+    auto const f= [&](gsl_vector const *bj, gsl_vector *xj, unsigned w) {
+      auto v= w_vector_view_array(work.data() + w * n, 1, n);
+      auto s= w_vector_view_array(sol.data() + w * m, 1, m);
+      int const r= gsl_linalg_QR_lssolve_r(qr_, t_, bj, &s.vector, &v.vector);
+      auto const sj= gsl_vector_const_subvector(&s.vector, 0, n);
+      gsl_vector_memcpy(xj, &sj.vector);
+      return r;
+    };
+    return solve_columns(b, x, n, f, p);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
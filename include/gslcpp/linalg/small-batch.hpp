@@ -0,0 +1,203 @@
+/// \file       include/gslcpp/linalg/small-batch.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for batched solution of small linear systems.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "small-kernel.hpp" // small_kernel, small_lanes
+#include <algorithm> // min
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of systems in each chunk of batched solution distributed over
+/// gsl::thread_pool.  This is a multiple of gsl::small_lanes.
+constexpr size_t small_grain= 1024;
+
+
+// Batched systems are stored as structure of arrays (SoA).  For `count`
+// systems, each with `N` unknowns, element `(i, j)` of the matrix of system
+// `s` is at offset `(i * N + j) * count + s` of the array of matrices, and
+// element `i` of the right-hand side of system `s` is at offset
+// `i * count + s` of the array of right-hand sides.  Corresponding elements
+// of successive systems are thus adjacent, and a block of gsl::small_lanes
+// systems is loaded by contiguous reads.
+
+
+/// Solve batch of small systems stored as SoA, in parallel, by kernel.
+///
+/// Blocks of gsl::small_lanes systems are loaded into local arrays, solved by
+/// `f`, and stored.  The last block is padded with identity-systems.  Chunks
+/// of gsl::small_grain systems are distributed over `p`.
+///
+/// \tparam N  Number of unknowns in each system.
+/// \tparam T  Type of each element.
+/// \tparam F  Type of kernel, like gsl::small_kernel::lu.
+/// @param a  Matrices, which are not modified.
+/// @param b  On input, right-hand sides; on output, solutions.
+/// @param count  Number of systems.
+/// @param f  Kernel.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Number of systems that kernel reports as failed.
+template<size_t N, typename T, typename F>
+size_t small_solve(
+      T const *a, T *b, size_t count, F const &f, thread_pool &p) {
+  using kernel= small_kernel<N, T>;
+  constexpr size_t L= small_lanes;
+  std::vector<size_t> bad(p.size());
+  p.for_chunks(count, small_grain, [&](size_t cb, size_t ce, unsigned w) {
+    typename kernel::matrices m;
+    typename kernel::vectors x;
+    size_t nbad= 0;
+    for(size_t s= cb; s < ce; s+= L) {
+      size_t const k= std::min(L, ce - s);
+      for(size_t i= 0; i < N; ++i) {
+        for(size_t j= 0; j < N; ++j) {
+          T const *const aij= a + (i * N + j) * count + s;
+          T const pad= T(i == j);
+          for(size_t l= 0; l < L; ++l) m[i][j][l]= (l < k ? aij[l] : pad);
+        }
+        T const *const bi= b + i * count + s;
+        for(size_t l= 0; l < L; ++l) x[i][l]= (l < k ? bi[l] : T(0));
+      }
+      unsigned const fail= f(m, x);
+      for(size_t l= 0; l < k; ++l) nbad+= (fail >> l) & 1u;
+      for(size_t i= 0; i < N; ++i) {
+        T *const bi= b + i * count + s;
+        for(size_t l= 0; l < k; ++l) bi[l]= x[i][l];
+      }
+    }
+    bad[w]+= nbad;
+  });
+  size_t total= 0;
+  for(size_t n: bad) total+= n;
+  return total;
+}
+
+
+/// Solve batch of small, symmetric, positive-definite systems stored as SoA,
+/// by Cholesky-decomposition.
+/// \tparam N  Number of unknowns in each system.
+/// \tparam T  Type of each element.
+/// @param a  Matrices, of which only lower triangles are read.
+/// @param b  On input, right-hand sides; on output, solutions.
+/// @param count  Number of systems.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Number of systems not positive definite.
+template<size_t N, typename T>
+size_t small_cholesky_solve(
+      T const *a,
+      T *b,
+      size_t count,
+      thread_pool &p= thread_pool::global()) {
+  return small_solve<N>(a, b, count, &small_kernel<N, T>::cholesky, p);
+}
+
+
+/// Solve batch of small systems stored as SoA, by LU-decomposition with
+/// partial pivoting.
+/// \tparam N  Number of unknowns in each system.
+/// \tparam T  Type of each element.
+/// @param a  Matrices.
+/// @param b  On input, right-hand sides; on output, solutions.
+/// @param count  Number of systems.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Number of singular systems.
+template<size_t N, typename T>
+size_t small_lu_solve(
+      T const *a,
+      T *b,
+      size_t count,
+      thread_pool &p= thread_pool::global()) {
+  return small_solve<N>(a, b, count, &small_kernel<N, T>::lu, p);
+}
+
+
+/// Storage, as SoA, for batch of small linear systems, each with `N`
+/// unknowns.
+/// \tparam N  Number of unknowns in each system.
+/// \tparam T  Type of each element, `double` or `float`.
+template<size_t N, typename T= double> class small_systems {
+  size_t count_; ///< Number of systems.
+  std::vector<T> a_; ///< Matrices.
+  std::vector<T> b_; ///< Right-hand sides or solutions.
+
+public:
+  /// Allocate storage for systems.
+  /// @param count  Number of systems.
+  explicit small_systems(size_t count):
+      count_(count), a_(N * N * count), b_(N * count) {}
+
+  /// Number of systems.
+  /// @return  Number of systems.
+  size_t size() const { return count_; }
+
+  /// Element of matrix.
+  /// @param s  Offset of system.
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  /// @return  Reference to element.
+  T &a(size_t s, size_t i, size_t j) { return a_[(i * N + j) * count_ + s]; }
+
+  /// Element of immutable matrix.
+  /// @param s  Offset of system.
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  /// @return  Element.
+  T a(size_t s, size_t i, size_t j) const {
+    return a_[(i * N + j) * count_ + s];
+  }
+
+  /// Element of right-hand side or of solution.
+  /// @param s  Offset of system.
+  /// @param i  Offset of element.
+  /// @return  Reference to element.
+  T &b(size_t s, size_t i) { return b_[i * count_ + s]; }
+
+  /// Element of immutable right-hand side or solution.
+  /// @param s  Offset of system.
+  /// @param i  Offset of element.
+  /// @return  Element.
+  T b(size_t s, size_t i) const { return b_[i * count_ + s]; }
+
+  /// View of right-hand side or of solution of one system.  The view is
+  /// strided, because storage is SoA.
+  /// @param s  Offset of system.
+  /// @return  View of `N` elements.
+  v_iface<T, 0, v_view> rhs(size_t s) {
+    return w_vector_view_array(b_.data() + s, count_, N);
+  }
+
+  /// Pointer to matrices, stored as SoA.
+  /// @return  Pointer to first element.
+  T *a_data() { return a_.data(); }
+
+  /// Pointer to right-hand sides, stored as SoA.
+  /// @return  Pointer to first element.
+  T *b_data() { return b_.data(); }
+
+  /// Solve every system by Cholesky-decomposition, and replace each
+  /// right-hand side by solution.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Number of systems not positive definite.
+  size_t cholesky_solve(thread_pool &p= thread_pool::global()) {
+    return small_cholesky_solve<N>(a_.data(), b_.data(), count_, p);
+  }
+
+  /// Solve every system by LU-decomposition, and replace each right-hand
+  /// side by solution.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Number of singular systems.
+  size_t lu_solve(thread_pool &p= thread_pool::global()) {
+    return small_lu_solve<N>(a_.data(), b_.data(), count_, p);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,154 @@
+/// \file       include/gslcpp/linalg/small-kernel.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::small_kernel and gsl::small_lanes.
+
+#pragma once
+
+#include <cmath> // abs, sqrt
+#include <cstddef> // size_t
+
+namespace gsl {
+
+
+/// Number of small systems solved together by gsl::small_kernel.  Every loop
+/// of the kernel has the lanes innermost, and so the compiler can vectorize
+/// across systems without reordering any arithmetic within a system.
+constexpr size_t small_lanes= 8;
+
+
+/// Kernels for block of gsl::small_lanes independent linear systems, each
+/// with `N` unknowns.
+///
+/// Because `N` is a template-parameter, every loop over rows and columns has
+/// a bound known at compile-time and may be fully unrolled.  There is no
+/// branch that depends on the data; pivoting is done by conditional moves,
+/// lane by lane.
+///
+/// In every array, the last index is the lane (the offset of the system in
+/// the block).
+///
+/// \tparam N  Number of unknowns in each system.
+/// \tparam T  Type of each element, `double` or `float`.
+template<size_t N, typename T> struct small_kernel {
+  static_assert(N > 0);
+
+  /// Type of block of matrices.
+  using matrices= T[N][N][small_lanes];
+
+  /// Type of block of vectors.
+  using vectors= T[N][small_lanes];
+
+  /// Solve each symmetric, positive-definite system by Cholesky-
+  /// decomposition.  Only the lower triangle of each matrix is read.
+  /// @param m  On input, matrices; on output, factor L in lower triangle.
+  /// @param x  On input, right-hand sides; on output, solutions.
+  /// @return  Bit `l` is set if system `l` be not positive definite, in which
+  ///          case its solution is not finite.
+  static unsigned cholesky(matrices &m, vectors &x) {
+    vectors inv;
+    unsigned bad= 0;
+    T t[small_lanes]; // accumulator for each lane
+    for(size_t j= 0; j < N; ++j) {
+      for(size_t l= 0; l < small_lanes; ++l) t[l]= m[j][j][l];
+      for(size_t k= 0; k < j; ++k) {
+        for(size_t l= 0; l < small_lanes; ++l) t[l]-= m[j][k][l] * m[j][k][l];
+      }
+      for(size_t l= 0; l < small_lanes; ++l) {
+        bad|= unsigned(!(t[l] > T(0))) << l;
+        T const s= std::sqrt(t[l]);
+        m[j][j][l]= s;
+        inv[j][l]= T(1) / s;
+      }
+      for(size_t i= j + 1; i < N; ++i) {
+        for(size_t l= 0; l < small_lanes; ++l) t[l]= m[i][j][l];
+        for(size_t k= 0; k < j; ++k) {
+          for(size_t l= 0; l < small_lanes; ++l) {
+            t[l]-= m[i][k][l] * m[j][k][l];
+          }
+        }
+        for(size_t l= 0; l < small_lanes; ++l) m[i][j][l]= t[l] * inv[j][l];
+      }
+    }
+    for(size_t i= 0; i < N; ++i) {
+      for(size_t l= 0; l < small_lanes; ++l) t[l]= x[i][l];
+      for(size_t k= 0; k < i; ++k) {
+        for(size_t l= 0; l < small_lanes; ++l) t[l]-= m[i][k][l] * x[k][l];
+      }
+      for(size_t l= 0; l < small_lanes; ++l) x[i][l]= t[l] * inv[i][l];
+    }
+    for(size_t i= N; i-- > 0;) {
+      for(size_t l= 0; l < small_lanes; ++l) t[l]= x[i][l];
+      for(size_t k= i + 1; k < N; ++k) {
+        for(size_t l= 0; l < small_lanes; ++l) t[l]-= m[k][i][l] * x[k][l];
+      }
+      for(size_t l= 0; l < small_lanes; ++l) x[i][l]= t[l] * inv[i][l];
+    }
+    return bad;
+  }
+
+  /// Solve each system by Gaussian elimination with partial pivoting, which
+  /// is equivalent to LU-decomposition followed by substitution.
+  /// @param m  On input, matrices; on output, overwritten.
+  /// @param x  On input, right-hand sides; on output, solutions.
+  /// @return  Bit `l` is set if system `l` be singular, in which case its
+  ///          solution is not finite.
+  static unsigned lu(matrices &m, vectors &x) {
+    unsigned bad= 0;
+    T t[small_lanes]; // accumulator or factor for each lane
+    for(size_t k= 0; k < N; ++k) {
+      size_t piv[small_lanes];
+      for(size_t l= 0; l < small_lanes; ++l) {
+        piv[l]= k;
+        t[l]= std::abs(m[k][k][l]);
+      }
+      for(size_t r= k + 1; r < N; ++r) {
+        for(size_t l= 0; l < small_lanes; ++l) {
+          T const a= std::abs(m[r][k][l]);
+          piv[l]= (a > t[l] ? r : piv[l]);
+          t[l]= (a > t[l] ? a : t[l]);
+        }
+      }
+      for(size_t l= 0; l < small_lanes; ++l) {
+        bad|= unsigned(!(t[l] > T(0))) << l;
+      }
+      for(size_t r= k + 1; r < N; ++r) {
+        for(size_t c= k; c < N; ++c) {
+          for(size_t l= 0; l < small_lanes; ++l) {
+            bool const s= (piv[l] == r);
+            T const tk= m[k][c][l], tr= m[r][c][l];
+            m[k][c][l]= (s ? tr : tk);
+            m[r][c][l]= (s ? tk : tr);
+          }
+        }
+        for(size_t l= 0; l < small_lanes; ++l) {
+          bool const s= (piv[l] == r);
+          T const tk= x[k][l], tr= x[r][l];
+          x[k][l]= (s ? tr : tk);
+          x[r][l]= (s ? tk : tr);
+        }
+      }
+      for(size_t r= k + 1; r < N; ++r) {
+        for(size_t l= 0; l < small_lanes; ++l) t[l]= m[r][k][l] / m[k][k][l];
+        for(size_t c= k + 1; c < N; ++c) {
+          for(size_t l= 0; l < small_lanes; ++l) {
+            m[r][c][l]-= t[l] * m[k][c][l];
+          }
+        }
+        for(size_t l= 0; l < small_lanes; ++l) x[r][l]-= t[l] * x[k][l];
+      }
+    }
+    for(size_t i= N; i-- > 0;) {
+      for(size_t l= 0; l < small_lanes; ++l) t[l]= x[i][l];
+      for(size_t k= i + 1; k < N; ++k) {
+        for(size_t l= 0; l < small_lanes; ++l) t[l]-= m[i][k][l] * x[k][l];
+      }
+      for(size_t l= 0; l < small_lanes; ++l) x[i][l]= t[l] / m[i][i][l];
+    }
+    return bad;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,11 @@
+/// \file       include/gslcpp/monte.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for Monte Carlo integration.
+
+#pragma once
+
+#include "monte/function.hpp" // monte_integrand, monte_point
+#include "monte/plain.hpp" // monte_plain
+#include "monte/replicas.hpp" // monte_miser, monte_vegas
+
+// EOF
@@ -0,0 +1,58 @@
+/// \dir        include/gslcpp/monte
+/// \brief      Types and functions specific to Monte Carlo integration.
+
+/// \file       include/gslcpp/monte/function.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::monte_integrand and gsl::monte_point().
+
+#pragma once
+
+#include "../integ/function.hpp" // quad_result
+#include "../multimin/function.hpp" // point_view
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include <gsl/gsl_monte.h> // gsl_monte_function
+
+namespace gsl {
+
+
+/// View of point, passed to integrand, at which to evaluate.
+/// View refers directly to caller's storage; no element is copied.
+/// @param x  Pointer to first coordinate.
+/// @param dim  Number of dimensions.
+/// @return  View of `x`.
+inline point_view monte_point(double const *x, size_t dim) {
+  return w_vector_view_array(x, 1, dim);
+}
+
+
+/// Trampoline from GSL's gsl_monte_function to instance of `F`.
+///
+/// Because `F` is a template-parameter, the call from the trampoline into the
+/// integrand is direct and may be inlined.  The only indirect call is GSL's
+/// own call into the trampoline.
+///
+/// \tparam F  Type of callable with signature `double(point_view const &)`.
+template<typename F> struct monte_integrand {
+  /// Evaluate integrand.
+  /// @param x  Point at which to evaluate.
+  /// @param dim  Number of dimensions.
+  /// @param p  Pointer to instance of `F`.
+  /// @return  Value of integrand at `x`.
+  static double f(double *x, size_t dim, void *p) {
+    return (*static_cast<F *>(p))(monte_point(x, dim));
+  }
+
+  /// GSL's descriptor for integrand.
+  /// @param f  Reference to integrand, which must outlive descriptor.
+  /// @param dim  Number of dimensions.
+  /// @return  GSL's descriptor for integrand.
+  static gsl_monte_function function(F &f, size_t dim) {
+    void *const p= const_cast<void *>(static_cast<void const *>(&f));
+    return {&monte_integrand::f, dim, p};
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,135 @@
+/// \file       include/gslcpp/monte/plain.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::monte_plain.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../rng/v-fill.hpp" // ran_seed, rng
+#include "../stats/moments.hpp" // moments, stats_block
+#include "function.hpp" // monte_point, quad_result
+#include <algorithm> // min
+#include <cmath> // sqrt
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of calls to integrand in each independently seeded chunk of
+/// gsl::monte_plain::integrate().
+constexpr size_t monte_grain= 4096;
+
+
+/// Plain Monte Carlo integration over hyperrectangular region, with calls to
+/// integrand distributed over gsl::thread_pool.
+/// https://www.gnu.org/software/gsl/doc/html/montecarlo.html#plain-monte-carlo
+///
+/// The estimate and its error are those of `gsl_monte_plain_integrate()`, but
+/// the sampling is native, so that the calls can be split into chunks of
+/// gsl::monte_grain.  Chunk `k` draws from a generator seeded by
+/// gsl::ran_seed(`seed`, `k`), and the moments of the chunks are merged in
+/// order.  The result thus depends only on the arguments of integrate(), and
+/// not on the number of threads.
+///
+/// Each worker's generator and point are allocated once, at construction, and
+/// reused by every call to integrate().  The integrand must be safe to call
+/// from several threads at once.
+class monte_plain {
+  size_t dim_; ///< Number of dimensions.
+  thread_pool *p_; ///< Pool over which to distribute chunks.
+  std::vector<rng> g_; ///< Generator for each worker.
+  std::vector<double> x_; ///< Point for each worker, `dim_` per worker.
+
+  monte_plain(monte_plain const &)= delete; ///< Disable copying.
+  monte_plain &operator=(monte_plain const &)= delete; ///< Disable copying.
+
+public:
+  /// Allocate generator and point for each worker.
+  /// @param dim  Number of dimensions.
+  /// @param t  Algorithm for generation of random numbers.
+  /// @param p  Pool over which to distribute chunks.
+  explicit monte_plain(
+        size_t dim,
+        rng::type const *t= gsl_rng_mt19937,
+        thread_pool &p= thread_pool::global()):
+      dim_(dim), p_(&p), x_(dim * p.size()) {
+    g_.reserve(p.size());
+    for(unsigned w= 0; w < p.size(); ++w) g_.emplace_back(0, t);
+  }
+
+  /// Number of dimensions.
+  /// @return  Number of dimensions.
+  size_t dim() const { return dim_; }
+
+  /// Integrate over hyperrectangular region.
+  /// \tparam F  Type of callable with signature `double(point_view const &)`.
+  /// \tparam T  Type of element in vector of lower limits.
+  /// \tparam N  Compile-time number of lower limits.
+  /// \tparam V  Type of interface to storage of lower limits.
+  /// \tparam U  Type of element in vector of upper limits.
+  /// \tparam M  Compile-time number of upper limits.
+  /// \tparam W  Type of interface to storage of upper limits.
+  /// @param f  Integrand.
+  /// @param xl  Lower limit in each dimension.
+  /// @param xu  Upper limit in each dimension.
+  /// @param calls  Number of calls to integrand, at least two.
+  /// @param seed  Seed for whole integration.
+  /// @return  Estimate of integral, estimate of error, and number of calls.
+  template<
+        typename F,
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  quad_result integrate(
+        F const &f,
+        v_iface<T, N, V> const &xl,
+        v_iface<U, M, W> const &xu,
+        size_t calls,
+        unsigned long seed) {
+    if(xl.size() != dim_ || xu.size() != dim_) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    if(calls < 2) throw std::invalid_argument("too few calls");
+    std::vector<double> lo(dim_), dx(dim_);
+    double vol= 1.0;
+    for(size_t j= 0; j < dim_; ++j) {
+      lo[j]= double(xl[j]);
+      dx[j]= double(xu[j]) - lo[j];
+      vol*= dx[j];
+    }
+    std::vector<moments> part((calls + monte_grain - 1) / monte_grain);
+    p_->for_chunks(calls, monte_grain, [&](size_t b, size_t e, unsigned w) {
+      gsl_rng *const r= g_[w].r();
+      double *const x= x_.data() + w * dim_;
+      point_view const pv= monte_point(x, dim_);
+      gsl_rng_set(r, ran_seed(seed, b / monte_grain));
+      moments &m= part[b / monte_grain];
+      double buf[stats_block];
+      for(size_t i= b; i < e; i+= stats_block) {
+        size_t const k= std::min(stats_block, e - i);
+        for(size_t c= 0; c < k; ++c) {
+          for(size_t j= 0; j < dim_; ++j) {
+            x[j]= lo[j] + gsl_rng_uniform(r) * dx[j];
+          }
+          buf[c]= f(pv);
+        }
+        m.add(buf, k);
+      }
+    });
+    moments all;
+    for(moments const &m: part) all+= m;
+    double const err= vol * std::sqrt(all.variance() / double(calls));
+    return {0, vol * all.mean(), err, calls};
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
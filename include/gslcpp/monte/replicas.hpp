@@ -0,0 +1,256 @@
+/// \file       include/gslcpp/monte/replicas.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::monte_replicas, gsl::monte_miser, and
+///             gsl::monte_vegas.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../rng/v-fill.hpp" // ran_seed, rng
+#include "function.hpp" // monte_integrand, quad_result
+#include <cmath> // sqrt
+#include <gsl/gsl_monte_miser.h> // gsl_monte_miser_state, etc.
+#include <gsl/gsl_monte_vegas.h> // gsl_monte_vegas_state, etc.
+#include <memory> // unique_ptr
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Generic declaration of GSL's functions for state of Monte Carlo
+/// integration.
+/// \tparam S  Type of GSL's state.
+template<typename S> struct monte_traits;
+
+
+/// GSL's functions for state of MISER.
+template<> struct monte_traits<gsl_monte_miser_state> {
+  /// Type of GSL's state.
+  using state= gsl_monte_miser_state;
+
+  /// Type of GSL's parameters.
+  using params= gsl_monte_miser_params;
+
+  static constexpr auto alloc= gsl_monte_miser_alloc; ///< Allocate.
+  static constexpr auto init= gsl_monte_miser_init; ///< Reinitialize.
+  static constexpr auto free= gsl_monte_miser_free; ///< Deallocate.
+  static constexpr auto integrate= gsl_monte_miser_integrate; ///< Integrate.
+  static constexpr auto params_get= gsl_monte_miser_params_get; ///< Get.
+  static constexpr auto params_set= gsl_monte_miser_params_set; ///< Set.
+};
+
+
+/// GSL's functions for state of VEGAS.
+template<> struct monte_traits<gsl_monte_vegas_state> {
+  /// Type of GSL's state.
+  using state= gsl_monte_vegas_state;
+
+  /// Type of GSL's parameters.
+  using params= gsl_monte_vegas_params;
+
+  static constexpr auto alloc= gsl_monte_vegas_alloc; ///< Allocate.
+  static constexpr auto init= gsl_monte_vegas_init; ///< Reinitialize.
+  static constexpr auto free= gsl_monte_vegas_free; ///< Deallocate.
+  static constexpr auto integrate= gsl_monte_vegas_integrate; ///< Integrate.
+  static constexpr auto params_get= gsl_monte_vegas_params_get; ///< Get.
+  static constexpr auto params_set= gsl_monte_vegas_params_set; ///< Set.
+};
+
+
+/// Independent replicas of GSL's adaptive Monte Carlo integration (MISER or
+/// VEGAS), run in parallel over gsl::thread_pool.
+///
+/// GSL's MISER and VEGAS call the integrand serially from inside their own
+/// adaptive loops, and so the calls of a single run cannot be spread over
+/// threads without changing the algorithm.  Instead, each of `R` replicas has
+/// its own state and its own generator, and integrate() runs every replica on
+/// about `calls/R` calls at once.  The estimates of the replicas are combined,
+/// in order of replica, by weighting each with the inverse of its variance.
+///
+/// Replica `k` has its generator seeded by gsl::ran_seed(`seed`, `k`), and
+/// so the result depends on the seed and on the number of replicas, but not
+/// on the number of threads.  The number of replicas is therefore given
+/// explicitly rather than taken from the pool.
+///
+/// Each state and generator persists between calls to integrate(), until
+/// init() is called.  By GSL's default (`stage` equal to zero), VEGAS starts
+/// from a uniform grid on every call; to refine the grid of the previous call
+/// instead, set `stage` to one by set_params().
+///
+/// The integrand must be safe to call from several threads at once.
+///
+/// \tparam S  Type of GSL's state, `gsl_monte_miser_state` or
+///            `gsl_monte_vegas_state`.
+template<typename S> class monte_replicas {
+  using traits= monte_traits<S>; ///< GSL's functions for state.
+
+  /// Function-object that free state.
+  struct deleter {
+    /// Free state.
+    /// @param s  Pointer to state.
+    void operator()(S *s) const { traits::free(s); }
+  };
+
+  size_t dim_; ///< Number of dimensions.
+  thread_pool *p_; ///< Pool over which to distribute replicas.
+  std::vector<std::unique_ptr<S, deleter>> s_; ///< State of each replica.
+  std::vector<rng> g_; ///< Generator of each replica.
+
+  monte_replicas(monte_replicas const &)= delete; ///< Disable copying.
+  monte_replicas &operator=(monte_replicas const &)= delete; ///< Disable.
+
+public:
+  /// Type of GSL's parameters.
+  using params_type= typename traits::params;
+
+  /// Allocate state and generator for each replica.
+  /// @param dim  Number of dimensions.
+  /// @param replicas  Number of replicas.
+  /// @param seed  Seed for whole sequence of integrations.
+  /// @param t  Algorithm for generation of random numbers.
+  /// @param p  Pool over which to distribute replicas.
+  explicit monte_replicas(
+        size_t dim,
+        size_t replicas,
+        unsigned long seed= 0,
+        rng::type const *t= gsl_rng_mt19937,
+        thread_pool &p= thread_pool::global()):
+      dim_(dim), p_(&p) {
+    if(replicas == 0) throw std::invalid_argument("no replica");
+    s_.reserve(replicas);
+    g_.reserve(replicas);
+    for(size_t k= 0; k < replicas; ++k) {
+      s_.emplace_back(traits::alloc(dim));
+      g_.emplace_back(ran_seed(seed, k), t);
+    }
+  }
+
+  /// Number of dimensions.
+  /// @return  Number of dimensions.
+  size_t dim() const { return dim_; }
+
+  /// Number of replicas.
+  /// @return  Number of replicas.
+  size_t replicas() const { return s_.size(); }
+
+  /// Reinitialize every state, and reseed every generator.
+  /// @param seed  Seed for whole sequence of integrations.
+  void init(unsigned long seed) {
+    for(size_t k= 0; k < s_.size(); ++k) {
+      traits::init(s_[k].get());
+      g_[k].set(ran_seed(seed, k));
+    }
+  }
+
+  /// Parameters of first replica.
+  /// @return  Parameters.
+  params_type params() const {
+    params_type q;
+    traits::params_get(s_[0].get(), &q);
+    return q;
+  }
+
+  /// Set parameters of every replica.
+  /// @param q  Parameters.
+  void set_params(params_type const &q) {
+    for(auto &s: s_) traits::params_set(s.get(), &q);
+  }
+
+  /// Pointer to GSL's state of replica, for direct access.
+  /// @param k  Offset of replica.
+  /// @return  Pointer to state.
+  S *state(size_t k) const { return s_[k].get(); }
+
+  /// Integrate over hyperrectangular region.
+  /// \tparam F  Type of callable with signature `double(point_view const &)`.
+  /// \tparam T  Type of element in vector of lower limits.
+  /// \tparam N  Compile-time number of lower limits.
+  /// \tparam V  Type of interface to storage of lower limits.
+  /// \tparam U  Type of element in vector of upper limits.
+  /// \tparam M  Compile-time number of upper limits.
+  /// \tparam W  Type of interface to storage of upper limits.
+  /// @param f  Integrand.
+  /// @param xl  Lower limit in each dimension.
+  /// @param xu  Upper limit in each dimension.
+  /// @param calls  Total number of calls to integrand, over all replicas.
+  /// @return  Combined estimate of integral and of error, first nonzero
+  ///          status of any replica, and number of calls.
+  template<
+        typename F,
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename U,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  quad_result integrate(
+        F const &f,
+        v_iface<T, N, V> const &xl,
+        v_iface<U, M, W> const &xu,
+        size_t calls) {
+    if(xl.size() != dim_ || xu.size() != dim_) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    size_t const r= s_.size();
+    std::vector<double> lo(dim_), hi(dim_);
+    for(size_t j= 0; j < dim_; ++j) {
+      lo[j]= double(xl[j]);
+      hi[j]= double(xu[j]);
+    }
+    // Wrapping `f` in a lambda admits a plain function as well.
+    auto const g= [&f](point_view const &x) { return f(x); };
+    using G= decltype(g);
+    std::vector<int> status(r);
+    std::vector<double> value(r), err(r);
+    p_->for_each(r, [&](size_t k, unsigned) {
+      gsl_monte_function fn= monte_integrand<G>::function(g, dim_);
+      size_t const c= calls / r + (k < calls % r);
+      status[k]= traits::integrate(
+            &fn, lo.data(), hi.data(), dim_, c, g_[k].r(), s_[k].get(),
+            &value[k], &err[k]);
+    });
+    quad_result q{0, 0.0, 0.0, calls};
+    for(int s: status) {
+      if(s) {
+        q.status= s;
+        break;
+      }
+    }
+    double sw= 0.0, swv= 0.0, se2= 0.0, sv= 0.0;
+    bool exact= false;
+    for(size_t k= 0; k < r; ++k) {
+      exact|= (err[k] == 0.0);
+      double const w= 1.0 / (err[k] * err[k]);
+      sw+= w;
+      swv+= w * value[k];
+      se2+= err[k] * err[k];
+      sv+= value[k];
+    }
+    if(exact) {
+      q.value= sv / double(r);
+      q.abserr= std::sqrt(se2) / double(r);
+    } else {
+      q.value= swv / sw;
+      q.abserr= 1.0 / std::sqrt(sw);
+    }
+    return q;
+  }
+};
+
+
+/// Parallel replicas of MISER.
+/// https://www.gnu.org/software/gsl/doc/html/montecarlo.html#miser
+using monte_miser= monte_replicas<gsl_monte_miser_state>;
+
+
+/// Parallel replicas of VEGAS.
+/// https://www.gnu.org/software/gsl/doc/html/montecarlo.html#vegas
+using monte_vegas= monte_replicas<gsl_monte_vegas_state>;
+
+
+} // namespace gsl
+
+// EOF
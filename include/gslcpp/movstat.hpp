@@ -0,0 +1,10 @@
+/// \file       include/gslcpp/movstat.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for moving-window statistics.
+
+#pragma once
+
+#include "movstat/kernels.hpp" // window_sum, window_min, etc.
+#include "movstat/movstat.hpp" // movstat
+
+// EOF
@@ -0,0 +1,266 @@
+/// \dir        include/gslcpp/movstat
+/// \brief      Types and functions specific to moving-window statistics.
+
+/// \file       include/gslcpp/movstat/kernels.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::window_sum, gsl::window_extremum, and
+///             gsl::window_median.
+
+#pragma once
+
+#include <cstddef> // ptrdiff_t
+#include <functional> // greater, less
+#include <vector> // vector
+
+namespace gsl {
+
+
+// Each kernel maintains a statistic over a sliding window.  `push(j, x)`
+// adds sample `x` with offset `j`, and `pop(j, x)` removes sample `x` with
+// offset `j`, which is always the oldest sample in the window.  The capacity
+// of a kernel is the largest number of samples in the window.
+
+
+/// Sum and mean over sliding window, with O(1) cost per step.
+class window_sum {
+  double s_= 0.0; ///< Sum of samples in window.
+  size_t n_= 0; ///< Number of samples in window.
+
+public:
+  /// Initialize empty window.  No storage depends on capacity.
+  explicit window_sum(size_t= 0) {}
+
+  /// Add sample.
+  /// @param x  Value of sample.
+  void push(ptrdiff_t, double x) {
+    s_+= x;
+    ++n_;
+  }
+
+  /// Remove oldest sample.
+  /// @param x  Value of sample.
+  void pop(ptrdiff_t, double x) {
+    s_-= x;
+    --n_;
+  }
+
+  /// Sum of samples in window.
+  /// @return  Sum.
+  double sum() const { return s_; }
+
+  /// Mean of samples in window.
+  /// @return  Mean.
+  double mean() const { return s_ / double(n_); }
+};
+
+
+/// Minimum (or maximum) over sliding window by monotonic deque, with O(1)
+/// amortized cost per step.
+///
+/// The deque holds, in order of offset, each sample that is less (for `C` as
+/// `std::less`) than every later sample in the window.  The front of the
+/// deque is thus the extremum.  Storage is a ring-buffer of fixed capacity.
+///
+/// \tparam C  `std::less<double>` for minimum, or `std::greater<double>` for
+///            maximum.
+template<typename C> class window_extremum {
+  /// Sample in deque.
+  struct entry {
+    ptrdiff_t j; ///< Offset of sample.
+    double x; ///< Value of sample.
+  };
+
+  std::vector<entry> ring_; ///< Storage for deque.
+  size_t head_= 0; ///< Offset in ring of front of deque.
+  size_t size_= 0; ///< Number of entries in deque.
+
+  /// Entry at offset in deque.
+  /// @param i  Offset from front of deque.
+  /// @return  Reference to entry.
+  entry &at(size_t i) { return ring_[(head_ + i) % ring_.size()]; }
+
+public:
+  /// Allocate storage.
+  /// @param k  Capacity of window.
+  explicit window_extremum(size_t k): ring_(k) {}
+
+  /// Add sample.
+  /// @param j  Offset of sample.
+  /// @param x  Value of sample.
+  void push(ptrdiff_t j, double x) {
+    while(size_ > 0 && !C()(at(size_ - 1).x, x)) --size_;
+    at(size_++)= {j, x};
+  }
+
+  /// Remove oldest sample.
+  /// @param j  Offset of sample.
+  void pop(ptrdiff_t j, double) {
+    if(size_ > 0 && ring_[head_].j == j) {
+      head_= (head_ + 1) % ring_.size();
+      --size_;
+    }
+  }
+
+  /// Extremum of samples in window.
+  /// @return  Extremum.
+  double get() const { return ring_[head_].x; }
+};
+
+
+/// Minimum over sliding window.
+using window_min= window_extremum<std::less<double>>;
+
+/// Maximum over sliding window.
+using window_max= window_extremum<std::greater<double>>;
+
+
+/// Median over sliding window by two indexed heaps, with O(log k) cost per
+/// step.
+///
+/// The lower half of the window is in a max-heap, and the upper half is in a
+/// min-heap.  Each sample occupies a slot determined by its offset modulo the
+/// capacity, and each slot records its position in its heap, so that the
+/// oldest sample is removed directly rather than lazily.  Storage is fixed at
+/// construction.
+class window_median {
+  size_t k_; ///< Capacity.
+  std::vector<double> val_; ///< Value in each slot.
+  std::vector<ptrdiff_t> pos_; ///< Position of slot: `i` in lower heap, or
+                               ///< `-1 - i` in upper heap.
+  std::vector<size_t> lo_; ///< Max-heap of slots in lower half.
+  std::vector<size_t> hi_; ///< Min-heap of slots in upper half.
+
+  /// Slot for sample.
+  /// @param j  Offset of sample.
+  /// @return  Slot.
+  size_t slot(ptrdiff_t j) const {
+    ptrdiff_t const k= ptrdiff_t(k_);
+    return size_t((j % k + k) % k);
+  }
+
+  /// True if slot `a` belong above slot `b` in heap.
+  /// @param h  Heap.
+  /// @param a  First slot.
+  /// @param b  Second slot.
+  /// @return  True if `a` belong above `b`.
+  bool before(std::vector<size_t> const &h, size_t a, size_t b) const {
+    return (&h == &lo_) ? val_[a] > val_[b] : val_[a] < val_[b];
+  }
+
+  /// Store slot at position in heap.
+  /// @param h  Heap.
+  /// @param i  Position.
+  /// @param s  Slot.
+  void place(std::vector<size_t> &h, size_t i, size_t s) {
+    h[i]= s;
+    pos_[s]= (&h == &lo_) ? ptrdiff_t(i) : -1 - ptrdiff_t(i);
+  }
+
+  /// Restore heap by moving slot at position `i` toward root.
+  /// @param h  Heap.
+  /// @param i  Position.
+  void up(std::vector<size_t> &h, size_t i) {
+    size_t const s= h[i];
+    for(; i > 0; i= (i - 1) / 2) {
+      size_t const p= h[(i - 1) / 2];
+      if(!before(h, s, p)) break;
+      place(h, i, p);
+    }
+    place(h, i, s);
+  }
+
+  /// Restore heap by moving slot at position `i` toward leaves.
+  /// @param h  Heap.
+  /// @param i  Position.
+  void down(std::vector<size_t> &h, size_t i) {
+    size_t const s= h[i], n= h.size();
+    for(size_t c; (c= 2 * i + 1) < n; i= c) {
+      if(c + 1 < n && before(h, h[c + 1], h[c])) ++c;
+      if(!before(h, h[c], s)) break;
+      place(h, i, h[c]);
+    }
+    place(h, i, s);
+  }
+
+  /// Insert slot into heap.
+  /// @param h  Heap.
+  /// @param s  Slot.
+  void insert(std::vector<size_t> &h, size_t s) {
+    h.push_back(s);
+    up(h, h.size() - 1);
+  }
+
+  /// Remove slot at position `i` from heap.
+  /// @param h  Heap.
+  /// @param i  Position.
+  /// @return  Removed slot.
+  size_t erase(std::vector<size_t> &h, size_t i) {
+    size_t const s= h[i], last= h.back();
+    h.pop_back();
+    if(i < h.size()) {
+      place(h, i, last);
+      if(i > 0 && before(h, last, h[(i - 1) / 2])) {
+        up(h, i);
+      } else {
+        down(h, i);
+      }
+    }
+    return s;
+  }
+
+  /// Restore balance of sizes of heaps.
+  void balance() {
+    if(lo_.size() > hi_.size() + 1) {
+      insert(hi_, erase(lo_, 0));
+    } else if(hi_.size() > lo_.size()) {
+      insert(lo_, erase(hi_, 0));
+    }
+  }
+
+public:
+  /// Allocate storage.
+  /// @param k  Capacity of window.
+  explicit window_median(size_t k): k_(k), val_(k), pos_(k) {
+    lo_.reserve(k / 2 + 1);
+    hi_.reserve(k / 2 + 1);
+  }
+
+  /// Add sample.
+  /// @param j  Offset of sample.
+  /// @param x  Value of sample.
+  void push(ptrdiff_t j, double x) {
+    size_t const s= slot(j);
+    val_[s]= x;
+    if(lo_.empty() || x <= val_[lo_[0]]) {
+      insert(lo_, s);
+    } else {
+      insert(hi_, s);
+    }
+    balance();
+  }
+
+  /// Remove oldest sample.
+  /// @param j  Offset of sample.
+  void pop(ptrdiff_t j, double) {
+    ptrdiff_t const p= pos_[slot(j)];
+    if(p >= 0) {
+      erase(lo_, size_t(p));
+    } else {
+      erase(hi_, size_t(-1 - p));
+    }
+    balance();
+  }
+
+  /// Median of samples in window, as mean of two middle samples if number
+  /// of samples be even.
+  /// @return  Median.
+  double get() const {
+    if(lo_.size() > hi_.size()) return val_[lo_[0]];
+    return 0.5 * (val_[lo_[0]] + val_[hi_[0]]);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,561 @@
+/// \file       include/gslcpp/movstat/movstat.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::movstat.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/vector-view-array.hpp" // w_vector_view_array
+#include "kernels.hpp" // window_sum, window_min, window_max, window_median
+#include <algorithm> // max, min
+#include <gsl/gsl_movstat.h> // gsl_movstat_workspace, etc.
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Moving-window statistics over vector, in parallel.
+///
+/// The window for output `y[i]` is `x[i - h]` through `x[i + j]`.  Near
+/// either end of `x`, the window is padded with zero
+/// (`GSL_MOVSTAT_END_PADZERO`), padded with the end-value
+/// (`GSL_MOVSTAT_END_PADVALUE`), or truncated (`GSL_MOVSTAT_END_TRUNCATE`), as
+/// in GSL's `gsl_movstat`.
+///
+/// The output is split into chunks of fixed size, and each chunk is computed
+/// by one worker of a gsl::thread_pool from the chunk of input extended by
+/// `h` samples before and `j` samples after.  Because the boundaries of the
+/// chunks depend only on the length of the vector and on the window, the
+/// result does not depend on the number of threads.
+///
+/// - mean(), sum(), min(), max(), minmax(), and median() use native kernels:
+///   a running sum, a monotonic deque (gsl::window_extremum), and two indexed
+///   heaps (gsl::window_median).
+///
+/// - variance(), sd(), mad(), mad0(), qqr(), Sn(), and Qn() call the
+///   corresponding function in `gsl_movstat` on each extended chunk.  One GSL
+///   workspace for each worker is allocated on construction and reused.
+class movstat {
+  using end_type= gsl_movstat_end_t; ///< Treatment of ends of input.
+
+  size_t h_; ///< Number of samples before current sample in window.
+  size_t j_; ///< Number of samples after current sample in window.
+  end_type end_; ///< Treatment of ends of input.
+  thread_pool *pool_; ///< Pool over which to distribute chunks.
+  std::vector<gsl_movstat_workspace *> w_; ///< GSL's workspace per worker.
+  std::vector<std::vector<double>> out_; ///< Scratch output per worker.
+
+  movstat(movstat const &)= delete; ///< Disable copying.
+  movstat &operator=(movstat const &)= delete; ///< Disable copying.
+
+  /// Number of outputs in each chunk.
+  /// @return  Number of outputs in each chunk.
+  size_t grain() const {
+    return std::max(size_t(1) << 16, 8 * (h_ + j_ + 1));
+  }
+
+  /// Check that sizes of input and output agree.
+  /// @param n  Size of input.
+  /// @param m  Size of output.
+  static void check(size_t n, size_t m) {
+    if(n != m) throw std::invalid_argument("mismatch in size");
+  }
+
+  /// Slide kernel over each chunk of input, and emit result at each step.
+  /// \tparam K  Type of kernel.
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam E  Type of function `e(i, k)` that emit result for output `i`.
+  /// @param x  Input.
+  /// @param e  Function that emit result.
+  template<
+        typename K,
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename E>
+  void slide(v_iface<T, N, V> const &x, E &&e) const {
+    size_t const n= x.size(), s= x.v()->stride;
+    if(n == 0) return;
+    auto const *const d= x.data();
+    ptrdiff_t const h= ptrdiff_t(h_), j= ptrdiff_t(j_), nn= ptrdiff_t(n);
+    bool const trunc= (end_ == GSL_MOVSTAT_END_TRUNCATE);
+    bool const zero= (end_ == GSL_MOVSTAT_END_PADZERO);
+    double const first= zero ? 0.0 : double(d[0]);
+    double const last= zero ? 0.0 : double(d[(n - 1) * s]);
+    auto const valid= [=](ptrdiff_t i) {
+      return !trunc || (i >= 0 && i < nn);
+    };
+    auto const value= [=](ptrdiff_t i) {
+      return i < 0 ? first : (i >= nn ? last : double(d[i * s]));
+    };
+    pool_->for_chunks(n, grain(), [&](size_t b, size_t f, unsigned) {
+      K k(h_ + j_ + 1);
+      ptrdiff_t const pb= ptrdiff_t(b);
+      for(ptrdiff_t i= pb - h; i <= pb + j; ++i) {
+        if(valid(i)) k.push(i, value(i));
+      }
+      e(b, k);
+      for(ptrdiff_t i= pb + 1; i < ptrdiff_t(f); ++i) {
+        ptrdiff_t const o= i - 1 - h, w= i + j;
+        if(valid(o)) k.pop(o, value(o));
+        if(valid(w)) k.push(w, value(w));
+        e(size_t(i), k);
+      }
+    });
+  }
+
+  /// Call function in `gsl_movstat` on each extended chunk of input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam F  Type of function `f(x, y1, y2, w)`.
+  /// \tparam Y1  Type of first output.
+  /// \tparam Y2  Type of second output.
+  /// @param x  Input.
+  /// @param f  Function that call `gsl_movstat` with input `x`, first
+  ///           output `y1`, second output `y2`, and workspace `w`.
+  /// @param y1  First output.
+  /// @param y2  Pointer to second output, or null.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename F,
+        typename Y1,
+        typename Y2>
+  int chunked(v_iface<double, N, V> const &x, F &&f, Y1 &y1, Y2 *y2) {
+    size_t const n= x.size(), g= grain();
+    check(n, y1.size());
+    if(y2) check(n, y2->size());
+    std::vector<int> status(w_.size(), GSL_SUCCESS);
+    pool_->for_chunks(n, g, [&](size_t b, size_t e, unsigned w) {
+      size_t const lo= (b > h_ ? b - h_ : 0), hi= std::min(n, e + j_);
+      size_t const m= hi - lo;
+      std::vector<double> &out= out_[w];
+      out.resize(2 * (g + h_ + j_));
+      auto xv= x.subvector(m, lo);
+      auto o1= w_vector_view_array(out.data(), 1, m);
+      auto o2= w_vector_view_array(out.data() + m, 1, m);
+      int const r= f(xv.v(), &o1.vector, &o2.vector, w_[w]);
+      if(r != GSL_SUCCESS) status[w]= r;
+      for(size_t i= b; i < e; ++i) y1[i]= out[i - lo];
+      if(y2) {
+        for(size_t i= b; i < e; ++i) (*y2)[i]= out[m + i - lo];
+      }
+    });
+    for(int r: status) {
+      if(r != GSL_SUCCESS) return r;
+    }
+    return GSL_SUCCESS;
+  }
+
+  /// Call function in `gsl_movstat` with single output.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// \tparam F  Type of function in `gsl_movstat`.
+  /// @param f  Function in `gsl_movstat`.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY,
+        typename F>
+  int chunked1(
+        F *f, v_iface<double, N, V> const &x, v_iface<double, NY, VY> &y) {
+    end_type const e= end_;
+    return chunked(
+          x,
+          [e, f](auto xv, auto o1, auto, auto w) { return f(e, xv, o1, w); },
+          y,
+          (v_iface<double, NY, VY> *)nullptr);
+  }
+
+public:
+  /// Allocate workspaces for window that is not necessarily symmetric.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_alloc2
+  /// @param h  Number of samples before current sample in window.
+  /// @param j  Number of samples after current sample in window.
+  /// @param e  Treatment of ends of input.
+  /// @param p  Pool over which to distribute chunks.
+  movstat(size_t h,
+          size_t j,
+          end_type e= GSL_MOVSTAT_END_PADVALUE,
+          thread_pool &p= thread_pool::global()):
+      h_(h), j_(j), end_(e), pool_(&p), w_(p.size()), out_(p.size()) {
+    for(auto &w: w_) w= gsl_movstat_alloc2(h, j);
+  }
+
+  /// Allocate workspaces for symmetric window of `k` samples, with
+  /// `k / 2` samples on each side of current sample.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_alloc
+  /// @param k  Number of samples in window.
+  /// @param e  Treatment of ends of input.
+  /// @param p  Pool over which to distribute chunks.
+  explicit movstat(
+        size_t k,
+        end_type e= GSL_MOVSTAT_END_PADVALUE,
+        thread_pool &p= thread_pool::global()):
+      movstat(k / 2, k / 2, e, p) {}
+
+  /// Deallocate workspaces.
+  ~movstat() {
+    for(auto w: w_) gsl_movstat_free(w);
+  }
+
+  /// Number of samples before current sample in window.
+  /// @return  Number of samples before current sample.
+  size_t h() const { return h_; }
+
+  /// Number of samples after current sample in window.
+  /// @return  Number of samples after current sample.
+  size_t j() const { return j_; }
+
+  /// Moving mean.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_mean
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  void mean(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) const {
+    check(x.size(), y.size());
+    slide<window_sum>(x, [&](size_t i, window_sum const &k) {
+      y[i]= k.mean();
+    });
+  }
+
+  /// Moving sum.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_sum
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  void sum(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) const {
+    check(x.size(), y.size());
+    slide<window_sum>(x, [&](size_t i, window_sum const &k) {
+      y[i]= k.sum();
+    });
+  }
+
+  /// Moving minimum.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_min
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  void min(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) const {
+    check(x.size(), y.size());
+    slide<window_min>(x, [&](size_t i, window_min const &k) {
+      y[i]= k.get();
+    });
+  }
+
+  /// Moving maximum.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_max
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  void max(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) const {
+    check(x.size(), y.size());
+    slide<window_max>(x, [&](size_t i, window_max const &k) {
+      y[i]= k.get();
+    });
+  }
+
+  /// Moving minimum and maximum.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_minmax
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam N1  Compile-time number of elements in output of minimum.
+  /// \tparam N2  Compile-time number of elements in output of maximum.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam V1  Type of interface to storage for output of minimum.
+  /// \tparam V2  Type of interface to storage for output of maximum.
+  /// @param x  Input.
+  /// @param ymin  Output of minimum.
+  /// @param ymax  Output of maximum.
+  template<
+        typename T,
+        size_t N,
+        size_t N1,
+        size_t N2,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class V1,
+        template<typename, size_t>
+        class V2>
+  void minmax(
+        v_iface<T, N, V> const &x,
+        v_iface<double, N1, V1> &ymin,
+        v_iface<double, N2, V2> &ymax) const {
+    min(x, ymin);
+    max(x, ymax);
+  }
+
+  /// Moving median.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_median
+  /// \tparam T  Type of element in input.
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  template<
+        typename T,
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  void median(v_iface<T, N, V> const &x, v_iface<double, NY, VY> &y) const {
+    check(x.size(), y.size());
+    slide<window_median>(
+          x, [&](size_t i, window_median const &k) { y[i]= k.get(); });
+  }
+
+  /// Moving variance.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_variance
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int variance(v_iface<double, N, V> const &x, v_iface<double, NY, VY> &y) {
+    return chunked1(gsl_movstat_variance, x, y);
+  }
+
+  /// Moving standard deviation.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_sd
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int sd(v_iface<double, N, V> const &x, v_iface<double, NY, VY> &y) {
+    return chunked1(gsl_movstat_sd, x, y);
+  }
+
+  /// Moving median absolute deviation, scaled to be unbiased estimate of
+  /// standard deviation for Gaussian data.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_mad
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NM  Compile-time number of elements in output of median.
+  /// \tparam NY  Compile-time number of elements in output of deviation.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VM  Type of interface to storage for output of median.
+  /// \tparam VY  Type of interface to storage for output of deviation.
+  /// @param x  Input.
+  /// @param xmedian  Output of median.
+  /// @param xmad  Output of median absolute deviation.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NM,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VM,
+        template<typename, size_t>
+        class VY>
+  int mad(v_iface<double, N, V> const &x,
+          v_iface<double, NM, VM> &xmedian,
+          v_iface<double, NY, VY> &xmad) {
+    end_type const e= end_;
+    return chunked(
+          x,
+          [e](auto xv, auto o1, auto o2, auto w) {
+            return gsl_movstat_mad(e, xv, o1, o2, w);
+          },
+          xmedian,
+          &xmad);
+  }
+
+  /// Moving median absolute deviation, not scaled.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_mad0
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NM  Compile-time number of elements in output of median.
+  /// \tparam NY  Compile-time number of elements in output of deviation.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VM  Type of interface to storage for output of median.
+  /// \tparam VY  Type of interface to storage for output of deviation.
+  /// @param x  Input.
+  /// @param xmedian  Output of median.
+  /// @param xmad  Output of median absolute deviation.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NM,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VM,
+        template<typename, size_t>
+        class VY>
+  int mad0(
+        v_iface<double, N, V> const &x,
+        v_iface<double, NM, VM> &xmedian,
+        v_iface<double, NY, VY> &xmad) {
+    end_type const e= end_;
+    return chunked(
+          x,
+          [e](auto xv, auto o1, auto o2, auto w) {
+            return gsl_movstat_mad0(e, xv, o1, o2, w);
+          },
+          xmedian,
+          &xmad);
+  }
+
+  /// Moving quantile range, `Q(1 - q) - Q(q)`.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_qqr
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param q  Fraction in `[0, 0.5]`.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int qqr(v_iface<double, N, V> const &x,
+          double q,
+          v_iface<double, NY, VY> &y) {
+    end_type const e= end_;
+    return chunked(
+          x,
+          [e, q](auto xv, auto o1, auto, auto w) {
+            return gsl_movstat_qqr(e, xv, q, o1, w);
+          },
+          y,
+          (v_iface<double, NY, VY> *)nullptr);
+  }
+
+  /// Moving robust scale-estimate of Rousseeuw and Croux, S_n.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_Sn
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int Sn(v_iface<double, N, V> const &x, v_iface<double, NY, VY> &y) {
+    return chunked1(gsl_movstat_Sn, x, y);
+  }
+
+  /// Moving robust scale-estimate of Rousseeuw and Croux, Q_n.
+  /// https://www.gnu.org/software/gsl/doc/html/movstat.html#c.gsl_movstat_Qn
+  /// \tparam N  Compile-time number of elements in input.
+  /// \tparam NY  Compile-time number of elements in output.
+  /// \tparam V  Type of interface to storage for input.
+  /// \tparam VY  Type of interface to storage for output.
+  /// @param x  Input.
+  /// @param y  Output.
+  /// @return  Zero only on success.
+  template<
+        size_t N,
+        size_t NY,
+        template<typename, size_t>
+        class V,
+        template<typename, size_t>
+        class VY>
+  int Qn(v_iface<double, N, V> const &x, v_iface<double, NY, VY> &y) {
+    return chunked1(gsl_movstat_Qn, x, y);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
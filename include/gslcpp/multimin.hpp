@@ -0,0 +1,12 @@
+/// \file       include/gslcpp/multimin.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for multidimensional minimization.
+
+#pragma once
+
+#include "multimin/batch.hpp" // batch_minimizer
+#include "multimin/f-minimizer.hpp" // f_minimizer
+#include "multimin/fd-gradient.hpp" // fd_gradient
+#include "multimin/fdf-minimizer.hpp" // fdf_minimizer
+
+// EOF
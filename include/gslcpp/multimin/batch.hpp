@@ -0,0 +1,111 @@
+/// \file       include/gslcpp/multimin/batch.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::batch_minimizer.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "function.hpp" // min_result
+#include <chrono> // steady_clock
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Outcome of one minimization in batch.
+struct batch_result: public min_result {
+  double seconds; ///< Elapsed wall-clock time for this minimization.
+};
+
+
+/// Minimizer of many independent problems, distributed over thread-pool.
+///
+/// One minimizer of type `M` (gsl::fdf_minimizer or gsl::f_minimizer) is
+/// allocated per worker on construction and is reused for every problem that
+/// the worker solves, so that no solve allocates memory.
+///
+/// \tparam M  Type of minimizer for single problem.
+template<typename M> class batch_minimizer {
+  thread_pool &pool_; ///< Pool over which to distribute problems.
+  std::vector<M> m_; ///< One minimizer per worker.
+
+public:
+  /// Type of algorithm for minimization.
+  using type= typename M::type;
+
+  /// Allocate one minimizer per worker.
+  /// @param n  Number of dimensions in each problem.
+  /// @param t  Algorithm for minimization.
+  /// @param p  Pool over which to distribute problems.
+  batch_minimizer(
+        size_t n, type const *t, thread_pool &p= thread_pool::global()):
+      pool_(p) {
+    m_.reserve(p.size());
+    for(unsigned i= 0; i < p.size(); ++i) m_.emplace_back(n, t);
+  }
+
+  /// Allocate one minimizer per worker, each with default algorithm.
+  /// @param n  Number of dimensions in each problem.
+  /// @param p  Pool over which to distribute problems.
+  batch_minimizer(size_t n, thread_pool &p= thread_pool::global()): pool_(p) {
+    m_.reserve(p.size());
+    for(unsigned i= 0; i < p.size(); ++i) m_.emplace_back(n);
+  }
+
+  /// Number of dimensions in each problem.
+  /// @return  Number of dimensions in each problem.
+  size_t size() const { return m_.front().size(); }
+
+  /// Minimize every problem in batch.
+  ///
+  /// Starting points are packed end to end in `x`, so that problem `i`
+  /// occupies elements `[i*size(), (i+1)*size())`.  On return, each problem's
+  /// portion of `x` contains the location of its minimum.
+  ///
+  /// `make(i)` is called on the worker that solves problem `i`, and it returns
+  /// (by value) the objective for problem `i`.  The objective lives only for
+  /// the duration of that solve.
+  ///
+  /// \tparam F  Type of factory for objectives.
+  /// \tparam N  Compile-time number of elements in `x`.
+  /// \tparam V  Type of interface to storage for `x`.
+  /// \tparam A  Types of further arguments to M::minimize().
+  /// @param make  Factory, callable as `make(size_t i)`.
+  /// @param x  Starting points on entry; locations of minima on return.
+  /// @param epsabs  Tolerance for convergence.
+  /// @param max_iter  Maximum number of iterations for each problem.
+  /// @param a  Further arguments to M::minimize().
+  /// @return  Outcome for each problem, in order.
+  template<
+        typename F,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        typename... A>
+  std::vector<batch_result> minimize(
+        F &&make,
+        v_iface<double, N, V> &x,
+        double epsabs,
+        size_t max_iter,
+        A const &...a) {
+    size_t const n= size();
+    if(x.size() % n) throw std::invalid_argument("x.size() % size() != 0");
+    std::vector<batch_result> r(x.size() / n);
+    pool_.for_each(r.size(), [&](size_t i, unsigned w) {
+      using clock= std::chrono::steady_clock;
+      auto const t0= clock::now();
+      auto xi= x.subvector(n, i * n);
+      auto f= make(i);
+      min_result const ri= m_[w].minimize(f, xi, epsabs, max_iter, a...);
+      std::chrono::duration<double> const dt= clock::now() - t0;
+      r[i]= {ri, dt.count()};
+    });
+    return r;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,167 @@
+/// \file       include/gslcpp/multimin/f-minimizer.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::f_minimizer.
+
+#pragma once
+
+#include "../vector.hpp" // vector
+#include "../wrap/memcpy.hpp" // w_memcpy
+#include "function.hpp" // multimin_f, point_view, min_result
+#include <type_traits> // is_same_v, remove_const_t
+
+namespace gsl {
+
+
+/// Minimizer that does not use gradient of objective.
+///
+/// GSL's state for the minimizer, as well as a vector of initial step-sizes,
+/// is allocated once, on construction, and is reused by every subsequent
+/// solve.  Neither set() nor minimize() allocates memory.
+///
+/// The objective is passed by reference and invoked through gsl::multimin_f,
+/// so that the call into the objective is resolved at compile-time.
+///
+/// Move-construction is provided, but copying is not.
+class f_minimizer {
+  gsl_multimin_fminimizer *s_; ///< GSL's minimizer.
+  gsl_multimin_function f_; ///< GSL's descriptor for objective.
+  vector<double> step_; ///< Reusable storage for step-sizes.
+
+  f_minimizer(f_minimizer const &)= delete; ///< Disable copying.
+  f_minimizer &operator=(f_minimizer const &)= delete; ///< Disable copying.
+
+public:
+  /// Type of algorithm for minimization.
+  using type= gsl_multimin_fminimizer_type;
+
+  /// Allocate minimizer.
+  /// @param n  Number of dimensions.
+  /// @param t  Algorithm for minimization.
+  f_minimizer(size_t n, type const *t= gsl_multimin_fminimizer_nmsimplex2):
+      s_(gsl_multimin_fminimizer_alloc(t, n)), f_(), step_(n) {
+    f_.n= n;
+  }
+
+  /// Move on construction.
+  /// @param src  Minimizer to move.
+  f_minimizer(f_minimizer &&src):
+      s_(src.s_), f_(src.f_), step_(std::move(src.step_)) {
+    src.s_= nullptr;
+    if(s_ && s_->f == &src.f_) s_->f= &f_;
+  }
+
+  /// Deallocate minimizer.
+  ~f_minimizer() {
+    if(s_) gsl_multimin_fminimizer_free(s_);
+  }
+
+  /// Number of dimensions.
+  /// @return  Number of dimensions.
+  size_t size() const { return f_.n; }
+
+  /// Name of algorithm.
+  /// @return  Name of algorithm.
+  char const *name() const { return gsl_multimin_fminimizer_name(s_); }
+
+  /// Initialize minimizer for objective `f` and starting point `x`.
+  /// Contents of `x` and of `step` are copied into GSL's preallocated state.
+  /// \tparam F  Type of objective.
+  /// \tparam T1  Type of element in `x` (`double` or `double const`).
+  /// \tparam T2  Type of element in `step` (`double` or `double const`).
+  /// \tparam N1  Compile-time number of elements in `x`.
+  /// \tparam N2  Compile-time number of elements in `step`.
+  /// \tparam V1  Type of interface to storage for `x`.
+  /// \tparam V2  Type of interface to storage for `step`.
+  /// @param f  Objective, which must outlive every use of minimizer.
+  /// @param x  Starting point.
+  /// @param step  Initial step-size along each dimension.
+  /// @return  Zero only on success.
+  template<
+        typename F,
+        typename T1,
+        typename T2,
+        size_t N1,
+        size_t N2,
+        template<typename, size_t>
+        class V1,
+        template<typename, size_t>
+        class V2>
+  int
+  set(F &f, v_iface<T1, N1, V1> const &x, v_iface<T2, N2, V2> const &step) {
+    static_assert(std::is_same_v<std::remove_const_t<T1>, double>);
+    static_assert(std::is_same_v<std::remove_const_t<T2>, double>);
+    f_= multimin_f<F>::function(f, size());
+    return gsl_multimin_fminimizer_set(s_, &f_, x.v(), step.v());
+  }
+
+  /// Initialize minimizer for objective `f` and starting point `x`.
+  /// Same initial step-size is used along every dimension.
+  /// \tparam F  Type of objective.
+  /// \tparam T  Type of element in `x` (`double` or `double const`).
+  /// \tparam N  Compile-time number of elements in `x`.
+  /// \tparam V  Type of interface to storage for `x`.
+  /// @param f  Objective, which must outlive every use of minimizer.
+  /// @param x  Starting point.
+  /// @param step  Initial step-size along every dimension.
+  /// @return  Zero only on success.
+  template<typename F, typename T, size_t N, template<typename, size_t> class V>
+  int set(F &f, v_iface<T, N, V> const &x, double step) {
+    step_.set_all(step);
+    return set(f, x, step_);
+  }
+
+  /// Perform single iteration.
+  /// @return  Zero only on success.
+  int iterate() { return gsl_multimin_fminimizer_iterate(s_); }
+
+  /// View of current best estimate of location of minimum.
+  /// @return  View of GSL's storage for current point.
+  point_view x() const { return point(s_->x); }
+
+  /// Value of objective at current point.
+  /// @return  Value of objective at current point.
+  double minimum() const { return s_->fval; }
+
+  /// Characteristic size of current simplex.
+  /// @return  Characteristic size of current simplex.
+  double characteristic_size() const { return s_->size; }
+
+  /// Minimize `f`, starting at `x`, and write location of minimum into `x`.
+  ///
+  /// Iteration stops when characteristic size of simplex falls below
+  /// `epsabs`, when iteration fails, or after `max_iter` iterations.
+  ///
+  /// \tparam F  Type of objective.
+  /// \tparam N  Compile-time number of elements in `x`.
+  /// \tparam V  Type of interface to storage for `x`.
+  /// @param f  Objective.
+  /// @param x  On entry, starting point; on return, location of minimum.
+  /// @param epsabs  Tolerance on size of simplex.
+  /// @param max_iter  Maximum number of iterations.
+  /// @param step  Initial step-size along every dimension.
+  /// @return  Status, number of iterations, and value at minimum.
+  template<typename F, size_t N, template<typename, size_t> class V>
+  min_result minimize(
+        F &f,
+        v_iface<double, N, V> &x,
+        double epsabs,
+        size_t max_iter= 1000,
+        double step= 1.0) {
+    min_result r{set(f, x, step), 0, 0.0};
+    if(r.status == GSL_SUCCESS) r.status= GSL_CONTINUE;
+    while(r.status == GSL_CONTINUE && r.iter < max_iter) {
+      ++r.iter;
+      r.status= iterate();
+      if(r.status != GSL_SUCCESS) break;
+      r.status= gsl_multimin_test_size(s_->size, epsabs);
+    }
+    r.f= s_->fval;
+    w_memcpy(x.v(), s_->x);
+    return r;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,192 @@
+/// \file       include/gslcpp/multimin/fd-gradient.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::fd_gradient.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vector.hpp" // vector
+#include "function.hpp" // point_view, gradient_view
+#include <algorithm> // max
+#include <cmath> // abs, cbrt, sqrt
+#include <limits> // numeric_limits
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Identifier for each of two schemes of finite differencing.
+enum fd_scheme {
+  FORWARD, ///< (f(x + h) - f(x)) / h; n + 1 evaluations.
+  CENTRAL ///< (f(x + h) - f(x - h)) / 2h; 2n evaluations.
+};
+
+
+/// Objective with gradient estimated by finite differences, whose perturbed
+/// evaluations are distributed over a thread-pool.
+///
+/// %fd_gradient has member-functions f(), df(), and fdf(), and so it can be
+/// passed as the objective to gsl::fdf_minimizer when `F` has no analytic
+/// gradient.
+///
+/// One scratch-vector per worker is allocated on construction and is reused
+/// by every subsequent estimate of the gradient.  Because `F` is called
+/// concurrently from several threads, `F` must be safe to call concurrently.
+///
+/// When df() is called from inside a job already running on the same pool (as
+/// when %fd_gradient is used by gsl::batch_minimizer), the evaluations run
+/// serially on the calling worker.
+///
+/// \tparam F  Type of callable with signature `double(point_view const &)`.
+template<typename F> class fd_gradient {
+  F f_; ///< Objective.
+  fd_scheme scheme_; ///< Scheme of finite differencing.
+  double h_; ///< Relative size of perturbation.
+  thread_pool *pool_; ///< Pool over which to distribute evaluations.
+  std::vector<vector<double>> scratch_; ///< Perturbed point for each worker.
+  std::vector<size_t> stamp_; ///< Generation of each scratch-vector.
+  std::vector<double> fv_; ///< Value of objective for each evaluation.
+  size_t gen_= 0; ///< Number of estimates of gradient so far.
+
+  /// Evaluate objective for every perturbation, and, if `base` be true, also
+  /// at `x` itself.  On return, fv_ contains the values.
+  /// @param x  Point about which to perturb.
+  /// @param base  True if value at `x` be needed.
+  void evaluate(point_view const &x, bool base) {
+    size_t const n= x.size();
+    size_t const m= (scheme_ == CENTRAL ? 2 * n : n);
+    ++gen_;
+    pool_->for_each(m + base, [&](size_t k, unsigned w) {
+      if(k == m) {
+        fv_[k]= f_(x);
+        return;
+      }
+      vector<double> &s= scratch_[w];
+      if(stamp_[w] != gen_) {
+        memcpy(s, x);
+        stamp_[w]= gen_;
+      }
+      size_t const i= (scheme_ == CENTRAL ? k / 2 : k);
+      double const xi= x[i];
+      s[i]= xi + step(xi, k);
+      fv_[k]= f_(point(s.v()));
+      s[i]= xi;
+    });
+  }
+
+  /// Signed size of perturbation for `k`th evaluation.
+  /// Size is computed as a difference of representable numbers, so that the
+  /// perturbation actually applied is exactly what is divided by.
+  /// @param xi  Unperturbed value of coordinate.
+  /// @param k  Offset of evaluation.
+  /// @return  Perturbation actually applied to `xi`.
+  double step(double xi, size_t k) const {
+    double const h= h_ * std::max(std::abs(xi), 1.0);
+    double const s= (scheme_ == CENTRAL && k % 2 ? -h : h);
+    return (xi + s) - xi;
+  }
+
+  /// Verify that point and gradient have as many elements as dimensions.
+  /// @param x  Point at which to evaluate.
+  /// @param g  Gradient.
+  void check(point_view const &x, gradient_view const &g) const {
+    size_t const n= size();
+    if(x.size() != n || g.size() != n) {
+      throw std::invalid_argument("mismatch in size");
+    }
+  }
+
+  /// Combine values in fv_ into gradient.
+  /// @param x  Point about which perturbations were made.
+  /// @param g  On return, gradient at `x`.
+  /// @param fx  Value of objective at `x` (needed only for FORWARD).
+  void combine(point_view const &x, gradient_view &g, double fx) const {
+    for(size_t i= 0; i < x.size(); ++i) {
+      double const xi= x[i];
+      if(scheme_ == CENTRAL) {
+        double const hp= step(xi, 2 * i), hm= step(xi, 2 * i + 1);
+        g[i]= (fv_[2 * i] - fv_[2 * i + 1]) / (hp - hm);
+      } else {
+        g[i]= (fv_[i] - fx) / step(xi, i);
+      }
+    }
+  }
+
+public:
+  /// Prepare scratch-storage for each worker.
+  /// @param f  Objective.
+  /// @param n  Number of dimensions.
+  /// @param s  Scheme of finite differencing.
+  /// @param p  Pool over which to distribute evaluations.
+  fd_gradient(
+        F f,
+        size_t n,
+        fd_scheme s= CENTRAL,
+        thread_pool &p= thread_pool::global()):
+      f_(f),
+      scheme_(s),
+      h_(default_step(s)),
+      pool_(&p),
+      stamp_(p.size(), 0),
+      fv_(2 * n + 1) {
+    scratch_.reserve(p.size());
+    for(unsigned w= 0; w < p.size(); ++w) scratch_.emplace_back(n);
+  }
+
+  /// Number of dimensions.
+  /// @return  Number of dimensions.
+  size_t size() const { return fv_.size() / 2; }
+
+  /// Default relative size of perturbation for scheme `s`.
+  /// This is near the size that minimizes the sum of truncation-error and
+  /// round-off error.
+  /// @param s  Scheme of finite differencing.
+  /// @return  Default relative size of perturbation.
+  static double default_step(fd_scheme s) {
+    double const eps= std::numeric_limits<double>::epsilon();
+    return s == CENTRAL ? std::cbrt(eps) : std::sqrt(eps);
+  }
+
+  /// Relative size of perturbation.
+  /// @return  Relative size of perturbation.
+  double step() const { return h_; }
+
+  /// Set relative size of perturbation.
+  /// Absolute size along each dimension is `h * max(|x[i]|, 1)`.
+  /// @param h  Relative size of perturbation.
+  void step(double h) { h_= h; }
+
+  /// Value of objective.
+  /// @param x  Point at which to evaluate.
+  /// @return  Value of objective at `x`.
+  double f(point_view const &x) { return f_(x); }
+
+  /// Estimate gradient of objective.
+  /// @param x  Point at which to evaluate.
+  /// @param g  On return, estimated gradient at `x`.
+  void df(point_view const &x, gradient_view &g) {
+    check(x, g);
+    bool const base= (scheme_ == FORWARD);
+    evaluate(x, base);
+    combine(x, g, base ? fv_[x.size()] : 0.0);
+  }
+
+  /// Value of objective and estimate of its gradient.
+  /// The unperturbed evaluation runs concurrently with the perturbed ones.
+  /// @param x  Point at which to evaluate.
+  /// @param g  On return, estimated gradient at `x`.
+  /// @return  Value of objective at `x`.
+  double fdf(point_view const &x, gradient_view &g) {
+    check(x, g);
+    size_t const m= (scheme_ == CENTRAL ? 2 * x.size() : x.size());
+    evaluate(x, true);
+    combine(x, g, fv_[m]);
+    return fv_[m];
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
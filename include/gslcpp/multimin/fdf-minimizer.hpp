@@ -0,0 +1,147 @@
+/// \file       include/gslcpp/multimin/fdf-minimizer.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::fdf_minimizer.
+
+#pragma once
+
+#include "../wrap/memcpy.hpp" // w_memcpy
+#include "function.hpp" // multimin_fdf, point_view, min_result
+#include <type_traits> // is_same_v, remove_const_t
+
+namespace gsl {
+
+
+/// Minimizer that uses gradient of objective.
+///
+/// GSL's state for the minimizer is allocated once, on construction, and is
+/// reused by every subsequent solve.  Neither set() nor minimize() allocates
+/// memory, and so a single instance may be used for millions of small,
+/// successive minimizations of the same dimension.
+///
+/// The objective is passed by reference and invoked through
+/// gsl::multimin_fdf, so that the call into the objective is resolved at
+/// compile-time.  See gsl::multimin_fdf for the required member-functions.
+///
+/// Move-construction is provided, but copying is not.
+class fdf_minimizer {
+  gsl_multimin_fdfminimizer *s_; ///< GSL's minimizer.
+  gsl_multimin_function_fdf fdf_; ///< GSL's descriptor for objective.
+
+  fdf_minimizer(fdf_minimizer const &)= delete; ///< Disable copying.
+  fdf_minimizer &operator=(fdf_minimizer const &)= delete; ///< Disable copy.
+
+public:
+  /// Type of algorithm for minimization.
+  using type= gsl_multimin_fdfminimizer_type;
+
+  /// Allocate minimizer.
+  /// @param n  Number of dimensions.
+  /// @param t  Algorithm for minimization.
+  fdf_minimizer(size_t n, type const *t= gsl_multimin_fdfminimizer_vector_bfgs2):
+      s_(gsl_multimin_fdfminimizer_alloc(t, n)), fdf_() {
+    fdf_.n= n;
+  }
+
+  /// Move on construction.
+  /// @param src  Minimizer to move.
+  fdf_minimizer(fdf_minimizer &&src): s_(src.s_), fdf_(src.fdf_) {
+    src.s_= nullptr;
+    if(s_ && s_->fdf == &src.fdf_) s_->fdf= &fdf_;
+  }
+
+  /// Deallocate minimizer.
+  ~fdf_minimizer() {
+    if(s_) gsl_multimin_fdfminimizer_free(s_);
+  }
+
+  /// Number of dimensions.
+  /// @return  Number of dimensions.
+  size_t size() const { return fdf_.n; }
+
+  /// Name of algorithm.
+  /// @return  Name of algorithm.
+  char const *name() const { return gsl_multimin_fdfminimizer_name(s_); }
+
+  /// Initialize minimizer for objective `f` and starting point `x`.
+  /// Contents of `x` are copied into GSL's preallocated state.
+  /// \tparam F  Type of objective.
+  /// \tparam T  Type of element in `x` (`double` or `double const`).
+  /// \tparam N  Compile-time number of elements in `x`.
+  /// \tparam V  Type of interface to storage for `x`.
+  /// @param f  Objective, which must outlive every use of minimizer.
+  /// @param x  Starting point.
+  /// @param step  Size of first trial-step.
+  /// @param tol  Tolerance for line-minimization.
+  /// @return  Zero only on success.
+  template<typename F, typename T, size_t N, template<typename, size_t> class V>
+  int set(F &f, v_iface<T, N, V> const &x, double step, double tol) {
+    static_assert(std::is_same_v<std::remove_const_t<T>, double>);
+    fdf_= multimin_fdf<F>::function(f, size());
+    return gsl_multimin_fdfminimizer_set(s_, &fdf_, x.v(), step, tol);
+  }
+
+  /// Perform single iteration.
+  /// @return  Zero only on success.
+  int iterate() { return gsl_multimin_fdfminimizer_iterate(s_); }
+
+  /// Reset minimizer so that it use current point as new starting point.
+  /// @return  Zero only on success.
+  int restart() { return gsl_multimin_fdfminimizer_restart(s_); }
+
+  /// View of current best estimate of location of minimum.
+  /// @return  View of GSL's storage for current point.
+  point_view x() const { return point(s_->x); }
+
+  /// View of gradient at current point.
+  /// @return  View of GSL's storage for gradient.
+  point_view gradient() const { return point(s_->gradient); }
+
+  /// View of last step.
+  /// @return  View of GSL's storage for last step.
+  point_view dx() const { return point(s_->dx); }
+
+  /// Value of objective at current point.
+  /// @return  Value of objective at current point.
+  double minimum() const { return s_->f; }
+
+  /// Minimize `f`, starting at `x`, and write location of minimum into `x`.
+  ///
+  /// Iteration stops when norm of gradient falls below `epsabs`, when
+  /// iteration fails to make progress, or after `max_iter` iterations.
+  ///
+  /// \tparam F  Type of objective.
+  /// \tparam N  Compile-time number of elements in `x`.
+  /// \tparam V  Type of interface to storage for `x`.
+  /// @param f  Objective.
+  /// @param x  On entry, starting point; on return, location of minimum.
+  /// @param epsabs  Tolerance on norm of gradient.
+  /// @param max_iter  Maximum number of iterations.
+  /// @param step  Size of first trial-step.
+  /// @param tol  Tolerance for line-minimization.
+  /// @return  Status, number of iterations, and value at minimum.
+  template<typename F, size_t N, template<typename, size_t> class V>
+  min_result minimize(
+        F &f,
+        v_iface<double, N, V> &x,
+        double epsabs,
+        size_t max_iter= 100,
+        double step= 0.01,
+        double tol= 0.1) {
+    min_result r{set(f, x, step, tol), 0, 0.0};
+    if(r.status == GSL_SUCCESS) r.status= GSL_CONTINUE;
+    while(r.status == GSL_CONTINUE && r.iter < max_iter) {
+      ++r.iter;
+      r.status= iterate();
+      if(r.status != GSL_SUCCESS) break;
+      r.status= gsl_multimin_test_gradient(s_->gradient, epsabs);
+    }
+    r.f= s_->f;
+    w_memcpy(x.v(), s_->x);
+    return r;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,155 @@
+/// \dir        include/gslcpp/multimin
+/// \brief      Types and functions specific to multidimensional minimization.
+
+/// \file       include/gslcpp/multimin/function.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::multimin_f, gsl::multimin_fdf, and related
+///             types.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/subvector.hpp" // w_subvector
+#include <gsl/gsl_multimin.h> // gsl_multimin_function, etc.
+#include <type_traits> // false_type, true_type, void_t
+
+namespace gsl {
+
+
+/// Type of view, passed to objective, of point at which to evaluate.
+/// View refers directly to GSL's storage; no element is copied.
+using point_view= v_iface<double const, 0, v_view>;
+
+
+/// Type of view, passed to objective, of gradient to be written.
+/// View refers directly to GSL's storage; no element is copied.
+using gradient_view= v_iface<double, 0, v_view>;
+
+
+/// Outcome of complete minimization.
+struct min_result {
+  int status; ///< GSL_SUCCESS, GSL_CONTINUE (not converged), or error-code.
+  size_t iter; ///< Number of iterations performed.
+  double f; ///< Value of objective at final point.
+};
+
+
+/// View of immutable vector owned by GSL.
+/// @param x  Pointer to GSL's native vector.
+/// @return  View of `x`.
+inline point_view point(gsl_vector const *x) {
+  return w_subvector(x, 0, 1, x->size);
+}
+
+
+/// View of mutable vector owned by GSL.
+/// @param g  Pointer to GSL's native vector.
+/// @return  View of `g`.
+inline gradient_view gradient(gsl_vector *g) {
+  return w_subvector(g, 0, 1, g->size);
+}
+
+
+/// Trampoline from GSL's gsl_multimin_function to instance of `F`.
+///
+/// Because `F` is a template-parameter, the call from the trampoline into the
+/// objective is direct and may be inlined; there is no `std::function` and no
+/// virtual call.  The only indirect call is GSL's own call into the
+/// trampoline.
+///
+/// \tparam F  Type of callable with signature `double(point_view const &)`.
+template<typename F> struct multimin_f {
+  /// Evaluate objective.
+  /// @param x  Point at which to evaluate.
+  /// @param p  Pointer to instance of `F`.
+  /// @return  Value of objective at `x`.
+  static double f(gsl_vector const *x, void *p) {
+    return (*static_cast<F *>(p))(point(x));
+  }
+
+  /// GSL's descriptor for objective.
+  /// @param f  Reference to objective, which must outlive descriptor.
+  /// @param n  Number of dimensions.
+  /// @return  GSL's descriptor for objective.
+  static gsl_multimin_function function(F &f, size_t n) {
+    return {&multimin_f::f, n, &f};
+  }
+};
+
+
+/// Generic declaration for detection of member `fdf()` in `F`.
+/// \tparam F  Type of objective.
+template<typename F, typename= void> struct has_fdf: std::false_type {};
+
+
+/// Specialization for `F` that has member `fdf()`.
+/// \tparam F  Type of objective.
+template<typename F>
+struct has_fdf<
+      F,
+      std::void_t<decltype(std::declval<F &>().fdf(
+            std::declval<point_view const &>(),
+            std::declval<gradient_view &>()))>>: std::true_type {};
+
+
+/// Trampoline from GSL's gsl_multimin_function_fdf to instance of `F`.
+///
+/// `F` must have member-functions
+/// - `double f(point_view const &x)`, returning value of objective, and
+/// - `void df(point_view const &x, gradient_view &g)`, writing gradient.
+///
+/// Optionally, `F` may also have member-function
+/// - `double fdf(point_view const &x, gradient_view &g)`,
+///
+/// which writes gradient and returns value.  If `fdf()` be absent, then it is
+/// synthesized from `f()` and `df()`.
+///
+/// \tparam F  Type of objective.
+template<typename F> struct multimin_fdf {
+  /// Evaluate objective.
+  /// @param x  Point at which to evaluate.
+  /// @param p  Pointer to instance of `F`.
+  /// @return  Value of objective at `x`.
+  static double f(gsl_vector const *x, void *p) {
+    return static_cast<F *>(p)->f(point(x));
+  }
+
+  /// Evaluate gradient of objective.
+  /// @param x  Point at which to evaluate.
+  /// @param p  Pointer to instance of `F`.
+  /// @param g  On return, gradient at `x`.
+  static void df(gsl_vector const *x, void *p, gsl_vector *g) {
+    gradient_view gv= gradient(g);
+    static_cast<F *>(p)->df(point(x), gv);
+  }
+
+  /// Evaluate objective and its gradient.
+  /// @param x  Point at which to evaluate.
+  /// @param p  Pointer to instance of `F`.
+  /// @param y  On return, value of objective at `x`.
+  /// @param g  On return, gradient at `x`.
+  static void fdf(gsl_vector const *x, void *p, double *y, gsl_vector *g) {
+    F &o= *static_cast<F *>(p);
+    point_view const xv= point(x);
+    gradient_view gv= gradient(g);
+    if constexpr(has_fdf<F>::value) {
+      *y= o.fdf(xv, gv);
+    } else {
+      *y= o.f(xv);
+      o.df(xv, gv);
+    }
+  }
+
+  /// GSL's descriptor for objective.
+  /// @param f  Reference to objective, which must outlive descriptor.
+  /// @param n  Number of dimensions.
+  /// @return  GSL's descriptor for objective.
+  static gsl_multimin_function_fdf function(F &f, size_t n) {
+    return {&multimin_fdf::f, &multimin_fdf::df, &multimin_fdf::fdf, n, &f};
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,221 @@
+/// \dir        include/gslcpp/par
+/// \brief      Facilities for parallel execution.
+
+/// \file       include/gslcpp/par/thread-pool.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::thread_pool.
+
+#pragma once
+
+#include <algorithm> // max, min
+#include <atomic> // atomic
+#include <condition_variable> // condition_variable
+#include <exception> // exception_ptr, rethrow_exception
+#include <mutex> // lock_guard, mutex, unique_lock
+#include <thread> // thread
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Fixed set of worker-threads that execute chunks of a loop in parallel.
+///
+/// Each job is a loop over chunks.  The calling thread participates as worker
+/// 0, and the pool's own threads are workers 1 through size()-1.  Each chunk is
+/// executed by exactly one worker, and the offset of the worker is passed to
+/// the body of the loop, so that the caller can keep one preallocated
+/// workspace per worker, indexed by that offset.
+///
+/// Chunks are claimed dynamically, but the boundaries of the chunks depend
+/// only on the arguments to for_chunks(), not on the number of threads.
+///
+/// A call from inside a running job into the same pool executes serially on
+/// the calling thread, with the calling worker's offset.  Calls from distinct
+/// outside threads are serialized.
+///
+/// The body of the loop is a template-parameter and is called through a
+/// single static trampoline per chunk; there is no `std::function`.
+class thread_pool {
+  /// Description of job in progress.
+  struct job {
+    void (*run)(void *, size_t, unsigned); ///< Trampoline for one chunk.
+    void *ctx; ///< Context passed to trampoline.
+    size_t n; ///< Number of chunks.
+    std::atomic<size_t> next{0}; ///< Offset of next unclaimed chunk.
+    std::exception_ptr error; ///< First exception thrown by any chunk.
+  };
+
+  std::vector<std::thread> threads_; ///< Workers other than caller.
+  std::mutex submit_; ///< Serialize jobs from distinct outside threads.
+  std::mutex m_; ///< Protect members below.
+  std::condition_variable wake_; ///< Signal new job or stop.
+  std::condition_variable idle_; ///< Signal that no worker use job.
+  job *job_= nullptr; ///< Job in progress, if any.
+  size_t gen_= 0; ///< Number of jobs submitted.
+  unsigned users_= 0; ///< Number of pool-threads working on job.
+  bool stop_= false; ///< True when pool is being destroyed.
+
+  thread_pool(thread_pool const &)= delete; ///< Disable copying.
+  thread_pool &operator=(thread_pool const &)= delete; ///< Disable copying.
+
+  /// Pool, if any, whose job is running on current thread.
+  /// @return  Reference to thread-local pointer to pool.
+  static thread_pool *&current() {
+    static thread_local thread_pool *p= nullptr;
+    return p;
+  }
+
+  /// Offset of worker corresponding to current thread.
+  /// @return  Reference to thread-local offset.
+  static unsigned &worker() {
+    static thread_local unsigned w= 0;
+    return w;
+  }
+
+  /// Execute unclaimed chunks of job until none remain.
+  /// @param j  Job.
+  /// @param w  Offset of worker.
+  void work(job &j, unsigned w) {
+    for(size_t c; (c= j.next.fetch_add(1)) < j.n;) {
+      try {
+        j.run(j.ctx, c, w);
+      } catch(...) {
+        std::lock_guard<std::mutex> lock(m_);
+        if(!j.error) j.error= std::current_exception();
+      }
+    }
+  }
+
+  /// Main loop of pool-thread.
+  /// @param w  Offset of worker.
+  void loop(unsigned w) {
+    current()= this;
+    worker()= w;
+    size_t seen= 0;
+    std::unique_lock<std::mutex> lock(m_);
+    for(;;) {
+      wake_.wait(lock, [&] { return stop_ || (job_ && gen_ != seen); });
+      if(stop_) return;
+      seen= gen_;
+      job &j= *job_;
+      ++users_;
+      lock.unlock();
+      work(j, w);
+      lock.lock();
+      if(--users_ == 0) idle_.notify_all();
+    }
+  }
+
+  /// Execute `n` chunks, each via `run(ctx, chunk, worker)`.
+  /// @param n  Number of chunks.
+  /// @param run  Trampoline for one chunk.
+  /// @param ctx  Context passed to trampoline.
+  void execute(size_t n, void (*run)(void *, size_t, unsigned), void *ctx) {
+    if(current() == this || threads_.empty() || n == 1) {
+      unsigned const w= (current() == this ? worker() : 0);
+      for(size_t c= 0; c < n; ++c) run(ctx, c, w);
+      return;
+    }
+    std::lock_guard<std::mutex> submit(submit_);
+    job j;
+    j.run= run;
+    j.ctx= ctx;
+    j.n= n;
+    {
+      std::lock_guard<std::mutex> lock(m_);
+      job_= &j;
+      ++gen_;
+    }
+    wake_.notify_all();
+    thread_pool *const prev_pool= current();
+    unsigned const prev_worker= worker();
+    current()= this;
+    worker()= 0;
+    work(j, 0);
+    current()= prev_pool;
+    worker()= prev_worker;
+    {
+      std::unique_lock<std::mutex> lock(m_);
+      idle_.wait(lock, [this] { return users_ == 0; });
+      job_= nullptr;
+    }
+    if(j.error) std::rethrow_exception(j.error);
+  }
+
+public:
+  /// Start pool-threads.
+  /// @param n  Total number of workers, including calling thread.
+  explicit thread_pool(unsigned n= std::thread::hardware_concurrency()) {
+    n= std::max(n, 1u);
+    threads_.reserve(n - 1);
+    for(unsigned w= 1; w < n; ++w) threads_.emplace_back([this, w] { loop(w); });
+  }
+
+  /// Stop and join pool-threads.
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(m_);
+      stop_= true;
+    }
+    wake_.notify_all();
+    for(auto &t: threads_) t.join();
+  }
+
+  /// Number of workers, including calling thread.
+  /// Offset passed to each chunk is less than this number.
+  /// @return  Number of workers.
+  unsigned size() const { return unsigned(threads_.size()) + 1; }
+
+  /// Call `f(b, e, w)` for each chunk `[b, e)` of `[0, n)`.
+  /// Every chunk but the last has `grain` elements.
+  /// \tparam F  Type of body of loop.
+  /// @param n  Number of elements.
+  /// @param grain  Number of elements in each chunk.
+  /// @param f  Body of loop, called with beginning, end, and worker-offset.
+  template<typename F> void for_chunks(size_t n, size_t grain, F &&f) {
+    if(n == 0) return;
+    grain= std::max(grain, size_t(1));
+    struct ctx {
+      F &f; ///< Body of loop.
+      size_t n; ///< Number of elements.
+      size_t grain; ///< Number of elements in each chunk.
+    } c{f, n, grain};
+    auto const run= [](void *p, size_t k, unsigned w) {
+      ctx &c= *static_cast<ctx *>(p);
+      size_t const b= k * c.grain;
+      c.f(b, std::min(c.n, b + c.grain), w);
+    };
+    execute((n + grain - 1) / grain, run, &c);
+  }
+
+  /// Call `f(b, e, w)` for at most a few chunks per worker.
+  /// Boundaries of chunks depend on size() and so are appropriate only when
+  /// result do not depend on chunking.
+  /// \tparam F  Type of body of loop.
+  /// @param n  Number of elements.
+  /// @param f  Body of loop, called with beginning, end, and worker-offset.
+  template<typename F> void for_chunks(size_t n, F &&f) {
+    size_t const k= 4 * size_t(size());
+    for_chunks(n, (n + k - 1) / k, f);
+  }
+
+  /// Call `f(i, w)` for each `i` in `[0, n)`.
+  /// \tparam F  Type of body of loop.
+  /// @param n  Number of iterations.
+  /// @param f  Body of loop, called with offset and worker-offset.
+  template<typename F> void for_each(size_t n, F &&f) {
+    for_chunks(n, 1, [&f](size_t b, size_t, unsigned w) { f(b, w); });
+  }
+
+  /// Pool shared by default by every parallel algorithm in gslcpp.
+  /// @return  Reference to global pool.
+  static thread_pool &global() {
+    static thread_pool p;
+    return p;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,10 @@
+/// \file       include/gslcpp/poly.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for polynomials over vectors.
+
+#pragma once
+
+#include "poly/poly-eval.hpp" // poly_eval, poly_eval_derivs
+#include "poly/poly-roots.hpp" // batch_poly_solver
+
+// EOF
@@ -0,0 +1,368 @@
+/// \dir        include/gslcpp/poly
+/// \brief      Types and functions specific to polynomials over vectors.
+
+/// \file       include/gslcpp/poly/poly-eval.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::poly_eval() and gsl::poly_eval_derivs().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vector.hpp" // vector
+#include "../wrap/is-complex.hpp" // is_complex_v
+#include <algorithm> // max, min
+#include <gsl/gsl_matrix.h> // gsl_matrix, gsl_matrix_ptr
+#include <stdexcept> // invalid_argument
+#include <type_traits> // conditional_t, remove_const_t
+#include <vector> // vector
+
+namespace gsl {
+
+
+// GSL's gsl_poly_eval() runs Horner's rule at one point, and each step
+// depends on the one before, so that a single evaluation cannot use more than
+// one lane of the floating-point unit.  Here, instead, Horner's rule runs
+// across a block of gsl::poly_block points at once: for each coefficient, the
+// same multiply-add is applied to every point in the block.  The loop over
+// the block has a fixed count and no dependence between points, so the
+// compiler vectorizes it, and the many independent accumulators hide the
+// latency of each multiply-add.  Every point sees the same operations in the
+// same order as in GSL, up to contraction of multiply-add by the compiler.
+
+
+/// Number of points in each chunk of parallel evaluation of polynomial.
+constexpr size_t poly_grain= size_t(1) << 14;
+
+
+/// Number of points evaluated together by Horner's rule.
+constexpr size_t poly_block= 64;
+
+
+/// Real part of coefficient or point.
+/// \tparam T  Type of value, real or gsl::complex.
+/// @param x  Value.
+/// @return  Real part as double.
+template<typename T> double poly_re(T const &x) {
+  if constexpr(is_complex_v<T>) {
+    return double(x.real());
+  } else {
+    return double(x);
+  }
+}
+
+
+/// Imaginary part of coefficient or point.
+/// \tparam T  Type of value, real or gsl::complex.
+/// @param x  Value.
+/// @return  Imaginary part as double, or zero if `T` be real.
+template<typename T> double poly_im(T const &x) {
+  if constexpr(is_complex_v<T>) {
+    return double(x.imag());
+  } else {
+    return 0.0;
+  }
+}
+
+
+/// Real parts and imaginary parts of coefficients, each contiguous.
+struct poly_coef {
+  std::vector<double> re; ///< Real part of each coefficient.
+  std::vector<double> im; ///< Imaginary part of each coefficient.
+
+  /// Copy coefficients.
+  /// \tparam T  Type of coefficient.
+  /// \tparam N  Compile-time number of coefficients.
+  /// \tparam V  Type of interface to storage of coefficients.
+  /// @param c  Coefficients in order of ascending power, at least one.
+  template<typename T, size_t N, template<typename, size_t> class V>
+  explicit poly_coef(v_iface<T, N, V> const &c): re(c.size()), im(c.size()) {
+    if(c.size() == 0) throw std::invalid_argument("no coefficients");
+    for(size_t k= 0; k < c.size(); ++k) {
+      re[k]= poly_re(c[k]);
+      im[k]= poly_im(c[k]);
+    }
+  }
+
+  /// Number of coefficients.
+  /// @return  Number of coefficients.
+  size_t size() const { return re.size(); }
+};
+
+
+/// Evaluate real polynomial at block of real points, as by gsl_poly_eval().
+/// @param c  Coefficients in order of ascending power.
+/// @param n  Number of coefficients.
+/// @param t  Points.
+/// @param a  On return, value at each point.
+inline void poly_horner(
+      double const *c, size_t n, double const *t, double *a) {
+  for(size_t j= 0; j < poly_block; ++j) a[j]= c[n - 1];
+  for(size_t k= n - 1; k-- > 0;) {
+    double const ck= c[k];
+    for(size_t j= 0; j < poly_block; ++j) a[j]= ck + t[j] * a[j];
+  }
+}
+
+
+/// Evaluate complex polynomial at block of complex points, as by
+/// gsl_complex_poly_complex_eval().
+/// @param cr  Real part of each coefficient.
+/// @param ci  Imaginary part of each coefficient.
+/// @param n  Number of coefficients.
+/// @param tr  Real part of each point.
+/// @param ti  Imaginary part of each point.
+/// @param ar  On return, real part of value at each point.
+/// @param ai  On return, imaginary part of value at each point.
+inline void poly_horner(
+      double const *cr,
+      double const *ci,
+      size_t n,
+      double const *tr,
+      double const *ti,
+      double *ar,
+      double *ai) {
+  for(size_t j= 0; j < poly_block; ++j) {
+    ar[j]= cr[n - 1];
+    ai[j]= ci[n - 1];
+  }
+  for(size_t k= n - 1; k-- > 0;) {
+    double const rk= cr[k], ik= ci[k];
+    for(size_t j= 0; j < poly_block; ++j) {
+      double const r= rk + tr[j] * ar[j] - ti[j] * ai[j];
+      ai[j]= ik + ti[j] * ar[j] + tr[j] * ai[j];
+      ar[j]= r;
+    }
+  }
+}
+
+
+/// Evaluate polynomial over range of points, gsl::poly_block at a time.
+/// \tparam Z  True for complex arithmetic.
+/// \tparam X  Type of point.
+/// \tparam U  Type of value.
+/// @param c  Coefficients.
+/// @param x  Pointer to first point.
+/// @param sx  Stride of points.
+/// @param y  Pointer to first value.
+/// @param sy  Stride of values.
+/// @param b  Offset of first point in range.
+/// @param e  Offset past last point in range.
+template<bool Z, typename X, typename U>
+void poly_range(
+      poly_coef const &c,
+      X const *x,
+      size_t sx,
+      U *y,
+      size_t sy,
+      size_t b,
+      size_t e) {
+  double tr[poly_block]= {}, ti[poly_block]= {};
+  double ar[poly_block], ai[poly_block];
+  for(size_t i= b; i < e; i+= poly_block) {
+    size_t const m= std::min(poly_block, e - i);
+    for(size_t j= 0; j < m; ++j) {
+      tr[j]= poly_re(x[(i + j) * sx]);
+      if constexpr(Z) ti[j]= poly_im(x[(i + j) * sx]);
+    }
+    if constexpr(Z) {
+      poly_horner(c.re.data(), c.im.data(), c.size(), tr, ti, ar, ai);
+      for(size_t j= 0; j < m; ++j) y[(i + j) * sy]= U(ar[j], ai[j]);
+    } else {
+      poly_horner(c.re.data(), c.size(), tr, ar);
+      for(size_t j= 0; j < m; ++j) y[(i + j) * sy]= U(ar[j]);
+    }
+  }
+}
+
+
+/// Evaluate polynomial at every point.
+///
+/// Coefficients and points may each be real or gsl::complex.  If either be
+/// complex, then the values must be complex, and each is computed as by
+/// gsl_poly_complex_eval() or gsl_complex_poly_complex_eval(); otherwise,
+/// each is computed as by gsl_poly_eval().  Arithmetic is in double
+/// precision.  Chunks of gsl::poly_grain points are evaluated in parallel,
+/// and the result does not depend on the number of threads.
+/// https://www.gnu.org/software/gsl/doc/html/poly.html#c.gsl_poly_eval
+///
+/// \tparam T  Type of coefficient.
+/// \tparam L  Compile-time number of coefficients.
+/// \tparam C  Type of interface to storage of coefficients.
+/// \tparam X  Type of point.
+/// \tparam N  Compile-time number of points.
+/// \tparam V  Type of interface to storage of points.
+/// \tparam U  Type of value.
+/// \tparam M  Compile-time number of values.
+/// \tparam W  Type of interface to storage of values.
+/// @param c  Coefficients in order of ascending power, at least one.
+/// @param x  Points.
+/// @param y  Values, as many as points; may be same as `x`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t L,
+      template<typename, size_t>
+      class C,
+      typename X,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void poly_eval(
+      v_iface<T, L, C> const &c,
+      v_iface<X, N, V> const &x,
+      v_iface<U, M, W> &y,
+      thread_pool &p= thread_pool::global()) {
+  constexpr bool z= is_complex_v<T> || is_complex_v<X>;
+  static_assert(!z || is_complex_v<U>, "complex polynomial into real vector");
+  size_t const n= x.size(), sx= x.v()->stride, sy= y.v()->stride;
+  if(y.size() != n) throw std::invalid_argument("mismatch in size");
+  poly_coef const k(c);
+  X const *const px= x.data();
+  U *const py= y.data();
+  if(n <= poly_grain || p.size() == 1) {
+    return poly_range<z>(k, px, sx, py, sy, 0, n);
+  }
+  p.for_chunks(n, poly_grain, [&](size_t b, size_t e, unsigned) {
+    poly_range<z>(k, px, sx, py, sy, b, e);
+  });
+}
+
+
+/// Evaluate polynomial at every point, into new vector.
+/// \tparam T  Type of coefficient.
+/// \tparam L  Compile-time number of coefficients.
+/// \tparam C  Type of interface to storage of coefficients.
+/// \tparam X  Type of point.
+/// \tparam N  Compile-time number of points.
+/// \tparam V  Type of interface to storage of points.
+/// @param c  Coefficients in order of ascending power, at least one.
+/// @param x  Points.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of values, complex if `T` or `X` be complex.
+template<
+      typename T,
+      size_t L,
+      template<typename, size_t>
+      class C,
+      typename X,
+      size_t N,
+      template<typename, size_t>
+      class V>
+auto poly_eval(
+      v_iface<T, L, C> const &c,
+      v_iface<X, N, V> const &x,
+      thread_pool &p= thread_pool::global()) {
+  using U= std::conditional_t<
+        is_complex_v<T> || is_complex_v<X>, complex<double>, double>;
+  vector<U> r(x.size());
+  gsl::poly_eval(c, x, r, p);
+  return r;
+}
+
+
+/// Evaluate real polynomial and its derivatives over range of points.
+/// \tparam X  Type of point.
+/// @param c  Coefficients.
+/// @param x  Pointer to first point.
+/// @param sx  Stride of points.
+/// @param out  Matrix with one row for each point.
+/// @param b  Offset of first point in range.
+/// @param e  Offset past last point in range.
+template<typename X>
+void poly_derivs_range(
+      poly_coef const &c,
+      X const *x,
+      size_t sx,
+      gsl_matrix *out,
+      size_t b,
+      size_t e) {
+  size_t const lc= c.size(), lr= out->size2;
+  size_t const nmax= std::min(lc, lr) - 1; // highest nonzero derivative
+  double const *const k= c.re.data();
+  double t[poly_block]= {};
+  std::vector<double> r(lr * poly_block); // r[d * poly_block + j]
+  for(size_t i= b; i < e; i+= poly_block) {
+    size_t const m= std::min(poly_block, e - i);
+    for(size_t j= 0; j < m; ++j) t[j]= double(x[(i + j) * sx]);
+    for(size_t d= 0; d < lr; ++d) {
+      double const v= d <= nmax ? k[lc - 1] : 0.0;
+      for(size_t j= 0; j < poly_block; ++j) r[d * poly_block + j]= v;
+    }
+    for(size_t q= lc - 1; q > 0; --q) {
+      double const kq= k[q - 1];
+      double *const r0= r.data();
+      for(size_t j= 0; j < poly_block; ++j) r0[j]= t[j] * r0[j] + kq;
+      size_t const dmax= std::min(nmax, q - 1);
+      for(size_t d= 1; d <= dmax; ++d) {
+        double *const rd= r0 + d * poly_block;
+        double const *const rp= rd - poly_block;
+        for(size_t j= 0; j < poly_block; ++j) rd[j]= t[j] * rd[j] + rp[j];
+      }
+    }
+    double f= 1.0;
+    for(size_t d= 2; d <= nmax; ++d) {
+      f*= double(d);
+      for(size_t j= 0; j < poly_block; ++j) r[d * poly_block + j]*= f;
+    }
+    for(size_t j= 0; j < m; ++j) {
+      double *const row= gsl_matrix_ptr(out, i + j, 0);
+      for(size_t d= 0; d < lr; ++d) row[d]= r[d * poly_block + j];
+    }
+  }
+}
+
+
+/// Evaluate real polynomial and its derivatives at every point.
+///
+/// Element `(i, d)` of `out` becomes the `d`th derivative at `x[i]`, as by
+/// gsl_poly_eval_derivs() with `lenres` equal to the number of columns.
+/// Rows are distributed in chunks of about gsl::poly_grain values.
+/// https://www.gnu.org/software/gsl/doc/html/poly.html#c.gsl_poly_eval_derivs
+///
+/// \tparam T  Type of coefficient.
+/// \tparam L  Compile-time number of coefficients.
+/// \tparam C  Type of interface to storage of coefficients.
+/// \tparam X  Type of point.
+/// \tparam N  Compile-time number of points.
+/// \tparam V  Type of interface to storage of points.
+/// @param c  Real coefficients in order of ascending power, at least one.
+/// @param x  Real points.
+/// @param out  Matrix with one row for each point, and one column for each
+///             derivative, beginning with the value itself.
+/// @param p  Pool over which to distribute rows.
+template<
+      typename T,
+      size_t L,
+      template<typename, size_t>
+      class C,
+      typename X,
+      size_t N,
+      template<typename, size_t>
+      class V>
+void poly_eval_derivs(
+      v_iface<T, L, C> const &c,
+      v_iface<X, N, V> const &x,
+      gsl_matrix *out,
+      thread_pool &p= thread_pool::global()) {
+  static_assert(!is_complex_v<T> && !is_complex_v<X>, "complex polynomial");
+  size_t const n= x.size(), sx= x.v()->stride, m= out->size2;
+  if(out->size1 != n || m == 0) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  poly_coef const k(c);
+  X const *const px= x.data();
+  size_t const g= std::max(poly_block, poly_grain / m);
+  if(n <= g || p.size() == 1) return poly_derivs_range(k, px, sx, out, 0, n);
+  p.for_chunks(n, g, [&](size_t b, size_t e, unsigned) {
+    poly_derivs_range(k, px, sx, out, b, e);
+  });
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,157 @@
+/// \file       include/gslcpp/poly/poly-roots.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::batch_poly_solver.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "../wrap/complex.hpp" // complex
+#include <gsl/gsl_errno.h> // GSL_EINVAL
+#include <gsl/gsl_poly.h> // gsl_poly_complex_solve, etc.
+#include <limits> // numeric_limits
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Solver for complex roots of many real polynomials of same degree,
+/// distributed over thread-pool.
+///
+/// Polynomials of degree one, two, and three are solved in closed form, by
+/// gsl_poly_complex_solve_quadratic() and gsl_poly_complex_solve_cubic() for
+/// degrees two and three.  Each polynomial of higher degree is solved by
+/// gsl_poly_complex_solve(), for which one workspace is allocated per worker
+/// on construction and reused for every polynomial that the worker solves, so
+/// that no solve allocates memory.
+/// https://www.gnu.org/software/gsl/doc/html/poly.html#general-polynomial-equations
+class batch_poly_solver {
+  thread_pool &pool_; ///< Pool over which to distribute polynomials.
+  size_t n_; ///< Number of coefficients in each polynomial.
+  std::vector<gsl_poly_complex_workspace *> w_; ///< Workspace per worker.
+  std::vector<double> buf_; ///< Coefficients and roots, for each worker.
+
+  /// Validate number of coefficients.
+  /// @param n  Number of coefficients in each polynomial.
+  /// @return  `n`, if it be at least two.
+  static size_t checked(size_t n) {
+    if(n < 2) throw std::invalid_argument("fewer than two coefficients");
+    return n;
+  }
+
+  batch_poly_solver(batch_poly_solver const &)= delete; ///< Disable copying.
+
+  /// Disable copying.
+  batch_poly_solver &operator=(batch_poly_solver const &)= delete;
+
+  /// Solve one polynomial.
+  /// @param a  Contiguous coefficients in order of ascending power.
+  /// @param z  On return, roots packed as by gsl_poly_complex_solve().
+  /// @param w  Offset of worker.
+  /// @return  GSL's status.
+  int solve_one(double const *a, double *z, unsigned w) const {
+    size_t const d= n_ - 1; // degree
+    if(a[d] == 0.0) return GSL_EINVAL;
+    if(d > 3) return gsl_poly_complex_solve(a, n_, w_[w], z);
+    if(d == 1) {
+      z[0]= -a[0] / a[1];
+      z[1]= 0.0;
+      return 0;
+    }
+    gsl_complex r[3];
+    if(d == 2) {
+      gsl_poly_complex_solve_quadratic(a[2], a[1], a[0], r, r + 1);
+    } else {
+      gsl_poly_complex_solve_cubic(
+            a[2] / a[3], a[1] / a[3], a[0] / a[3], r, r + 1, r + 2);
+    }
+    for(size_t i= 0; i < d; ++i) {
+      z[2 * i]= GSL_REAL(r[i]);
+      z[2 * i + 1]= GSL_IMAG(r[i]);
+    }
+    return 0;
+  }
+
+public:
+  /// Allocate workspace per worker.
+  /// @param n  Number of coefficients in each polynomial, at least two.
+  /// @param p  Pool over which to distribute polynomials.
+  explicit batch_poly_solver(
+        size_t n, thread_pool &p= thread_pool::global()):
+      pool_(p), n_(checked(n)), buf_(p.size() * (3 * n - 2)) {
+    if(n < 5) return;
+    w_.reserve(p.size());
+    for(unsigned i= 0; i < p.size(); ++i) {
+      w_.push_back(gsl_poly_complex_workspace_alloc(n));
+    }
+  }
+
+  /// Deallocate workspaces.
+  ~batch_poly_solver() {
+    for(gsl_poly_complex_workspace *w: w_) gsl_poly_complex_workspace_free(w);
+  }
+
+  /// Number of coefficients in each polynomial.
+  /// @return  Number of coefficients in each polynomial.
+  size_t size() const { return n_; }
+
+  /// Find roots of every polynomial in batch.
+  ///
+  /// Coefficients are packed end to end in `a`, in order of ascending power,
+  /// so that polynomial `i` occupies elements `[i*size(), (i+1)*size())`.
+  /// Its roots occupy elements `[i*(size()-1), (i+1)*(size()-1))` of `z`.
+  /// For degrees two and three, roots are in GSL's order; for higher degree,
+  /// the order is unspecified.
+  ///
+  /// If the leading coefficient of a polynomial be zero, then its status is
+  /// `GSL_EINVAL`, and its roots are NaN.  If gsl_poly_complex_solve() fail
+  /// to converge, GSL's handler of errors is called; call
+  /// `gsl_set_error_handler_off()` to get the status instead.
+  ///
+  /// \tparam T  Type of coefficient.
+  /// \tparam N  Compile-time number of coefficients.
+  /// \tparam V  Type of interface to storage of coefficients.
+  /// \tparam M  Compile-time number of roots.
+  /// \tparam W  Type of interface to storage of roots.
+  /// @param a  Coefficients of every polynomial.
+  /// @param z  Roots of every polynomial.
+  /// @return  GSL's status for each polynomial, in order.
+  template<
+        typename T,
+        size_t N,
+        template<typename, size_t>
+        class V,
+        size_t M,
+        template<typename, size_t>
+        class W>
+  std::vector<int>
+  solve(v_iface<T, N, V> const &a, v_iface<complex<double>, M, W> &z) {
+    size_t const n= n_, d= n - 1;
+    if(a.size() % n) throw std::invalid_argument("a.size() % size() != 0");
+    if(z.size() != a.size() / n * d) {
+      throw std::invalid_argument("mismatch in size");
+    }
+    std::vector<int> status(a.size() / n);
+    pool_.for_each(status.size(), [&](size_t i, unsigned w) {
+      double *const c= buf_.data() + w * (3 * n - 2);
+      double *const r= c + n;
+      for(size_t k= 0; k < n; ++k) c[k]= double(a[i * n + k]);
+      int const s= solve_one(c, r, w);
+      if(s == GSL_EINVAL) {
+        double const nan= std::numeric_limits<double>::quiet_NaN();
+        for(size_t k= 0; k < 2 * d; ++k) r[k]= nan;
+      }
+      for(size_t k= 0; k < d; ++k) {
+        z[i * d + k]= complex<double>(r[2 * k], r[2 * k + 1]);
+      }
+      status[i]= s;
+    });
+    return status;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
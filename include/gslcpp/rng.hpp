@@ -0,0 +1,11 @@
+/// \file       include/gslcpp/rng.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for random numbers.
+
+#pragma once
+
+#include "rng/ran.hpp" // ran_uniform, ran_gaussian, etc.
+#include "rng/rng.hpp" // rng, splitmix64
+#include "rng/v-fill.hpp" // ran_fill, ran_seed
+
+// EOF
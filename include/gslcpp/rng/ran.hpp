@@ -0,0 +1,208 @@
+/// \file       include/gslcpp/rng/ran.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for random-number distributions.
+
+#pragma once
+
+#include <gsl/gsl_randist.h> // gsl_ran_gaussian, etc.
+
+namespace gsl {
+
+
+// Each distribution is a small function-object whose members are the
+// parameters of the distribution, and whose call-operator draws one variate
+// from a GSL generator.  Because the type of the distribution is known at
+// compile-time, gsl::ran_fill() calls the corresponding gsl_ran function
+// directly, with no indirection beyond that in GSL's generator.  Any other
+// callable `d(gsl_rng *)` may be used in the same way.
+
+
+/// Uniform distribution on `[0, 1)`.
+/// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_uniform
+struct ran_uniform {
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_rng_uniform(r); }
+};
+
+
+/// Uniform distribution on `(0, 1)`.
+/// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_uniform_pos
+struct ran_uniform_pos {
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_rng_uniform_pos(r); }
+};
+
+
+/// Flat distribution on `[a, b)`.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_flat
+struct ran_flat {
+  double a; ///< Lower limit.
+  double b; ///< Upper limit.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_flat(r, a, b); }
+};
+
+
+/// Gaussian distribution with zero mean.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_gaussian
+struct ran_gaussian {
+  double sigma= 1.0; ///< Standard deviation.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_gaussian(r, sigma); }
+};
+
+
+/// Gaussian distribution with zero mean, by Marsaglia and Tsang's ziggurat,
+/// which is the fastest of GSL's Gaussian generators.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_gaussian_ziggurat
+struct ran_gaussian_ziggurat {
+  double sigma= 1.0; ///< Standard deviation.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const {
+    return gsl_ran_gaussian_ziggurat(r, sigma);
+  }
+};
+
+
+/// Exponential distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_exponential
+struct ran_exponential {
+  double mu= 1.0; ///< Mean.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_exponential(r, mu); }
+};
+
+
+/// Laplace distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_laplace
+struct ran_laplace {
+  double a= 1.0; ///< Width.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_laplace(r, a); }
+};
+
+
+/// Cauchy distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_cauchy
+struct ran_cauchy {
+  double a= 1.0; ///< Scale.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_cauchy(r, a); }
+};
+
+
+/// Gamma distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_gamma
+struct ran_gamma {
+  double a; ///< Shape.
+  double b= 1.0; ///< Scale.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_gamma(r, a, b); }
+};
+
+
+/// Lognormal distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_lognormal
+struct ran_lognormal {
+  double zeta= 0.0; ///< Mean of logarithm.
+  double sigma= 1.0; ///< Standard deviation of logarithm.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const {
+    return gsl_ran_lognormal(r, zeta, sigma);
+  }
+};
+
+
+/// Chi-squared distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_chisq
+struct ran_chisq {
+  double nu; ///< Number of degrees of freedom.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_chisq(r, nu); }
+};
+
+
+/// Beta distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_beta
+struct ran_beta {
+  double a; ///< First shape-parameter.
+  double b; ///< Second shape-parameter.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  double operator()(gsl_rng *r) const { return gsl_ran_beta(r, a, b); }
+};
+
+
+/// Poisson distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_poisson
+struct ran_poisson {
+  double mu; ///< Mean.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  unsigned operator()(gsl_rng *r) const { return gsl_ran_poisson(r, mu); }
+};
+
+
+/// Bernoulli distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_bernoulli
+struct ran_bernoulli {
+  double p; ///< Probability of 1.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate, 0 or 1.
+  unsigned operator()(gsl_rng *r) const { return gsl_ran_bernoulli(r, p); }
+};
+
+
+/// Binomial distribution.
+/// https://www.gnu.org/software/gsl/doc/html/randist.html#c.gsl_ran_binomial
+struct ran_binomial {
+  double p; ///< Probability of success in each trial.
+  unsigned n; ///< Number of trials.
+
+  /// Draw variate.
+  /// @param r  Generator.
+  /// @return  Variate.
+  unsigned operator()(gsl_rng *r) const { return gsl_ran_binomial(r, p, n); }
+};
+
+
+} // namespace gsl
+
+// EOF
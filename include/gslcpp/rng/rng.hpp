@@ -0,0 +1,107 @@
+/// \dir        include/gslcpp/rng
+/// \brief      Types and functions specific to random numbers.
+
+/// \file       include/gslcpp/rng/rng.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::rng and gsl::splitmix64().
+
+#pragma once
+
+#include <cstdint> // uint64_t
+#include <gsl/gsl_rng.h> // gsl_rng, gsl_rng_alloc, etc.
+
+namespace gsl {
+
+
+/// Mix 64-bit value by the finalizer of SplitMix64 (Steele, Lea, and
+/// Flood, 2014).  Successive inputs yield statistically independent outputs,
+/// which makes this suitable for deriving many seeds from one.
+/// @param x  Value.
+/// @return  Mixed value.
+inline uint64_t splitmix64(uint64_t x) {
+  x+= 0x9e3779b97f4a7c15ULL;
+  x= (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  x= (x ^ (x >> 27)) * 0x94d049bb133111ebULL;
+  return x ^ (x >> 31);
+}
+
+
+/// Random-number generator.
+/// https://www.gnu.org/software/gsl/doc/html/rng.html
+///
+/// Move-construction is provided, and an explicit copy of the state is
+/// provided by clone(), but implicit copying is not.
+class rng {
+  gsl_rng *r_; ///< GSL's generator.
+
+  rng(rng const &)= delete; ///< Disable copying.
+  rng &operator=(rng const &)= delete; ///< Disable copying.
+
+  /// Take ownership of GSL's generator.
+  /// @param r  Pointer to GSL's generator.
+  explicit rng(gsl_rng *r): r_(r) {}
+
+public:
+  /// Type of algorithm for generation.
+  using type= gsl_rng_type;
+
+  /// Allocate and seed generator.
+  /// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_alloc
+  /// @param seed  Seed.
+  /// @param t  Algorithm for generation.
+  explicit rng(unsigned long seed= 0, type const *t= gsl_rng_mt19937):
+      r_(gsl_rng_alloc(t)) {
+    gsl_rng_set(r_, seed);
+  }
+
+  /// Move on construction.
+  /// @param src  Generator to move.
+  rng(rng &&src): r_(src.r_) { src.r_= nullptr; }
+
+  /// Deallocate generator.
+  ~rng() {
+    if(r_) gsl_rng_free(r_);
+  }
+
+  /// Generator with same algorithm and state.
+  /// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_clone
+  /// @return  Copy of generator.
+  rng clone() const { return rng(gsl_rng_clone(r_)); }
+
+  /// Pointer to GSL's generator.
+  /// @return  Pointer to GSL's generator.
+  gsl_rng *r() const { return r_; }
+
+  /// Name of algorithm.
+  /// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_name
+  /// @return  Name of algorithm.
+  char const *name() const { return gsl_rng_name(r_); }
+
+  /// Reseed generator.
+  /// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_set
+  /// @param seed  Seed.
+  void set(unsigned long seed) { gsl_rng_set(r_, seed); }
+
+  /// Random integer in range from min() to max().
+  /// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_get
+  /// @return  Random integer.
+  unsigned long get() const { return gsl_rng_get(r_); }
+
+  /// Least value returned by get().
+  /// @return  Least value.
+  unsigned long min() const { return gsl_rng_min(r_); }
+
+  /// Greatest value returned by get().
+  /// @return  Greatest value.
+  unsigned long max() const { return gsl_rng_max(r_); }
+
+  /// Random double-precision number uniformly distributed in `[0, 1)`.
+  /// https://www.gnu.org/software/gsl/doc/html/rng.html#c.gsl_rng_uniform
+  /// @return  Random number.
+  double uniform() const { return gsl_rng_uniform(r_); }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,110 @@
+/// \file       include/gslcpp/rng/v-fill.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::ran_fill() and gsl::ran_seed().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "ran.hpp" // ran_uniform, ran_gaussian, etc.
+#include "rng.hpp" // rng, splitmix64
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of elements filled from each independently seeded generator in
+/// parallel form of gsl::ran_fill().
+constexpr size_t rng_grain= size_t(1) << 16;
+
+
+/// Seed for chunk of parallel fill.  The seeds for successive chunks are the
+/// successive outputs of SplitMix64 whose initial state is `seed`, so that
+/// the streams of nearby chunks, and of nearby values of `seed`, are
+/// unrelated.
+/// @param seed  Seed for whole fill.
+/// @param k  Offset of chunk.
+/// @return  Seed for generator of chunk `k`.
+inline unsigned long ran_seed(unsigned long seed, size_t k) {
+  return (unsigned long)splitmix64(seed + k * 0x9e3779b97f4a7c15ULL);
+}
+
+
+/// Fill vector with variates from distribution, by single generator.
+///
+/// The state of `r` advances by one draw (or more, according to the
+/// distribution) for each element, in order.
+///
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam D  Type of distribution, like gsl::ran_gaussian, or other
+///            function-object `d(gsl_rng *)`.
+/// @param v  Vector, which may be strided view.
+/// @param d  Distribution.
+/// @param r  Generator.
+template<typename T, size_t N, template<typename, size_t> class V, typename D>
+void ran_fill(v_iface<T, N, V> &v, D const &d, rng const &r) {
+  size_t const n= v.size(), s= v.v()->stride;
+  T *const x= v.data();
+  gsl_rng *const g= r.r();
+  if(s == 1) {
+    for(size_t i= 0; i < n; ++i) x[i]= T(d(g));
+  } else {
+    for(size_t i= 0; i < n; ++i) x[i * s]= T(d(g));
+  }
+}
+
+
+/// Fill vector with variates from distribution, in parallel and
+/// reproducibly.
+///
+/// The vector is split into chunks of gsl::rng_grain elements.  Chunk `k` is
+/// filled by a generator of type `t` seeded by gsl::ran_seed(`seed`, `k`).
+/// The result thus depends only on `seed`, on `t`, and on the size of the
+/// vector, and not on the number of threads.  Each worker allocates one
+/// generator for the call and reseeds it for each chunk.
+///
+/// The streams of different chunks come from different seeds rather than
+/// from skip-ahead, which GSL's generators lack.  Some generators (like
+/// `gsl_rng_mt19937`) use only 32 bits of the seed.
+///
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam D  Type of distribution, like gsl::ran_gaussian, or other
+///            function-object `d(gsl_rng *)`.
+/// @param v  Vector, which may be strided view.
+/// @param d  Distribution.
+/// @param seed  Seed for whole fill.
+/// @param t  Algorithm for generation.
+/// @param p  Pool over which to distribute chunks.
+template<typename T, size_t N, template<typename, size_t> class V, typename D>
+void ran_fill(
+      v_iface<T, N, V> &v,
+      D const &d,
+      unsigned long seed,
+      rng::type const *t= gsl_rng_mt19937,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size(), s= v.v()->stride;
+  T *const x= v.data();
+  unsigned const workers= (n > rng_grain ? p.size() : 1);
+  std::vector<rng> g;
+  g.reserve(workers);
+  for(unsigned w= 0; w < workers; ++w) g.emplace_back(0, t);
+  auto const fill= [&](size_t b, size_t e, unsigned w) {
+    gsl_rng *const r= g[w].r();
+    gsl_rng_set(r, ran_seed(seed, b / rng_grain));
+    for(size_t i= b; i < e; ++i) x[i * s]= T(d(r));
+  };
+  if(n <= rng_grain) {
+    fill(0, n, 0);
+  } else {
+    p.for_chunks(n, rng_grain, fill);
+  }
+}
+
+
+} // namespace gsl
+
+// EOF
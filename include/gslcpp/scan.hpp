@@ -0,0 +1,9 @@
+/// \file       include/gslcpp/scan.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for prefix sums and scans.
+
+#pragma once
+
+#include "scan/v-scan.hpp" // inclusive_scan, exclusive_scan, cumsum, cumprod
+
+// EOF
@@ -0,0 +1,130 @@
+/// \dir        include/gslcpp/scan
+/// \brief      Types and functions specific to prefix sums and scans.
+
+/// \file       include/gslcpp/scan/scan-kernel.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::scan_reduce() and gsl::scan_range().
+
+#pragma once
+
+#include <cstddef> // size_t
+
+namespace gsl {
+
+
+// A serial scan is one long chain of dependent operations.  The kernels below
+// instead read four elements at a time and combine them by a log-step
+// (Hillis-Steele) scan in registers, so that only one operation per four
+// elements depends on the running total; the others overlap with it, and a
+// compiler may vectorize them.  For an operation that is associative
+// only approximately, like addition of `double`, the result may differ in
+// the last bits from that of the serial loop, but the association is fixed
+// by the offset of each element and not by the number of threads.
+
+
+/// Reduce range of elements by associative operation.
+/// \tparam T  Type of element.
+/// \tparam O  Type of binary operation.
+/// @param x  Pointer to first element.
+/// @param s  Stride of elements.
+/// @param n  Number of elements, which is positive.
+/// @param op  Operation.
+/// @return  Reduction of elements.
+template<typename T, typename O>
+T scan_reduce(T const *x, size_t s, size_t n, O const &op) {
+  T c= x[0];
+  size_t i= 1;
+  for(; i + 4 <= n; i+= 4) {
+    T const a0= x[i * s], a1= x[(i + 1) * s];
+    T const a2= x[(i + 2) * s], a3= x[(i + 3) * s];
+    c= op(c, op(op(a0, a1), op(a2, a3)));
+  }
+  for(; i < n; ++i) c= op(c, x[i * s]);
+  return c;
+}
+
+
+/// Scan range of elements by associative operation.  The local scan of the
+/// range is formed first, with the same association as in scan_reduce(), and
+/// then combined with the carry from before the range; the result is thus
+/// the same whether the carry be known before the scan or only after the
+/// reduction of every earlier range.  The input and the output may be the
+/// same.
+///
+/// For inclusive scan, output `k` is `carry` combined with local scan of
+/// inputs `[0, k]`.  For exclusive scan, output `0` is `carry`, and output
+/// `k` is `carry` combined with local scan of inputs `[0, k)`.
+///
+/// \tparam X  True for exclusive scan, false for inclusive scan.
+/// \tparam C  True only if `carry` be combined with each output; false only
+///            for the first range of an inclusive scan.
+/// \tparam T  Type of element.
+/// \tparam O  Type of binary operation.
+/// @param x  Pointer to first input.
+/// @param sx  Stride of input.
+/// @param y  Pointer to first output.
+/// @param sy  Stride of output.
+/// @param n  Number of elements, which is positive.
+/// @param carry  Reduction of every element before range.
+/// @param op  Operation.
+/// @return  Reduction of elements in range, without carry.
+template<bool X, bool C, typename T, typename O>
+T scan_range(
+      T const *x,
+      size_t sx,
+      T *y,
+      size_t sy,
+      size_t n,
+      T const &carry,
+      O const &op) {
+  static_assert(C || !X, "exclusive scan needs carry");
+  auto const put= [&](size_t i, T const &l) {
+    if constexpr(C) {
+      y[i * sy]= op(carry, l);
+    } else {
+      y[i * sy]= l;
+    }
+  };
+  T l= x[0];
+  size_t i= 1;
+  if constexpr(X) {
+    y[0]= carry;
+  } else {
+    put(0, l);
+  }
+  for(; i + 4 <= n; i+= 4) {
+    T const a0= x[i * sx], a1= x[(i + 1) * sx];
+    T const a2= x[(i + 2) * sx], a3= x[(i + 3) * sx];
+    T const b1= op(a0, a1), b3= op(a2, a3);
+    T const c2= op(b1, a2), c3= op(b1, b3);
+    if constexpr(X) {
+      put(i, l);
+      put(i + 1, op(l, a0));
+      put(i + 2, op(l, b1));
+      put(i + 3, op(l, c2));
+      l= op(l, c3);
+    } else {
+      put(i, op(l, a0));
+      put(i + 1, op(l, b1));
+      put(i + 2, op(l, c2));
+      l= op(l, c3);
+      put(i + 3, l);
+    }
+  }
+  for(; i < n; ++i) {
+    T const a= x[i * sx];
+    if constexpr(X) {
+      put(i, l);
+      l= op(l, a);
+    } else {
+      l= op(l, a);
+      put(i, l);
+    }
+  }
+  return l;
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,245 @@
+/// \file       include/gslcpp/scan/v-scan.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::inclusive_scan(), gsl::exclusive_scan(),
+///             gsl::cumsum(), and gsl::cumprod().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "scan-kernel.hpp" // scan_reduce, scan_range
+#include <algorithm> // min
+#include <functional> // multiplies, plus
+#include <stdexcept> // invalid_argument
+#include <type_traits> // is_same, remove_const_t
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of elements in each chunk of two-pass scan.  Because chunks are
+/// fixed in size, every scan is the same for any number of threads.
+constexpr size_t scan_grain= size_t(1) << 16;
+
+
+/// Scan elements in chunks of gsl::scan_grain.  If there be only one chunk,
+/// or only one worker in `p`, then the chunks are scanned in order, in one
+/// pass, each from the carry out of the one before.  Otherwise, there are
+/// two passes.  The first reduces every chunk but the last, in parallel; the
+/// carry into each chunk is accumulated serially over the reductions; and
+/// the second pass scans each chunk in parallel from its carry.  Both ways
+/// give the same result.  The input and the output may be the same.
+/// \tparam X  True for exclusive scan, false for inclusive scan.
+/// \tparam T  Type of element.
+/// \tparam O  Type of binary operation.
+/// @param x  Pointer to first input.
+/// @param sx  Stride of input.
+/// @param y  Pointer to first output.
+/// @param sy  Stride of output.
+/// @param n  Number of elements.
+/// @param init  Initial value for exclusive scan, ignored for inclusive.
+/// @param op  Associative operation.
+/// @param p  Pool over which to distribute chunks.
+template<bool X, typename T, typename O>
+void scan_chunks(
+      T const *x,
+      size_t sx,
+      T *y,
+      size_t sy,
+      size_t n,
+      T const &init,
+      O const &op,
+      thread_pool &p) {
+  if(n == 0) return;
+  // Scan chunk [b, e) from carry; return reduction of chunk.
+  auto const chunk= [&](size_t b, size_t e, T const &carry) {
+    T const *const xb= x + b * sx;
+    T *const yb= y + b * sy;
+    if constexpr(!X) {
+      if(b == 0) return scan_range<X, false>(xb, sx, yb, sy, e, carry, op);
+    }
+    return scan_range<X, true>(xb, sx, yb, sy, e - b, carry, op);
+  };
+  if(n <= scan_grain || p.size() == 1) {
+    T carry= init;
+    for(size_t b= 0; b < n; b+= scan_grain) {
+      T const r= chunk(b, std::min(n, b + scan_grain), carry);
+      carry= (!X && b == 0) ? r : op(carry, r);
+    }
+    return;
+  }
+  size_t const nc= (n + scan_grain - 1) / scan_grain;
+  std::vector<T> c(nc, init);
+  // Every chunk but the last is reduced.
+  size_t const r= (nc - 1) * scan_grain;
+  p.for_chunks(r, scan_grain, [&](size_t b, size_t e, unsigned) {
+    c[b / scan_grain + 1]= scan_reduce(x + b * sx, sx, e - b, op);
+  });
+  if constexpr(X) c[1]= op(init, c[1]);
+  for(size_t k= 2; k < nc; ++k) c[k]= op(c[k - 1], c[k]);
+  p.for_chunks(n, scan_grain, [&](size_t b, size_t e, unsigned) {
+    chunk(b, e, c[b / scan_grain]);
+  });
+}
+
+
+/// Inclusive scan: `dst[i]` is `src[0]` combined by `op` with every element
+/// through `src[i]`.  Chunks of a large vector are scanned in parallel, as
+/// described in the narrative documentation.  `src` and `dst` may be the
+/// same vector.
+/// \tparam T  Type of element in source.
+/// \tparam N  Compile-time number of elements in source.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of element in destination.
+/// \tparam M  Compile-time number of elements in destination.
+/// \tparam W  Type of interface to storage of destination.
+/// \tparam O  Type of associative operation.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param op  Associative operation, by default addition.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W,
+      typename O= std::plus<U>>
+void inclusive_scan(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      O const &op= O(),
+      thread_pool &p= thread_pool::global()) {
+  static_assert(std::is_same<std::remove_const_t<T>, U>::value);
+  if(src.size() != dst.size()) throw std::invalid_argument("mismatch in size");
+  scan_chunks<false, U>(
+        src.data(), src.v()->stride, dst.data(), dst.v()->stride,
+        src.size(), U(), op, p);
+}
+
+
+/// Exclusive scan: `dst[i]` is `init` combined by `op` with every element
+/// before `src[i]`, so that `dst[0]` is `init`.  Chunks of a large vector
+/// are scanned in parallel.  `src` and `dst` may be the same vector.
+/// \tparam T  Type of element in source.
+/// \tparam N  Compile-time number of elements in source.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of element in destination.
+/// \tparam M  Compile-time number of elements in destination.
+/// \tparam W  Type of interface to storage of destination.
+/// \tparam O  Type of associative operation.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param init  Initial value, which should be identity of `op`.
+/// @param op  Associative operation, by default addition.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W,
+      typename O= std::plus<U>>
+void exclusive_scan(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      U const &init= U(0),
+      O const &op= O(),
+      thread_pool &p= thread_pool::global()) {
+  static_assert(std::is_same<std::remove_const_t<T>, U>::value);
+  if(src.size() != dst.size()) throw std::invalid_argument("mismatch in size");
+  scan_chunks<true, U>(
+        src.data(), src.v()->stride, dst.data(), dst.v()->stride,
+        src.size(), init, op, p);
+}
+
+
+/// Cumulative sum, in place.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose element `i` becomes sum of elements `[0, i]`.
+/// @param p  Pool over which to distribute chunks.
+template<typename T, size_t N, template<typename, size_t> class V>
+void cumsum(v_iface<T, N, V> &v, thread_pool &p= thread_pool::global()) {
+  gsl::inclusive_scan(v, v, std::plus<T>(), p);
+}
+
+
+/// Cumulative sum into another vector.
+/// \tparam T  Type of element in source.
+/// \tparam N  Compile-time number of elements in source.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of element in destination.
+/// \tparam M  Compile-time number of elements in destination.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, whose element `i` becomes sum of
+///             elements `[0, i]` of `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void cumsum(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  gsl::inclusive_scan(src, dst, std::plus<U>(), p);
+}
+
+
+/// Cumulative product, in place.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector, whose element `i` becomes product of elements `[0, i]`.
+/// @param p  Pool over which to distribute chunks.
+template<typename T, size_t N, template<typename, size_t> class V>
+void cumprod(v_iface<T, N, V> &v, thread_pool &p= thread_pool::global()) {
+  gsl::inclusive_scan(v, v, std::multiplies<T>(), p);
+}
+
+
+/// Cumulative product into another vector.
+/// \tparam T  Type of element in source.
+/// \tparam N  Compile-time number of elements in source.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of element in destination.
+/// \tparam M  Compile-time number of elements in destination.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, whose element `i` becomes product of
+///             elements `[0, i]` of `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void cumprod(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  gsl::inclusive_scan(src, dst, std::multiplies<U>(), p);
+}
+
+
+} // namespace gsl
+
+// EOF
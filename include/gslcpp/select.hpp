@@ -0,0 +1,10 @@
+/// \file       include/gslcpp/select.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for selection by predicate or mask.
+
+#pragma once
+
+#include "select/compress.hpp" // count_if, compress
+#include "select/where.hpp" // mask_if, where, transform_where, add_where, etc.
+
+// EOF
@@ -0,0 +1,247 @@
+/// \dir        include/gslcpp/select
+/// \brief      Types and functions specific to selection by predicate or
+///             mask.
+
+/// \file       include/gslcpp/select/compress.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::count_if() and gsl::compress().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vector.hpp" // vector
+#include <algorithm> // min
+#include <stdexcept> // invalid_argument, length_error
+#include <type_traits> // remove_const_t
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of elements in each chunk of parallel selection.  Chunks are fixed
+/// in size, and selected elements keep their order, so that every result is
+/// the same for any number of threads.
+constexpr size_t select_grain= size_t(1) << 16;
+
+
+/// Number of elements compacted through buffer on stack at one time.
+constexpr size_t select_block= 256;
+
+
+/// Count elements of range that satisfy predicate.
+/// \tparam T  Type of element.
+/// \tparam P  Type of predicate.
+/// @param x  Pointer to first element of vector.
+/// @param s  Stride of vector.
+/// @param b  Offset of first element in range.
+/// @param e  Offset past last element in range.
+/// @param pred  Predicate.
+/// @return  Number of elements for which `pred` is true.
+template<typename T, typename P>
+size_t count_range(T const *x, size_t s, size_t b, size_t e, P const &pred) {
+  size_t k= 0;
+  for(size_t i= b; i < e; ++i) k+= size_t(bool(pred(x[i * s])));
+  return k;
+}
+
+
+/// Copy elements of range that satisfy predicate, in order, to destination.
+///
+/// Each element is written to a buffer on the stack whether it be selected
+/// or not, and the count advances by the value of the predicate, so that
+/// there is no branch on the predicate.  The selected prefix of the buffer
+/// is then copied out.  Nothing is written past the last selected element.
+///
+/// \tparam T  Type of source element.
+/// \tparam P  Type of predicate.
+/// \tparam U  Type of destination element.
+/// @param x  Pointer to first element of source.
+/// @param sx  Stride of source.
+/// @param b  Offset of first element in range.
+/// @param e  Offset past last element in range.
+/// @param pred  Predicate.
+/// @param y  Pointer to first element of destination.
+/// @param sy  Stride of destination.
+/// @param o  Offset in destination of first selected element.
+/// @return  Number of selected elements.
+template<typename T, typename P, typename U>
+size_t compress_range(
+      T const *x,
+      size_t sx,
+      size_t b,
+      size_t e,
+      P const &pred,
+      U *y,
+      size_t sy,
+      size_t o) {
+  std::remove_const_t<T> buf[select_block];
+  size_t const o0= o;
+  for(size_t i= b; i < e; i+= select_block) {
+    size_t const m= std::min(select_block, e - i);
+    size_t k= 0;
+    for(size_t j= 0; j < m; ++j) {
+      T const a= x[(i + j) * sx];
+      buf[k]= a;
+      k+= size_t(bool(pred(a)));
+    }
+    for(size_t j= 0; j < k; ++j) y[(o + j) * sy]= U(buf[j]);
+    o+= k;
+  }
+  return o - o0;
+}
+
+
+/// Offset in destination of first selected element of each chunk of
+/// gsl::select_grain elements, and, at the end, total number of selected
+/// elements.  Chunks are counted in parallel, and the counts are then
+/// converted to offsets by an exclusive scan.
+/// \tparam T  Type of element.
+/// \tparam P  Type of predicate.
+/// @param x  Pointer to first element of vector.
+/// @param s  Stride of vector.
+/// @param n  Number of elements.
+/// @param pred  Predicate.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Offsets, one more than the number of chunks.
+template<typename T, typename P>
+std::vector<size_t>
+select_offsets(T const *x, size_t s, size_t n, P const &pred, thread_pool &p) {
+  size_t const nc= (n + select_grain - 1) / select_grain;
+  std::vector<size_t> off(nc + 1, 0);
+  p.for_chunks(n, select_grain, [&](size_t b, size_t e, unsigned) {
+    off[b / select_grain + 1]= count_range(x, s, b, e, pred);
+  });
+  for(size_t c= 1; c <= nc; ++c) off[c]+= off[c - 1];
+  return off;
+}
+
+
+/// Number of elements that satisfy predicate.  Chunks of gsl::select_grain
+/// elements are counted in parallel.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam P  Type of predicate `pred(x)`, convertible to `bool`.
+/// @param v  Vector.
+/// @param pred  Predicate.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Number of elements for which `pred` is true.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename P>
+size_t count_if(
+      v_iface<T, N, V> const &v,
+      P const &pred,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size(), s= v.v()->stride;
+  T const *const x= v.data();
+  if(n <= select_grain || p.size() == 1) return count_range(x, s, 0, n, pred);
+  return select_offsets(x, s, n, pred, p).back();
+}
+
+
+/// Copy elements that satisfy predicate, in order, to front of destination.
+///
+/// If there be more than gsl::select_grain elements and more than one
+/// worker in `p`, then compaction is parallel and in two passes.  The first
+/// pass counts the selected elements of each chunk; an exclusive scan of the
+/// counts gives the offset in `dst` for each chunk; and the second pass
+/// compacts each chunk into place.  The predicate is then evaluated twice
+/// for each element and so should have no side-effect.
+///
+/// Otherwise, if `dst` be at least as large as `src`, compaction is serial
+/// and in one pass.
+///
+/// Nothing is written to `dst` unless it be large enough.  Elements of `dst`
+/// past the returned count are not modified.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam P  Type of predicate `pred(x)`, convertible to `bool`.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param pred  Predicate.
+/// @param dst  Destination vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Number of selected elements.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename P,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+size_t compress(
+      v_iface<T, N, V> const &src,
+      P const &pred,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= src.size(), sx= src.v()->stride, sy= dst.v()->stride;
+  T const *const x= src.data();
+  U *const y= dst.data();
+  bool const serial= (n <= select_grain || p.size() == 1);
+  if(serial && dst.size() >= n) {
+    return compress_range(x, sx, 0, n, pred, y, sy, 0);
+  }
+  std::vector<size_t> const off= select_offsets(x, sx, n, pred, p);
+  if(off.back() > dst.size()) throw std::invalid_argument("mismatch in size");
+  if(serial) return compress_range(x, sx, 0, n, pred, y, sy, 0);
+  p.for_chunks(n, select_grain, [&](size_t b, size_t e, unsigned) {
+    compress_range(x, sx, b, e, pred, y, sy, off[b / select_grain]);
+  });
+  return off.back();
+}
+
+
+/// Vector of elements that satisfy predicate, in order.
+///
+/// The selected elements are counted in parallel, the result is allocated
+/// at its exact size, and the elements are compacted into it as by
+/// gsl::compress() with a destination.  GSL cannot allocate a vector of
+/// zero length, and so, if no element be selected, then `std::length_error`
+/// is thrown; where that is possible, call gsl::count_if() first, or use the
+/// form with a destination.
+///
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam P  Type of predicate `pred(x)`, convertible to `bool`.
+/// @param src  Source vector.
+/// @param pred  Predicate.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of selected elements.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename P>
+vector<std::remove_const_t<T>> compress(
+      v_iface<T, N, V> const &src,
+      P const &pred,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= src.size(), sx= src.v()->stride;
+  T const *const x= src.data();
+  std::vector<size_t> const off= select_offsets(x, sx, n, pred, p);
+  if(off.back() == 0) throw std::length_error("no element selected");
+  vector<std::remove_const_t<T>> r(off.back());
+  auto *const y= r.data();
+  p.for_chunks(n, select_grain, [&](size_t b, size_t e, unsigned) {
+    compress_range(x, sx, b, e, pred, y, 1, off[b / select_grain]);
+  });
+  return r;
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,428 @@
+/// \file       include/gslcpp/select/where.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::where(), gsl::transform_where(), and
+///             masked arithmetic.
+
+#pragma once
+
+#include "compress.hpp" // select_grain
+#include <functional> // divides, minus, multiplies, plus
+#include <stdexcept> // invalid_argument
+#include <type_traits> // remove_const_t
+
+namespace gsl {
+
+
+// A mask is any gsl::v_iface, typically of `unsigned char`, whose nonzero
+// elements select.  Every loop below is written with a conditional
+// expression rather than a branch, so that the compiler may turn it into a
+// blend, and each is split over chunks of gsl::select_grain elements.
+
+
+/// Call `f(b, e)` over `[0, n)`, serially or in parallel chunks.
+/// \tparam F  Type of function.
+/// @param n  Number of elements.
+/// @param f  Function of range `[b, e)`.
+/// @param p  Pool over which to distribute chunks.
+template<typename F> void select_for(size_t n, F const &f, thread_pool &p) {
+  if(n <= select_grain || p.size() == 1) {
+    f(0, n);
+    return;
+  }
+  p.for_chunks(n, select_grain, [&](size_t b, size_t e, unsigned) {
+    f(b, e);
+  });
+}
+
+
+/// Mask of elements that satisfy predicate.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam P  Type of predicate `pred(x)`, convertible to `bool`.
+/// @param v  Vector.
+/// @param pred  Predicate.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector with 1 where `pred` is true, and 0 elsewhere.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename P>
+vector<unsigned char> mask_if(
+      v_iface<T, N, V> const &v,
+      P const &pred,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size(), s= v.v()->stride;
+  T const *const x= v.data();
+  vector<unsigned char> m(n);
+  unsigned char *const d= m.data();
+  select_for(
+        n,
+        [&](size_t b, size_t e) {
+          for(size_t i= b; i < e; ++i) d[i]= bool(pred(x[i * s]));
+        },
+        p);
+  return m;
+}
+
+
+/// Choose each element from one of two vectors, by mask:
+/// `dst[i]= mask[i] ? a[i] : b[i]`.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam T  Type of element in `a`.
+/// \tparam NA  Compile-time number of elements in `a`.
+/// \tparam VA  Type of interface to storage of `a`.
+/// \tparam U  Type of element in `b`.
+/// \tparam NB  Compile-time number of elements in `b`.
+/// \tparam VB  Type of interface to storage of `b`.
+/// \tparam R  Type of element in destination.
+/// \tparam NR  Compile-time number of elements in destination.
+/// \tparam VR  Type of interface to storage of destination.
+/// @param mask  Mask.
+/// @param a  Elements chosen where mask is nonzero.
+/// @param b  Elements chosen where mask is zero.
+/// @param dst  Destination, which may be `a` or `b`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename T,
+      size_t NA,
+      template<typename, size_t>
+      class VA,
+      typename U,
+      size_t NB,
+      template<typename, size_t>
+      class VB,
+      typename R,
+      size_t NR,
+      template<typename, size_t>
+      class VR>
+void where(
+      v_iface<K, NK, VK> const &mask,
+      v_iface<T, NA, VA> const &a,
+      v_iface<U, NB, VB> const &b,
+      v_iface<R, NR, VR> &dst,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= mask.size();
+  if(a.size() != n || b.size() != n || dst.size() != n) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  size_t const sk= mask.v()->stride, sa= a.v()->stride;
+  size_t const sb= b.v()->stride, sr= dst.v()->stride;
+  K const *const k= mask.data();
+  T const *const x= a.data();
+  U const *const y= b.data();
+  R *const z= dst.data();
+  select_for(
+        n,
+        [&](size_t e0, size_t e1) {
+          for(size_t i= e0; i < e1; ++i) {
+            z[i * sr]= (k[i * sk] != K(0)) ? R(x[i * sa]) : R(y[i * sb]);
+          }
+        },
+        p);
+}
+
+
+/// Vector whose each element is chosen from one of two vectors, by mask:
+/// `r[i]= mask[i] ? a[i] : b[i]`.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam T  Type of element in `a` and `b`.
+/// \tparam NA  Compile-time number of elements in `a`.
+/// \tparam VA  Type of interface to storage of `a`.
+/// \tparam NB  Compile-time number of elements in `b`.
+/// \tparam VB  Type of interface to storage of `b`.
+/// @param mask  Mask.
+/// @param a  Elements chosen where mask is nonzero.
+/// @param b  Elements chosen where mask is zero.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of chosen elements.
+template<
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename T,
+      size_t NA,
+      template<typename, size_t>
+      class VA,
+      size_t NB,
+      template<typename, size_t>
+      class VB>
+vector<std::remove_const_t<T>> where(
+      v_iface<K, NK, VK> const &mask,
+      v_iface<T, NA, VA> const &a,
+      v_iface<T, NB, VB> const &b,
+      thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(mask.size());
+  where(mask, a, b, r, p);
+  return r;
+}
+
+
+/// Replace each masked element by function of itself:
+/// `v[i]= f(v[i])` where `mask[i]` is nonzero.  The function is evaluated
+/// for every element, so that the loop has no branch, and so should be
+/// cheap and free of side-effect.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam F  Type of function `f(x)`.
+/// @param v  Vector.
+/// @param mask  Mask.
+/// @param f  Function.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename F>
+void transform_where(
+      v_iface<T, N, V> &v,
+      v_iface<K, NK, VK> const &mask,
+      F const &f,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size();
+  if(mask.size() != n) throw std::invalid_argument("mismatch in size");
+  size_t const s= v.v()->stride, sk= mask.v()->stride;
+  T *const x= v.data();
+  K const *const k= mask.data();
+  select_for(
+        n,
+        [&](size_t b, size_t e) {
+          for(size_t i= b; i < e; ++i) {
+            T const a= x[i * s], r= T(f(a));
+            x[i * s]= (k[i * sk] != K(0)) ? r : a;
+          }
+        },
+        p);
+}
+
+
+/// Combine each masked element with corresponding element of other vector:
+/// `v[i]= op(v[i], b[i])` where `mask[i]` is nonzero.  The operation is
+/// evaluated for every element, so that the loop has no branch; where
+/// `mask[i]` is zero, `id` replaces `b[i]`, so that no element outside mask
+/// can overflow or divide by zero.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam U  Type of element in other vector.
+/// \tparam NB  Compile-time number of elements in other vector.
+/// \tparam VB  Type of interface to storage of other vector.
+/// \tparam O  Type of binary operation.
+/// @param v  Vector.
+/// @param mask  Mask.
+/// @param b  Other vector.
+/// @param op  Operation.
+/// @param id  Right identity of operation.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename U,
+      size_t NB,
+      template<typename, size_t>
+      class VB,
+      typename O>
+void combine_where(
+      v_iface<T, N, V> &v,
+      v_iface<K, NK, VK> const &mask,
+      v_iface<U, NB, VB> const &b,
+      O const &op,
+      T id,
+      thread_pool &p) {
+  size_t const n= v.size();
+  if(mask.size() != n || b.size() != n) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  size_t const s= v.v()->stride, sk= mask.v()->stride, sb= b.v()->stride;
+  T *const x= v.data();
+  K const *const k= mask.data();
+  U const *const y= b.data();
+  select_for(
+        n,
+        [&](size_t e0, size_t e1) {
+          for(size_t i= e0; i < e1; ++i) {
+            bool const m= (k[i * sk] != K(0));
+            T const a= x[i * s], r= T(op(a, m ? T(y[i * sb]) : id));
+            x[i * s]= m ? r : a;
+          }
+        },
+        p);
+}
+
+
+/// Add other vector where mask is nonzero: `v[i]+= b[i]`.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam U  Type of element in other vector.
+/// \tparam NB  Compile-time number of elements in other vector.
+/// \tparam VB  Type of interface to storage of other vector.
+/// @param v  Vector.
+/// @param mask  Mask.
+/// @param b  Other vector.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename U,
+      size_t NB,
+      template<typename, size_t>
+      class VB>
+void add_where(
+      v_iface<T, N, V> &v,
+      v_iface<K, NK, VK> const &mask,
+      v_iface<U, NB, VB> const &b,
+      thread_pool &p= thread_pool::global()) {
+  combine_where(v, mask, b, std::plus<T>(), T(0), p);
+}
+
+
+/// Subtract other vector where mask is nonzero: `v[i]-= b[i]`.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam U  Type of element in other vector.
+/// \tparam NB  Compile-time number of elements in other vector.
+/// \tparam VB  Type of interface to storage of other vector.
+/// @param v  Vector.
+/// @param mask  Mask.
+/// @param b  Other vector.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename U,
+      size_t NB,
+      template<typename, size_t>
+      class VB>
+void sub_where(
+      v_iface<T, N, V> &v,
+      v_iface<K, NK, VK> const &mask,
+      v_iface<U, NB, VB> const &b,
+      thread_pool &p= thread_pool::global()) {
+  combine_where(v, mask, b, std::minus<T>(), T(0), p);
+}
+
+
+/// Multiply by other vector where mask is nonzero: `v[i]*= b[i]`.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam U  Type of element in other vector.
+/// \tparam NB  Compile-time number of elements in other vector.
+/// \tparam VB  Type of interface to storage of other vector.
+/// @param v  Vector.
+/// @param mask  Mask.
+/// @param b  Other vector.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename U,
+      size_t NB,
+      template<typename, size_t>
+      class VB>
+void mul_where(
+      v_iface<T, N, V> &v,
+      v_iface<K, NK, VK> const &mask,
+      v_iface<U, NB, VB> const &b,
+      thread_pool &p= thread_pool::global()) {
+  combine_where(v, mask, b, std::multiplies<T>(), T(1), p);
+}
+
+
+/// Divide by other vector where mask is nonzero: `v[i]/= b[i]`.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam K  Type of element in mask.
+/// \tparam NK  Compile-time number of elements in mask.
+/// \tparam VK  Type of interface to storage of mask.
+/// \tparam U  Type of element in other vector.
+/// \tparam NB  Compile-time number of elements in other vector.
+/// \tparam VB  Type of interface to storage of other vector.
+/// @param v  Vector.
+/// @param mask  Mask.
+/// @param b  Other vector.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename K,
+      size_t NK,
+      template<typename, size_t>
+      class VK,
+      typename U,
+      size_t NB,
+      template<typename, size_t>
+      class VB>
+void div_where(
+      v_iface<T, N, V> &v,
+      v_iface<K, NK, VK> const &mask,
+      v_iface<U, NB, VB> const &b,
+      thread_pool &p= thread_pool::global()) {
+  combine_where(v, mask, b, std::divides<T>(), T(1), p);
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,11 @@
+/// \file       include/gslcpp/sf.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for special functions over vectors.
+
+#pragma once
+
+#include "sf/sf-array.hpp" // sf_bessel_Jn_array, sf_legendre_Pl_array, etc.
+#include "sf/sf-eval.hpp" // sf_eval
+#include "sf/sf-func.hpp" // sf_bessel_Jn, sf_gamma, sf_erf, etc.
+
+// EOF
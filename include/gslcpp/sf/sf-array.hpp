@@ -0,0 +1,159 @@
+/// \file       include/gslcpp/sf/sf-array.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::sf_bessel_Jn_array(),
+///             gsl::sf_bessel_Yn_array(), and gsl::sf_legendre_Pl_array()
+///             over vectors.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "sf-eval.hpp" // sf_grain
+#include <algorithm> // max, min
+#include <gsl/gsl_matrix.h> // gsl_matrix, gsl_matrix_ptr
+#include <gsl/gsl_sf_bessel.h> // gsl_sf_bessel_Jn_array, etc.
+#include <gsl/gsl_sf_legendre.h> // gsl_sf_legendre_Pl_array
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+// For a range of orders at one argument, GSL provides array-functions that
+// run a recurrence over the orders, which is much cheaper than evaluating
+// each order by itself.  The functions below call the array-function at each
+// element of a vector of arguments, writing one row of a matrix for each
+// argument, and distribute the rows over a gsl::thread_pool.
+
+
+/// Evaluate array-function at each argument, into corresponding row of
+/// matrix.  Rows are distributed in chunks of about gsl::sf_grain values.
+/// \tparam T  Type of argument.
+/// \tparam N  Compile-time number of arguments.
+/// \tparam V  Type of interface to storage of arguments.
+/// \tparam F  Type of function `f(x, row)` that write values at argument `x`
+///            into contiguous `double *row` and return GSL's status.
+/// @param src  Arguments.
+/// @param out  Matrix with one row for each argument.
+/// @param m  Number of columns required in `out`.
+/// @param f  Array-function.
+/// @param p  Pool over which to distribute rows.
+/// @return  Zero, or status of first row for which `f` failed.
+template<typename T, size_t N, template<typename, size_t> class V, typename F>
+int sf_array_rows(
+      v_iface<T, N, V> const &src,
+      gsl_matrix *out,
+      size_t m,
+      F const &f,
+      thread_pool &p) {
+  size_t const n= src.size(), s= src.v()->stride;
+  if(out->size1 != n || out->size2 != m) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  T const *const x= src.data();
+  size_t const g= std::max(size_t(1), sf_grain / m);
+  std::vector<int> status((n + g - 1) / g);
+  auto const rows= [&](size_t b, size_t e, unsigned) {
+    int &st= status[b / g];
+    for(size_t i= b; i < e; ++i) {
+      int const r= f(double(x[i * s]), gsl_matrix_ptr(out, i, 0));
+      if(r && !st) st= r;
+    }
+  };
+  if(n <= g || p.size() == 1) {
+    for(size_t b= 0; b < n; b+= g) rows(b, std::min(n, b + g), 0);
+  } else {
+    p.for_chunks(n, g, rows);
+  }
+  for(int r: status) {
+    if(r) return r;
+  }
+  return 0;
+}
+
+
+/// Regular cylindrical Bessel-functions of orders `[nmin, nmax]` at each
+/// argument, by GSL's downward recurrence over order.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_bessel_Jn_array
+/// \tparam T  Type of argument.
+/// \tparam N  Compile-time number of arguments.
+/// \tparam V  Type of interface to storage of arguments.
+/// @param nmin  Least order.
+/// @param nmax  Greatest order, not less than `nmin`.
+/// @param src  Arguments.
+/// @param out  Matrix whose element `(i, k)` becomes `J_{nmin+k}(src[i])`;
+///             one row for each argument, and `nmax - nmin + 1` columns.
+/// @param p  Pool over which to distribute rows.
+/// @return  Zero, or status of first row for which GSL failed.
+template<typename T, size_t N, template<typename, size_t> class V>
+int sf_bessel_Jn_array(
+      int nmin,
+      int nmax,
+      v_iface<T, N, V> const &src,
+      gsl_matrix *out,
+      thread_pool &p= thread_pool::global()) {
+  if(nmax < nmin) throw std::invalid_argument("nmax less than nmin");
+  auto const f= [nmin, nmax](double x, double *r) {
+    return gsl_sf_bessel_Jn_array(nmin, nmax, x, r);
+  };
+  return sf_array_rows(src, out, size_t(nmax - nmin + 1), f, p);
+}
+
+
+/// Irregular cylindrical Bessel-functions of orders `[nmin, nmax]` at each
+/// argument, by GSL's upward recurrence over order.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_bessel_Yn_array
+/// \tparam T  Type of argument.
+/// \tparam N  Compile-time number of arguments.
+/// \tparam V  Type of interface to storage of arguments.
+/// @param nmin  Least order.
+/// @param nmax  Greatest order, not less than `nmin`.
+/// @param src  Arguments, each positive.
+/// @param out  Matrix whose element `(i, k)` becomes `Y_{nmin+k}(src[i])`;
+///             one row for each argument, and `nmax - nmin + 1` columns.
+/// @param p  Pool over which to distribute rows.
+/// @return  Zero, or status of first row for which GSL failed.
+template<typename T, size_t N, template<typename, size_t> class V>
+int sf_bessel_Yn_array(
+      int nmin,
+      int nmax,
+      v_iface<T, N, V> const &src,
+      gsl_matrix *out,
+      thread_pool &p= thread_pool::global()) {
+  if(nmax < nmin) throw std::invalid_argument("nmax less than nmin");
+  auto const f= [nmin, nmax](double x, double *r) {
+    return gsl_sf_bessel_Yn_array(nmin, nmax, x, r);
+  };
+  return sf_array_rows(src, out, size_t(nmax - nmin + 1), f, p);
+}
+
+
+/// Legendre-polynomials of degrees `[0, lmax]` at each argument, by GSL's
+/// upward recurrence over degree.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_legendre_Pl_array
+/// \tparam T  Type of argument.
+/// \tparam N  Compile-time number of arguments.
+/// \tparam V  Type of interface to storage of arguments.
+/// @param lmax  Greatest degree, not negative.
+/// @param src  Arguments, each in `[-1, 1]`.
+/// @param out  Matrix whose element `(i, l)` becomes `P_l(src[i])`; one row
+///             for each argument, and `lmax + 1` columns.
+/// @param p  Pool over which to distribute rows.
+/// @return  Zero, or status of first row for which GSL failed.
+template<typename T, size_t N, template<typename, size_t> class V>
+int sf_legendre_Pl_array(
+      int lmax,
+      v_iface<T, N, V> const &src,
+      gsl_matrix *out,
+      thread_pool &p= thread_pool::global()) {
+  if(lmax < 0) throw std::invalid_argument("negative lmax");
+  auto const f= [lmax](double x, double *r) {
+    return gsl_sf_legendre_Pl_array(lmax, x, r);
+  };
+  return sf_array_rows(src, out, size_t(lmax + 1), f, p);
+}
+
+
+} // namespace gsl
+
+// EOF
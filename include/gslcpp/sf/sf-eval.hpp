@@ -0,0 +1,195 @@
+/// \dir        include/gslcpp/sf
+/// \brief      Types and functions specific to special functions over
+///             vectors.
+
+/// \file       include/gslcpp/sf/sf-eval.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::sf_eval().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include <gsl/gsl_sf_result.h> // gsl_sf_result
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of elements in each chunk of parallel evaluation of special
+/// function.  A special function costs far more than an arithmetic
+/// operation, and so the grain is small.
+constexpr size_t sf_grain= size_t(1) << 10;
+
+
+/// Evaluate special function over range of elements.
+/// \tparam T  Type of argument.
+/// \tparam U  Type of value.
+/// \tparam F  Type of function `f(x, r)`, like `gsl_sf_erf_e`, that write
+///            value and estimate of error into `gsl_sf_result *r` and return
+///            GSL's status.
+/// @param x  Pointer to first argument.
+/// @param sx  Stride of arguments.
+/// @param y  Pointer to first value.
+/// @param sy  Stride of values.
+/// @param e  Pointer to first estimate of error, or null.
+/// @param se  Stride of estimates.
+/// @param b  Offset of first element in range.
+/// @param n  Offset past last element in range.
+/// @param f  Function.
+/// @return  Zero, or status of first element for which `f` failed.
+template<typename T, typename U, typename F>
+int sf_range(
+      T const *x,
+      size_t sx,
+      U *y,
+      size_t sy,
+      U *e,
+      size_t se,
+      size_t b,
+      size_t n,
+      F const &f) {
+  int status= 0;
+  for(size_t i= b; i < n; ++i) {
+    gsl_sf_result r;
+    int const s= f(double(x[i * sx]), &r);
+    y[i * sy]= U(r.val);
+    if(e) e[i * se]= U(r.err);
+    if(s && !status) status= s;
+  }
+  return status;
+}
+
+
+/// Evaluate special function over vector of arguments, in chunks of
+/// gsl::sf_grain.
+/// \tparam T  Type of argument.
+/// \tparam U  Type of value.
+/// \tparam F  Type of function.
+/// @param x  Pointer to first argument.
+/// @param sx  Stride of arguments.
+/// @param y  Pointer to first value.
+/// @param sy  Stride of values.
+/// @param e  Pointer to first estimate of error, or null.
+/// @param se  Stride of estimates.
+/// @param n  Number of elements.
+/// @param f  Function.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Zero, or status of first element for which `f` failed.
+template<typename T, typename U, typename F>
+int sf_chunks(
+      T const *x,
+      size_t sx,
+      U *y,
+      size_t sy,
+      U *e,
+      size_t se,
+      size_t n,
+      F const &f,
+      thread_pool &p) {
+  if(n <= sf_grain || p.size() == 1) {
+    return sf_range(x, sx, y, sy, e, se, 0, n, f);
+  }
+  std::vector<int> status((n + sf_grain - 1) / sf_grain);
+  p.for_chunks(n, sf_grain, [&](size_t b, size_t c, unsigned) {
+    status[b / sf_grain]= sf_range(x, sx, y, sy, e, se, b, c, f);
+  });
+  for(int s: status) {
+    if(s) return s;
+  }
+  return 0;
+}
+
+
+/// Evaluate special function at every element.
+///
+/// Chunks of gsl::sf_grain elements are evaluated in parallel.  GSL's
+/// default handler of errors aborts the program; to get a nonzero status
+/// instead, call `gsl_set_error_handler_off()` first.  Every element is
+/// evaluated even if some fail.
+///
+/// \tparam T  Type of argument.
+/// \tparam N  Compile-time number of arguments.
+/// \tparam V  Type of interface to storage of arguments.
+/// \tparam U  Type of value.
+/// \tparam M  Compile-time number of values.
+/// \tparam W  Type of interface to storage of values.
+/// \tparam F  Type of function `f(x, r)`, like `gsl_sf_erf_e`, that write
+///            value and estimate of error into `gsl_sf_result *r` and return
+///            GSL's status.
+/// @param src  Arguments.
+/// @param dst  Values, as many as arguments; may be same as `src`.
+/// @param f  Function.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Zero, or status of first element for which `f` failed.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W,
+      typename F>
+int sf_eval(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      F const &f,
+      thread_pool &p= thread_pool::global()) {
+  if(src.size() != dst.size()) throw std::invalid_argument("mismatch in size");
+  return sf_chunks(
+        src.data(), src.v()->stride, dst.data(), dst.v()->stride,
+        (U *)nullptr, 0, src.size(), f, p);
+}
+
+
+/// Evaluate special function at every element, with estimate of error.
+/// \tparam T  Type of argument.
+/// \tparam N  Compile-time number of arguments.
+/// \tparam V  Type of interface to storage of arguments.
+/// \tparam U  Type of value.
+/// \tparam M  Compile-time number of values.
+/// \tparam W  Type of interface to storage of values.
+/// \tparam L  Compile-time number of estimates.
+/// \tparam X  Type of interface to storage of estimates.
+/// \tparam F  Type of function `f(x, r)`, like `gsl_sf_erf_e`.
+/// @param src  Arguments.
+/// @param dst  Values, as many as arguments; may be same as `src`.
+/// @param err  Absolute estimates of error, as many as arguments.
+/// @param f  Function.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Zero, or status of first element for which `f` failed.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W,
+      size_t L,
+      template<typename, size_t>
+      class X,
+      typename F>
+int sf_eval(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      v_iface<U, L, X> &err,
+      F const &f,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= src.size();
+  if(dst.size() != n || err.size() != n) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  return sf_chunks(
+        src.data(), src.v()->stride, dst.data(), dst.v()->stride, err.data(),
+        err.v()->stride, n, f, p);
+}
+
+
+} // namespace gsl
+
+// EOF
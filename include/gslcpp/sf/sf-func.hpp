@@ -0,0 +1,122 @@
+/// \file       include/gslcpp/sf/sf-func.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for special functions as function-objects.
+
+#pragma once
+
+#include <gsl/gsl_sf_bessel.h> // gsl_sf_bessel_Jn_e, etc.
+#include <gsl/gsl_sf_erf.h> // gsl_sf_erf_e, gsl_sf_erfc_e
+#include <gsl/gsl_sf_gamma.h> // gsl_sf_gamma_e, gsl_sf_lngamma_e
+#include <gsl/gsl_sf_legendre.h> // gsl_sf_legendre_Pl_e
+
+namespace gsl {
+
+
+// Each special function is a small function-object whose members are the
+// parameters of the function, and whose call-operator evaluates the
+// corresponding gsl_sf function of GSL, in its form with estimate of error.
+// gsl::sf_eval() calls it directly.  Any other callable
+// `f(double, gsl_sf_result *)`, including a plain gsl_sf function like
+// `gsl_sf_bessel_J0_e`, may be used in the same way.
+
+
+/// Regular cylindrical Bessel-function of integer order.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_bessel_Jn_e
+struct sf_bessel_Jn {
+  int n; ///< Order.
+
+  /// Evaluate function.
+  /// @param x  Argument.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_bessel_Jn_e(n, x, r);
+  }
+};
+
+
+/// Irregular cylindrical Bessel-function of integer order.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_bessel_Yn_e
+struct sf_bessel_Yn {
+  int n; ///< Order.
+
+  /// Evaluate function.
+  /// @param x  Argument, which must be positive.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_bessel_Yn_e(n, x, r);
+  }
+};
+
+
+/// Gamma-function.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_gamma_e
+struct sf_gamma {
+  /// Evaluate function.
+  /// @param x  Argument.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_gamma_e(x, r);
+  }
+};
+
+
+/// Logarithm of gamma-function.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_lngamma_e
+struct sf_lngamma {
+  /// Evaluate function.
+  /// @param x  Argument.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_lngamma_e(x, r);
+  }
+};
+
+
+/// Error-function.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_erf_e
+struct sf_erf {
+  /// Evaluate function.
+  /// @param x  Argument.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_erf_e(x, r);
+  }
+};
+
+
+/// Complementary error-function.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_erfc_e
+struct sf_erfc {
+  /// Evaluate function.
+  /// @param x  Argument.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_erfc_e(x, r);
+  }
+};
+
+
+/// Legendre-polynomial.
+/// https://www.gnu.org/software/gsl/doc/html/specfunc.html#c.gsl_sf_legendre_Pl_e
+struct sf_legendre_Pl {
+  int l; ///< Degree.
+
+  /// Evaluate function.
+  /// @param x  Argument, in `[-1, 1]`.
+  /// @param r  Value and estimate of error.
+  /// @return  GSL's status.
+  int operator()(double x, gsl_sf_result *r) const {
+    return gsl_sf_legendre_Pl_e(l, x, r);
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,9 @@
+/// \file       include/gslcpp/sort.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for sorting.
+
+#pragma once
+
+#include "sort/v-sort.hpp" // sort, sort_index, partial_sort, nth_element
+
+// EOF
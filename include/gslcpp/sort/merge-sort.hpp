@@ -0,0 +1,105 @@
+/// \file       include/gslcpp/sort/merge-sort.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::co_rank() and gsl::merge_sort().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include <algorithm> // copy, merge, min
+#include <utility> // swap
+
+namespace gsl {
+
+
+/// Number of records from `a` among first `k` records of stable merge of
+/// sorted arrays `a` and `b`.
+/// \tparam R  Type of record.
+/// \tparam L  Type of strict-weak ordering.
+/// @param k  Number of records at beginning of merged output.
+/// @param a  Pointer to first record in first array.
+/// @param m  Number of records in first array.
+/// @param b  Pointer to first record in second array.
+/// @param l  Number of records in second array.
+/// @param less  Strict-weak ordering.
+/// @return  Number of records from `a` among first `k` of output.
+template<typename R, typename L>
+size_t
+co_rank(size_t k, R const *a, size_t m, R const *b, size_t l, L const &less) {
+  size_t lo= (k > l ? k - l : 0), hi= std::min(k, m);
+  while(lo < hi) {
+    size_t const i= lo + (hi - lo) / 2, j= k - i;
+    // Take more from `a` if a[i] precede b[j-1] in stable merge.
+    if(j > 0 && !less(b[j - 1], a[i])) {
+      lo= i + 1;
+    } else {
+      hi= i;
+    }
+  }
+  return lo;
+}
+
+
+/// Stable parallel merge sort of array `a`.
+///
+/// Every chunk of `grain` records is sorted by `leaf`, and then successive
+/// rounds merge pairs of adjacent runs.  In each round, the output is split
+/// into chunks of `grain` records, and the part of the inputs needed for each
+/// chunk is found by binary search (gsl::co_rank()), so that even the final
+/// merge of two runs is distributed across every worker.
+///
+/// Because the boundaries of the chunks depend only on `n` and `grain`, the
+/// result is the same for any number of threads.
+///
+/// \tparam R  Type of record.
+/// \tparam L  Type of strict-weak ordering.
+/// \tparam S  Type of function that stably sort chunk.
+/// @param a  Pointer to first record.
+/// @param t  Pointer to scratch space for `n` records.
+/// @param n  Number of records.
+/// @param less  Strict-weak ordering.
+/// @param leaf  Function `leaf(a, t, n)` that sort `n` records at `a`, using
+///              `n` records at `t` as scratch.
+/// @param p  Pool over which to distribute chunks.
+/// @param grain  Number of records in each chunk.
+template<typename R, typename L, typename S>
+void merge_sort(
+      R *a,
+      R *t,
+      size_t n,
+      L const &less,
+      S const &leaf,
+      thread_pool &p,
+      size_t grain= size_t(1) << 16) {
+  if(n <= grain) {
+    leaf(a, t, n);
+    return;
+  }
+  p.for_chunks(n, grain, [&](size_t b, size_t e, unsigned) {
+    leaf(a + b, t + b, e - b);
+  });
+  R *src= a, *dst= t;
+  for(size_t w= grain; w < n; w*= 2) {
+    p.for_chunks(n, grain, [&](size_t b, size_t e, unsigned) {
+      size_t const lo= b / (2 * w) * (2 * w);
+      size_t const mid= std::min(lo + w, n), hi= std::min(lo + 2 * w, n);
+      R const *const x= src + lo;
+      R const *const y= src + mid;
+      size_t const m= mid - lo, l= hi - mid;
+      size_t const kb= b - lo, ke= e - lo;
+      size_t const ib= co_rank(kb, x, m, y, l, less);
+      size_t const ie= co_rank(ke, x, m, y, l, less);
+      std::merge(x + ib, x + ie, y + (kb - ib), y + (ke - ie), dst + b, less);
+    });
+    std::swap(src, dst);
+  }
+  if(src != a) {
+    p.for_chunks(n, grain, [&](size_t b, size_t e, unsigned) {
+      std::copy(src + b, src + e, a + b);
+    });
+  }
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,120 @@
+/// \dir        include/gslcpp/sort
+/// \brief      Types and functions specific to sorting.
+
+/// \file       include/gslcpp/sort/radix.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::radix_key and gsl::radix_sort().
+
+#pragma once
+
+#include <algorithm> // copy
+#include <cstdint> // uint32_t, uint64_t
+#include <cstring> // memcpy
+#include <type_traits> // enable_if_t, is_integral_v, etc.
+#include <utility> // swap
+
+namespace gsl {
+
+
+/// Via specialization, map each value of type `T` to unsigned key whose
+/// natural order is the order of the values.
+///
+/// For a floating-point type, every negative number sorts before -0, which
+/// sorts before +0, and a NaN sorts at one end or the other according to its
+/// sign-bit.  This is a total order, unlike the order under `operator<`.
+///
+/// The primary template is for a type (like `long double`) with no such key.
+///
+/// \tparam T  Type of value.
+template<typename T, typename= void> struct radix_key {
+  static constexpr bool enabled= false; ///< No key for `T`.
+};
+
+
+/// Specialization for integral type.
+/// \tparam T  Type of value.
+template<typename T>
+struct radix_key<T, std::enable_if_t<std::is_integral_v<T>>> {
+  static constexpr bool enabled= true; ///< Key is available for `T`.
+  using type= std::make_unsigned_t<T>; ///< Type of key.
+
+  /// Key for value.
+  /// @param x  Value.
+  /// @return  Key for `x`.
+  static type get(T x) {
+    type const u= type(x);
+    if constexpr(std::is_signed_v<T>) {
+      return type(u ^ (type(1) << (8 * sizeof(type) - 1)));
+    } else {
+      return u;
+    }
+  }
+};
+
+
+/// Specialization for `float` and for `double`.
+/// \tparam T  Type of value.
+template<typename T>
+struct radix_key<
+      T,
+      std::enable_if_t<std::is_same_v<T, float> || std::is_same_v<T, double>>> {
+  static constexpr bool enabled= true; ///< Key is available for `T`.
+
+  /// Type of key.
+  using type= std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>;
+
+  /// Key for value.
+  /// @param x  Value.
+  /// @return  Key for `x`.
+  static type get(T x) {
+    type u;
+    std::memcpy(&u, &x, sizeof(u));
+    type const sign= type(1) << (8 * sizeof(type) - 1);
+    return (u & sign) ? ~u : (u | sign);
+  }
+};
+
+
+/// Stable least-significant-digit radix sort of array `a`.
+///
+/// One pass is made over `a` to histogram every byte of every key, and then
+/// one scattering pass is made for each byte, except that a byte common to
+/// every key is skipped.
+///
+/// \tparam R  Type of record.
+/// \tparam K  Type of function that return unsigned key for record.
+/// @param a  Pointer to first record.
+/// @param t  Pointer to scratch space for `n` records.
+/// @param n  Number of records.
+/// @param key  Function that return unsigned key for record.
+template<typename R, typename K> void radix_sort(R *a, R *t, size_t n, K key) {
+  if(n < 2) return;
+  using U= decltype(key(*a));
+  constexpr unsigned B= sizeof(U);
+  size_t count[B][256]= {};
+  for(size_t i= 0; i < n; ++i) {
+    U const k= key(a[i]);
+    for(unsigned d= 0; d < B; ++d) ++count[d][(k >> (8 * d)) & 255];
+  }
+  R *src= a, *dst= t;
+  for(unsigned d= 0; d < B; ++d) {
+    size_t *const c= count[d];
+    if(c[(key(src[0]) >> (8 * d)) & 255] == n) continue;
+    for(size_t j= 0, s= 0; j < 256; ++j) {
+      size_t const cj= c[j];
+      c[j]= s;
+      s+= cj;
+    }
+    for(size_t i= 0; i < n; ++i) {
+      R const &r= src[i];
+      dst[c[(key(r) >> (8 * d)) & 255]++]= r;
+    }
+    std::swap(src, dst);
+  }
+  if(src != a) std::copy(src, src + n, a);
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,260 @@
+/// \file       include/gslcpp/sort/v-sort.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::sort(), gsl::sort_index(),
+///             gsl::partial_sort(), and gsl::nth_element().
+
+#pragma once
+
+#include "../vector.hpp" // vector
+#include "merge-sort.hpp" // merge_sort
+#include "radix.hpp" // radix_key, radix_sort
+#include <algorithm> // min, nth_element, sort, stable_sort
+#include <memory> // unique_ptr
+#include <stdexcept> // invalid_argument
+
+namespace gsl {
+
+
+/// Key by which values of type `T` are ordered for sorting.
+///
+/// For an integral type, for `float`, and for `double`, the key is
+/// gsl::radix_key, which totally orders every value, including NaN.  For
+/// another type, the key is the value itself.
+///
+/// \tparam T  Type of value.
+template<typename T> struct sort_key {
+  /// Type of key.
+  using type= typename std::conditional_t<
+        radix_key<T>::enabled,
+        radix_key<T>,
+        std::enable_if<true, T>>::type;
+
+  /// Key for value.
+  /// @param x  Value.
+  /// @return  Key for `x`.
+  static type get(T const &x) {
+    if constexpr(radix_key<T>::enabled) {
+      return radix_key<T>::get(x);
+    } else {
+      return x;
+    }
+  }
+
+  /// Order of values.
+  /// @param x  First value.
+  /// @param y  Second value.
+  /// @return  True only if `x` sort before `y`.
+  bool operator()(T const &x, T const &y) const { return get(x) < get(y); }
+};
+
+
+/// Key and original offset of element, sorted by gsl::sort_index().
+/// \tparam K  Type of key.
+template<typename K> struct index_record {
+  K k; ///< Key.
+  size_t i; ///< Original offset.
+
+  /// Order of records by key alone.
+  /// @param x  First record.
+  /// @param y  Second record.
+  /// @return  True only if `x` sort before `y`.
+  static bool less(index_record const &x, index_record const &y) {
+    return x.k < y.k;
+  }
+};
+
+
+/// Call `f(d)`, where `d` points to contiguous copy of elements in `v`, or to
+/// elements of `v` directly if `v` be contiguous.  Any change to the copy is
+/// written back to `v` before return.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam F  Type of function.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute gathering and scattering.
+/// @param f  Function.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename F>
+void with_contiguous(v_iface<T, N, V> &v, thread_pool &p, F &&f) {
+  size_t const n= v.size(), s= v.v()->stride;
+  T *const d= v.data();
+  if(s == 1) {
+    f(d);
+    return;
+  }
+  std::unique_ptr<T[]> const c(new T[n]);
+  T *const b= c.get();
+  p.for_chunks(n, [&](size_t i, size_t e, unsigned) {
+    for(; i < e; ++i) b[i]= d[i * s];
+  });
+  f(b);
+  p.for_chunks(n, [&](size_t i, size_t e, unsigned) {
+    for(; i < e; ++i) d[i * s]= b[i];
+  });
+}
+
+
+/// Sort contiguous array into ascending order.
+///
+/// Each chunk of a large array is sorted by radix sort (for an integral type,
+/// for `float`, and for `double`) or by `std::sort` (for another type), and
+/// then the chunks are merged in parallel by gsl::merge_sort().
+///
+/// \tparam T  Type of element.
+/// @param d  Pointer to first element.
+/// @param n  Number of elements.
+/// @param p  Pool over which to distribute work.
+template<typename T> void sort_array(T *d, size_t n, thread_pool &p) {
+  if(n < 2) return;
+  auto const leaf= [](T *a, T *t, size_t m) {
+    if constexpr(radix_key<T>::enabled) {
+      if(m >= 256) return radix_sort(a, t, m, &radix_key<T>::get);
+    }
+    std::sort(a, a + m, sort_key<T>());
+  };
+  std::unique_ptr<T[]> const t(new T[n]);
+  merge_sort(d, t.get(), n, sort_key<T>(), leaf, p);
+}
+
+
+/// Sort elements of vector into ascending order.
+///
+/// The work is done by gsl::sort_array().  A strided vector is gathered into
+/// contiguous storage and scattered back afterward.
+///
+/// For `float` and `double`, -0 sorts before +0, and each NaN sorts at the
+/// end corresponding to its sign-bit.
+///
+/// Unlike gsl_sort_vector(), which is an in-place heap sort, this function
+/// allocates scratch space for as many elements as there are in `v`.
+///
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector to sort.
+/// @param p  Pool over which to distribute work.
+template<typename T, size_t N, template<typename, size_t> class V>
+void sort(v_iface<T, N, V> &v, thread_pool &p= thread_pool::global()) {
+  if(v.size() < 2) return;
+  with_contiguous(v, p, [&](T *d) { sort_array(d, v.size(), p); });
+}
+
+
+/// Compute permutation that sort vector into ascending order.
+///
+/// On return, `v[perm[0]]`, `v[perm[1]]`, ... are in ascending order.  The
+/// sort is stable, so that equal elements keep their original order.
+///
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements in `v`.
+/// \tparam V  Type of interface to storage for `v`.
+/// \tparam NP  Compile-time number of elements in `perm`.
+/// \tparam VP  Type of interface to storage for `perm`.
+/// @param perm  On return, permutation.
+/// @param v  Vector whose permutation is computed.
+/// @param p  Pool over which to distribute work.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      size_t NP,
+      template<typename, size_t>
+      class VP>
+void sort_index(
+      v_iface<size_t, NP, VP> &perm,
+      v_iface<T, N, V> const &v,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size();
+  if(perm.size() != n) throw std::invalid_argument("mismatch in size");
+  using E= std::remove_const_t<T>;
+  using R= index_record<typename sort_key<E>::type>;
+  std::unique_ptr<R[]> const a(new R[n]), t(new R[n]);
+  R *const ra= a.get();
+  p.for_chunks(n, [&](size_t b, size_t e, unsigned) {
+    for(size_t i= b; i < e; ++i) ra[i]= {sort_key<E>::get(v[i]), i};
+  });
+  auto const leaf= [](R *x, R *y, size_t m) {
+    if constexpr(radix_key<E>::enabled) {
+      if(m >= 256) return radix_sort(x, y, m, [](R const &r) { return r.k; });
+    }
+    std::stable_sort(x, x + m, &R::less);
+  };
+  merge_sort(ra, t.get(), n, &R::less, leaf, p);
+  p.for_chunks(n, [&](size_t b, size_t e, unsigned) {
+    for(size_t i= b; i < e; ++i) perm[i]= ra[i].i;
+  });
+}
+
+
+/// Compute permutation that sort vector into ascending order.
+/// See gsl::sort_index(v_iface<size_t, NP, VP>&, v_iface<T, N, V> const&,
+/// thread_pool&).
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements in `v`.
+/// \tparam V  Type of interface to storage for `v`.
+/// @param v  Vector whose permutation is computed.
+/// @param p  Pool over which to distribute work.
+/// @return  Permutation.
+template<typename T, size_t N, template<typename, size_t> class V>
+vector<size_t>
+sort_index(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  vector<size_t> perm(v.size());
+  sort_index(perm, v, p);
+  return perm;
+}
+
+
+/// Rearrange vector so that its first `k` elements are its smallest, in
+/// ascending order.  The order of the remaining elements is unspecified.
+///
+/// The smallest elements are found by `std::nth_element` and are then sorted
+/// by gsl::sort_array().
+///
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector to rearrange.
+/// @param k  Number of smallest elements to sort.
+/// @param p  Pool over which to distribute work.
+template<typename T, size_t N, template<typename, size_t> class V>
+void partial_sort(
+      v_iface<T, N, V> &v, size_t k, thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size();
+  if(k >= n) return sort(v, p);
+  if(k == 0) return;
+  with_contiguous(v, p, [&](T *d) {
+    std::nth_element(d, d + k, d + n, sort_key<T>());
+    sort_array(d, k, p);
+  });
+}
+
+
+/// Rearrange vector so that element `k` is what it would be if the vector
+/// were sorted, no element before it is greater, and no element after it is
+/// less.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector to rearrange.
+/// @param k  Offset of element to place.
+/// @param p  Pool over which to distribute gathering and scattering.
+template<typename T, size_t N, template<typename, size_t> class V>
+void nth_element(
+      v_iface<T, N, V> &v, size_t k, thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size();
+  if(k >= n) throw std::invalid_argument("offset out of range");
+  with_contiguous(v, p, [&](T *d) {
+    std::nth_element(d, d + k, d + n, sort_key<T>());
+  });
+}
+
+
+} // namespace gsl
+
+// EOF
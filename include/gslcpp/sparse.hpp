@@ -0,0 +1,11 @@
+/// \file       include/gslcpp/sparse.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for sparse vectors and matrices.
+
+#pragma once
+
+#include "sparse/indexed.hpp" // gather, scatter, scatter_add
+#include "sparse/sparse-vector.hpp" // sparse_vector, dot, axpy, etc.
+#include "sparse/spmatrix.hpp" // spmatrix, spmv
+
+// EOF
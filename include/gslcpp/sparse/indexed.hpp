@@ -0,0 +1,360 @@
+/// \file       include/gslcpp/sparse/indexed.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gather and scatter through vector of indices.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include <climits> // INT_MAX
+#include <stdexcept> // invalid_argument, out_of_range
+#include <type_traits> // is_integral, is_same
+#include <vector> // vector
+
+#if defined(__AVX512F__) || defined(__AVX2__)
+#include <immintrin.h> // _mm256_i32gather_pd, etc.
+#endif
+
+namespace gsl {
+
+
+/// Number of indices in each chunk of parallel gather and scatter-add.
+constexpr size_t gather_grain= size_t(1) << 15;
+
+
+/// Number of indices by which a prefetch runs ahead of a gather or scatter.
+constexpr size_t gather_ahead= 16;
+
+
+/// Verify that every index be less than size of indexed vector.  A negative
+/// index converts to a large offset and so fails, too.
+/// \tparam I  Type of index.
+/// @param k  Pointer to first index.
+/// @param s  Stride of indices.
+/// @param n  Number of indices.
+/// @param m  Size of indexed vector.
+template<typename I>
+void check_indices(I const *k, size_t s, size_t n, size_t m) {
+  static_assert(std::is_integral<I>::value, "index must be integral");
+  bool bad= false;
+  for(size_t i= 0; i < n; ++i) bad|= (size_t(k[i * s]) >= m);
+  if(bad) throw std::out_of_range("index beyond size");
+}
+
+
+/// Hint that element be soon read or written.  Without GCC or Clang, this
+/// does nothing.
+/// @param a  Address of element.
+inline void prefetch(void const *a) {
+#if defined(__GNUC__)
+  __builtin_prefetch(a);
+#else
+  (void)a;
+#endif
+}
+
+
+/// Gather contiguous doubles by hardware-gather, if the compiler target
+/// AVX-512 or AVX2 (for example, by `-march=native`).  Every index must
+/// already be valid.
+/// \tparam I  Type of index, with four or eight bytes.
+/// @param x  Pointer to first source element.
+/// @param m  Number of source elements.
+/// @param k  Pointer to first index.
+/// @param y  Pointer to first destination element.
+/// @param b  Offset of first index to gather.
+/// @param e  Offset past last index to gather.
+/// @return  Offset of first index not yet gathered.
+template<typename I>
+size_t gather_simd(
+      double const *x, size_t m, I const *k, double *y, size_t b, size_t e) {
+  size_t i= b;
+#if defined(__AVX512F__)
+  if constexpr(sizeof(I) == 4) {
+    if(m > size_t(INT_MAX)) return i;
+    for(; i + 8 <= e; i+= 8) {
+      if(i + 8 + gather_ahead <= e) {
+        for(size_t j= 0; j < 8; ++j) prefetch(x + k[i + gather_ahead + j]);
+      }
+      __m256i const v= _mm256_loadu_si256((__m256i const *)(k + i));
+      _mm512_storeu_pd(y + i, _mm512_i32gather_pd(v, x, 8));
+    }
+  } else if constexpr(sizeof(I) == 8) {
+    for(; i + 8 <= e; i+= 8) {
+      if(i + 8 + gather_ahead <= e) {
+        for(size_t j= 0; j < 8; ++j) prefetch(x + k[i + gather_ahead + j]);
+      }
+      __m512i const v= _mm512_loadu_si512((void const *)(k + i));
+      _mm512_storeu_pd(y + i, _mm512_i64gather_pd(v, x, 8));
+    }
+  }
+#elif defined(__AVX2__)
+  if constexpr(sizeof(I) == 4) {
+    if(m > size_t(INT_MAX)) return i;
+    for(; i + 4 <= e; i+= 4) {
+      if(i + 4 + gather_ahead <= e) {
+        for(size_t j= 0; j < 4; ++j) prefetch(x + k[i + gather_ahead + j]);
+      }
+      __m128i const v= _mm_loadu_si128((__m128i const *)(k + i));
+      _mm256_storeu_pd(y + i, _mm256_i32gather_pd(x, v, 8));
+    }
+  } else if constexpr(sizeof(I) == 8) {
+    for(; i + 4 <= e; i+= 4) {
+      if(i + 4 + gather_ahead <= e) {
+        for(size_t j= 0; j < 4; ++j) prefetch(x + k[i + gather_ahead + j]);
+      }
+      __m256i const v= _mm256_loadu_si256((__m256i const *)(k + i));
+      _mm256_storeu_pd(y + i, _mm256_i64gather_pd(x, v, 8));
+    }
+  }
+#else
+  (void)x, (void)m, (void)k, (void)y, (void)e;
+#endif
+  return i;
+}
+
+
+/// Gather elements `[b, e)` of destination: `y[i]= x[k[i]]`.  Every index
+/// must already be valid.
+/// \tparam T  Type of source element.
+/// \tparam I  Type of index.
+/// \tparam U  Type of destination element.
+/// @param x  Pointer to first source element.
+/// @param sx  Stride of source.
+/// @param m  Number of source elements.
+/// @param k  Pointer to first index.
+/// @param sk  Stride of indices.
+/// @param y  Pointer to first destination element.
+/// @param sy  Stride of destination.
+/// @param b  Offset of first index to gather.
+/// @param e  Offset past last index to gather.
+template<typename T, typename I, typename U>
+void gather_range(
+      T const *x,
+      size_t sx,
+      size_t m,
+      I const *k,
+      size_t sk,
+      U *y,
+      size_t sy,
+      size_t b,
+      size_t e) {
+  size_t i= b;
+  if constexpr(
+        std::is_same<T, double>::value && std::is_same<U, double>::value) {
+    if(sx == 1 && sk == 1 && sy == 1) i= gather_simd(x, m, k, y, b, e);
+  }
+  for(; i + gather_ahead < e; ++i) {
+    prefetch(x + size_t(k[(i + gather_ahead) * sk]) * sx);
+    y[i * sy]= U(x[size_t(k[i * sk]) * sx]);
+  }
+  for(; i < e; ++i) y[i * sy]= U(x[size_t(k[i * sk]) * sx]);
+}
+
+
+/// Gather elements of source at indices: `dst[i]= src[idx[i]]`.
+///
+/// Every index is checked before any element is read.  Chunks of
+/// gsl::gather_grain indices are distributed over `p`.  Each element of the
+/// destination is written by one thread, and so the result does not depend
+/// on the number of threads.
+///
+/// For contiguous vectors of `double` and contiguous indices of four or
+/// eight bytes, the compiler's targeting AVX-512 or AVX2 enables hardware
+/// gather.  Otherwise, or in addition, the source element needed
+/// gsl::gather_ahead indices later is prefetched.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam I  Type of index, which is integral.
+/// \tparam NI  Compile-time number of indices.
+/// \tparam VI  Type of interface to storage of indices.
+/// \tparam U  Type of destination element.
+/// \tparam NU  Compile-time number of destination elements.
+/// \tparam VU  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param idx  Vector of offsets into `src`.
+/// @param dst  Destination vector, with as many elements as `idx`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename I,
+      size_t NI,
+      template<typename, size_t>
+      class VI,
+      typename U,
+      size_t NU,
+      template<typename, size_t>
+      class VU>
+void gather(
+      v_iface<T, N, V> const &src,
+      v_iface<I, NI, VI> const &idx,
+      v_iface<U, NU, VU> &dst,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= idx.size(), m= src.size();
+  if(dst.size() != n) throw std::invalid_argument("mismatch in size");
+  size_t const sx= src.v()->stride, sk= idx.v()->stride;
+  size_t const sy= dst.v()->stride;
+  T const *const x= src.data();
+  I const *const k= idx.data();
+  U *const y= dst.data();
+  check_indices(k, sk, n, m);
+  if(n <= gather_grain || p.size() == 1) {
+    gather_range(x, sx, m, k, sk, y, sy, 0, n);
+    return;
+  }
+  p.for_chunks(n, gather_grain, [&](size_t b, size_t e, unsigned) {
+    gather_range(x, sx, m, k, sk, y, sy, b, e);
+  });
+}
+
+
+/// Scatter elements of source to indices: `dst[idx[i]]= src[i]`.
+///
+/// Every index is checked before any element is written.  The scatter is
+/// serial and in order of `i`, so that, where an index is repeated, the last
+/// write wins.  The destination element needed gsl::gather_ahead indices
+/// later is prefetched.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam I  Type of index, which is integral.
+/// \tparam NI  Compile-time number of indices.
+/// \tparam VI  Type of interface to storage of indices.
+/// \tparam U  Type of destination element.
+/// \tparam NU  Compile-time number of destination elements.
+/// \tparam VU  Type of interface to storage of destination.
+/// @param src  Source vector, with as many elements as `idx`.
+/// @param idx  Vector of offsets into `dst`.
+/// @param dst  Destination vector.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename I,
+      size_t NI,
+      template<typename, size_t>
+      class VI,
+      typename U,
+      size_t NU,
+      template<typename, size_t>
+      class VU>
+void scatter(
+      v_iface<T, N, V> const &src,
+      v_iface<I, NI, VI> const &idx,
+      v_iface<U, NU, VU> &dst) {
+  size_t const n= idx.size();
+  if(src.size() != n) throw std::invalid_argument("mismatch in size");
+  size_t const sx= src.v()->stride, sk= idx.v()->stride;
+  size_t const sy= dst.v()->stride;
+  T const *const x= src.data();
+  I const *const k= idx.data();
+  U *const y= dst.data();
+  check_indices(k, sk, n, dst.size());
+  size_t i= 0;
+  for(; i + gather_ahead < n; ++i) {
+    prefetch(y + size_t(k[(i + gather_ahead) * sk]) * sy);
+    y[size_t(k[i * sk]) * sy]= U(x[i * sx]);
+  }
+  for(; i < n; ++i) y[size_t(k[i * sk]) * sy]= U(x[i * sx]);
+}
+
+
+/// Add elements of source at indices: `dst[idx[i]]+= src[i]`.
+///
+/// Every index is checked before any element is written.  If there be more
+/// than gsl::gather_grain indices, then the destination is split into one
+/// contiguous block for each worker of `p`, and the pairs of index and value
+/// are partitioned by block, in two parallel passes over chunks of
+/// gsl::gather_grain indices, the first counting and the second copying.
+/// Each worker then adds the pairs of its own block.  No two threads write
+/// the same element, and so no atomic operation is needed, even where an
+/// index is repeated; and, because the partition is stable, each element
+/// receives its additions in order of `i`, so that the result is identical
+/// to that of the serial loop, for any number of threads.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam I  Type of index, which is integral.
+/// \tparam NI  Compile-time number of indices.
+/// \tparam VI  Type of interface to storage of indices.
+/// \tparam U  Type of destination element.
+/// \tparam NU  Compile-time number of destination elements.
+/// \tparam VU  Type of interface to storage of destination.
+/// @param src  Source vector, with as many elements as `idx`.
+/// @param idx  Vector of offsets into `dst`.
+/// @param dst  Destination vector.
+/// @param p  Pool over which to distribute chunks and blocks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename I,
+      size_t NI,
+      template<typename, size_t>
+      class VI,
+      typename U,
+      size_t NU,
+      template<typename, size_t>
+      class VU>
+void scatter_add(
+      v_iface<T, N, V> const &src,
+      v_iface<I, NI, VI> const &idx,
+      v_iface<U, NU, VU> &dst,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= idx.size(), m= dst.size();
+  if(src.size() != n) throw std::invalid_argument("mismatch in size");
+  size_t const sx= src.v()->stride, sk= idx.v()->stride;
+  size_t const sy= dst.v()->stride;
+  T const *const x= src.data();
+  I const *const k= idx.data();
+  U *const y= dst.data();
+  check_indices(k, sk, n, m);
+  if(n <= gather_grain || p.size() == 1) {
+    size_t i= 0;
+    for(; i + gather_ahead < n; ++i) {
+      prefetch(y + size_t(k[(i + gather_ahead) * sk]) * sy);
+      y[size_t(k[i * sk]) * sy]+= U(x[i * sx]);
+    }
+    for(; i < n; ++i) y[size_t(k[i * sk]) * sy]+= U(x[i * sx]);
+    return;
+  }
+  size_t const nb= p.size(), bs= (m + nb - 1) / nb;
+  size_t const nc= (n + gather_grain - 1) / gather_grain;
+  // Offset of pairs for block b from chunk c is at off[b * nc + c].
+  std::vector<size_t> off(nb * nc + 1, 0);
+  p.for_chunks(n, gather_grain, [&](size_t b, size_t e, unsigned) {
+    size_t const c= b / gather_grain;
+    for(size_t i= b; i < e; ++i) ++off[size_t(k[i * sk]) / bs * nc + c + 1];
+  });
+  for(size_t j= 1; j <= nb * nc; ++j) off[j]+= off[j - 1];
+  std::vector<size_t> first(nb + 1);
+  for(size_t b= 0; b <= nb; ++b) first[b]= off[b * nc];
+  std::vector<size_t> pk(n);
+  std::vector<U> pv(n);
+  p.for_chunks(n, gather_grain, [&](size_t b, size_t e, unsigned) {
+    size_t const c= b / gather_grain;
+    for(size_t i= b; i < e; ++i) {
+      size_t const j= size_t(k[i * sk]);
+      size_t const o= off[j / bs * nc + c]++;
+      pk[o]= j;
+      pv[o]= U(x[i * sx]);
+    }
+  });
+  p.for_each(nb, [&](size_t b, unsigned) {
+    for(size_t o= first[b]; o < first[b + 1]; ++o) y[pk[o] * sy]+= pv[o];
+  });
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,235 @@
+/// \dir        include/gslcpp/sparse
+/// \brief      Types and functions specific to sparse vectors and matrices.
+
+/// \file       include/gslcpp/sparse/sparse-vector.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::sparse_vector and related functions.
+
+#pragma once
+
+#include "../vec/v-iface.hpp" // v_iface
+#include <algorithm> // lower_bound
+#include <stdexcept> // invalid_argument, out_of_range
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Sparse vector, storing only offsets and values of nonzero elements.
+///
+/// Offsets are strictly increasing, so that lookup of an element is a binary
+/// search, and so that a sweep over the stored elements visits a dense
+/// vector in order.  Storage is proportional to the number of stored
+/// elements, and isnull() looks only at them.
+///
+/// The free functions gsl::dot(), gsl::axpy(), gsl::scatter(), and
+/// gsl::gather() combine a sparse vector with any gsl::v_iface.
+///
+/// \tparam T  Type of element.
+template<typename T= double> class sparse_vector {
+  size_t n_; ///< Number of elements, including zeros.
+  std::vector<size_t> idx_; ///< Offset of each stored element.
+  std::vector<T> val_; ///< Value of each stored element.
+
+public:
+  /// Initialize vector of zeros.
+  /// @param n  Number of elements.
+  explicit sparse_vector(size_t n= 0): n_(n) {}
+
+  /// Initialize from nonzero elements of dense vector.
+  /// \tparam U  Type of element in dense vector.
+  /// \tparam N  Compile-time number of elements.
+  /// \tparam V  Type of interface to storage.
+  /// @param v  Dense vector.
+  template<typename U, size_t N, template<typename, size_t> class V>
+  explicit sparse_vector(v_iface<U, N, V> const &v): n_(v.size()) {
+    size_t const s= v.v()->stride;
+    auto const *const d= v.data();
+    for(size_t i= 0; i < n_; ++i) {
+      if(d[i * s] != U(0)) {
+        idx_.push_back(i);
+        val_.push_back(T(d[i * s]));
+      }
+    }
+  }
+
+  /// Number of elements, including zeros.
+  /// @return  Number of elements.
+  size_t size() const { return n_; }
+
+  /// Number of stored elements.
+  /// @return  Number of stored elements.
+  size_t nnz() const { return idx_.size(); }
+
+  /// Offsets of stored elements.
+  /// @return  Reference to offsets.
+  std::vector<size_t> const &indices() const { return idx_; }
+
+  /// Values of stored elements.
+  /// @return  Reference to values.
+  std::vector<T> const &values() const { return val_; }
+
+  /// Pointer to mutable values of stored elements.  The pattern of stored
+  /// offsets cannot be changed through the pointer.
+  /// @return  Pointer to first value.
+  T *data() { return val_.data(); }
+
+  /// Value of element.
+  /// @param i  Offset of element.
+  /// @return  Value, or zero if element be not stored.
+  T get(size_t i) const {
+    auto const it= std::lower_bound(idx_.begin(), idx_.end(), i);
+    if(it == idx_.end() || *it != i) return T(0);
+    return val_[size_t(it - idx_.begin())];
+  }
+
+  /// Value of element.
+  /// @param i  Offset of element.
+  /// @return  Value, or zero if element be not stored.
+  T operator[](size_t i) const { return get(i); }
+
+  /// Store value of element.  Appending at an offset beyond every stored
+  /// offset costs constant time; otherwise, insertion is linear in nnz().
+  /// @param i  Offset of element.
+  /// @param x  Value.
+  void set(size_t i, T const &x) {
+    if(i >= n_) throw std::out_of_range("offset beyond size");
+    auto const it= std::lower_bound(idx_.begin(), idx_.end(), i);
+    size_t const k= size_t(it - idx_.begin());
+    if(it != idx_.end() && *it == i) {
+      val_[k]= x;
+      return;
+    }
+    idx_.insert(it, i);
+    val_.insert(val_.begin() + k, x);
+  }
+
+  /// Remove every stored element.
+  void set_zero() {
+    idx_.clear();
+    val_.clear();
+  }
+
+  /// True only if every element be zero.
+  /// @return  True only if every stored value be zero.
+  bool isnull() const {
+    for(T const &x: val_) {
+      if(x != T(0)) return false;
+    }
+    return true;
+  }
+
+  /// Scale every element.
+  /// @param x  Factor.
+  void scale(T const &x) {
+    for(T &v: val_) v*= x;
+  }
+};
+
+
+/// Dot-product of sparse and dense vector.
+/// \tparam T  Type of element in sparse vector.
+/// \tparam U  Type of element in dense vector.
+/// \tparam N  Compile-time number of elements in dense vector.
+/// \tparam V  Type of interface to storage of dense vector.
+/// @param x  Sparse vector.
+/// @param y  Dense vector.
+/// @return  Dot-product.
+template<typename T, typename U, size_t N, template<typename, size_t> class V>
+T dot(sparse_vector<T> const &x, v_iface<U, N, V> const &y) {
+  if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+  size_t const s= y.v()->stride, m= x.nnz();
+  auto const *const d= y.data();
+  size_t const *const i= x.indices().data();
+  T const *const v= x.values().data();
+  T t= T(0);
+  for(size_t k= 0; k < m; ++k) t+= v[k] * T(d[i[k] * s]);
+  return t;
+}
+
+
+/// Dot-product of two sparse vectors, by merging their offsets.
+/// \tparam T  Type of element.
+/// @param x  First vector.
+/// @param y  Second vector.
+/// @return  Dot-product.
+template<typename T>
+T dot(sparse_vector<T> const &x, sparse_vector<T> const &y) {
+  if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+  auto const &ix= x.indices(), &iy= y.indices();
+  auto const &vx= x.values(), &vy= y.values();
+  T t= T(0);
+  size_t a= 0, b= 0;
+  while(a < ix.size() && b < iy.size()) {
+    if(ix[a] < iy[b]) {
+      ++a;
+    } else if(iy[b] < ix[a]) {
+      ++b;
+    } else {
+      t+= vx[a++] * vy[b++];
+    }
+  }
+  return t;
+}
+
+
+/// Add multiple of sparse vector to dense vector: `y+= alpha * x`.
+/// \tparam T  Type of element in sparse vector.
+/// \tparam U  Type of element in dense vector.
+/// \tparam N  Compile-time number of elements in dense vector.
+/// \tparam V  Type of interface to storage of dense vector.
+/// @param alpha  Coefficient of `x`.
+/// @param x  Sparse vector.
+/// @param y  Dense vector.
+template<typename T, typename U, size_t N, template<typename, size_t> class V>
+void axpy(T const &alpha, sparse_vector<T> const &x, v_iface<U, N, V> &y) {
+  if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+  size_t const s= y.v()->stride, m= x.nnz();
+  U *const d= y.data();
+  size_t const *const i= x.indices().data();
+  T const *const v= x.values().data();
+  for(size_t k= 0; k < m; ++k) d[i[k] * s]+= U(alpha * v[k]);
+}
+
+
+/// Write stored elements of sparse vector into dense vector.  Other elements
+/// of the dense vector are not modified.
+/// \tparam T  Type of element in sparse vector.
+/// \tparam U  Type of element in dense vector.
+/// \tparam N  Compile-time number of elements in dense vector.
+/// \tparam V  Type of interface to storage of dense vector.
+/// @param x  Sparse vector.
+/// @param y  Dense vector.
+template<typename T, typename U, size_t N, template<typename, size_t> class V>
+void scatter(sparse_vector<T> const &x, v_iface<U, N, V> &y) {
+  if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+  size_t const s= y.v()->stride, m= x.nnz();
+  U *const d= y.data();
+  size_t const *const i= x.indices().data();
+  T const *const v= x.values().data();
+  for(size_t k= 0; k < m; ++k) d[i[k] * s]= U(v[k]);
+}
+
+
+/// Read elements of dense vector at stored offsets of sparse vector.  The
+/// pattern of the sparse vector is not changed.
+/// \tparam T  Type of element in sparse vector.
+/// \tparam U  Type of element in dense vector.
+/// \tparam N  Compile-time number of elements in dense vector.
+/// \tparam V  Type of interface to storage of dense vector.
+/// @param y  Dense vector.
+/// @param x  Sparse vector.
+template<typename T, typename U, size_t N, template<typename, size_t> class V>
+void gather(v_iface<U, N, V> const &y, sparse_vector<T> &x) {
+  if(x.size() != y.size()) throw std::invalid_argument("mismatch in size");
+  size_t const s= y.v()->stride, m= x.nnz();
+  auto const *const d= y.data();
+  size_t const *const i= x.indices().data();
+  T *const v= x.data();
+  for(size_t k= 0; k < m; ++k) v[k]= T(d[i[k] * s]);
+}
+
+
+} // namespace gsl
+
+// EOF
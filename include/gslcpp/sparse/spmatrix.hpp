@@ -0,0 +1,233 @@
+/// \file       include/gslcpp/sparse/spmatrix.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::spmatrix and gsl::spmv().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include <algorithm> // lower_bound
+#include <gsl/gsl_spmatrix.h> // gsl_spmatrix, etc.
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of stored elements below which gsl::spmv() runs serially.
+constexpr size_t spmv_grain= size_t(1) << 15;
+
+
+/// Number of fixed ranges of columns, each accumulating into its own copy of
+/// result, for gsl::spmv() of compressed-column storage.
+constexpr size_t spmv_copies= 8;
+
+
+/// Sparse matrix, owning GSL's sparse matrix.
+/// https://www.gnu.org/software/gsl/doc/html/spmatrix.html
+///
+/// A matrix is built in coordinate (COO) storage by set(), and then
+/// compressed, by csr() or csc(), into a new matrix in compressed-row or
+/// compressed-column storage for fast multiplication by gsl::spmv().
+class spmatrix {
+  gsl_spmatrix *m_; ///< GSL's sparse matrix.
+
+  spmatrix(spmatrix const &)= delete; ///< Disable copying.
+  spmatrix &operator=(spmatrix const &)= delete; ///< Disable copying.
+
+  /// Take ownership of GSL's sparse matrix.
+  /// @param m  Pointer to GSL's sparse matrix.
+  explicit spmatrix(gsl_spmatrix *m): m_(m) {}
+
+public:
+  /// Allocate empty matrix in coordinate storage.
+  /// https://www.gnu.org/software/gsl/doc/html/spmatrix.html#c.gsl_spmatrix_alloc
+  /// @param n1  Number of rows.
+  /// @param n2  Number of columns.
+  spmatrix(size_t n1, size_t n2): m_(gsl_spmatrix_alloc(n1, n2)) {}
+
+  /// Move on construction.
+  /// @param src  Matrix to move.
+  spmatrix(spmatrix &&src): m_(src.m_) { src.m_= nullptr; }
+
+  /// Deallocate matrix.
+  ~spmatrix() {
+    if(m_) gsl_spmatrix_free(m_);
+  }
+
+  /// Pointer to GSL's sparse matrix.
+  /// @return  Pointer to GSL's sparse matrix.
+  gsl_spmatrix *m() const { return m_; }
+
+  /// Number of rows.
+  /// @return  Number of rows.
+  size_t size1() const { return m_->size1; }
+
+  /// Number of columns.
+  /// @return  Number of columns.
+  size_t size2() const { return m_->size2; }
+
+  /// Number of stored elements.
+  /// https://www.gnu.org/software/gsl/doc/html/spmatrix.html#c.gsl_spmatrix_nnz
+  /// @return  Number of stored elements.
+  size_t nnz() const { return gsl_spmatrix_nnz(m_); }
+
+  /// Type of storage.
+  /// @return  `GSL_SPMATRIX_COO`, `GSL_SPMATRIX_CSR`, or `GSL_SPMATRIX_CSC`.
+  int sptype() const { return m_->sptype; }
+
+  /// Name of type of storage.
+  /// https://www.gnu.org/software/gsl/doc/html/spmatrix.html#c.gsl_spmatrix_type
+  /// @return  Name of type of storage.
+  char const *type() const { return gsl_spmatrix_type(m_); }
+
+  /// Element of matrix.
+  /// https://www.gnu.org/software/gsl/doc/html/spmatrix.html#c.gsl_spmatrix_get
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  /// @return  Value, or zero if element be not stored.
+  double get(size_t i, size_t j) const { return gsl_spmatrix_get(m_, i, j); }
+
+  /// Store element of matrix in coordinate storage.
+  /// https://www.gnu.org/software/gsl/doc/html/spmatrix.html#c.gsl_spmatrix_set
+  /// @param i  Offset of row.
+  /// @param j  Offset of column.
+  /// @param x  Value.
+  /// @return  GSL's status.
+  int set(size_t i, size_t j, double x) {
+    return gsl_spmatrix_set(m_, i, j, x);
+  }
+
+  /// Copy in compressed storage.
+  /// https://www.gnu.org/software/gsl/doc/html/spmatrix.html#c.gsl_spmatrix_compress
+  /// @param t  `GSL_SPMATRIX_CSR` or `GSL_SPMATRIX_CSC`.
+  /// @return  New matrix.
+  spmatrix compress(int t) const {
+    return spmatrix(gsl_spmatrix_compress(m_, t));
+  }
+
+  /// Copy in compressed-row storage.
+  /// @return  New matrix.
+  spmatrix csr() const { return compress(GSL_SPMATRIX_CSR); }
+
+  /// Copy in compressed-column storage.
+  /// @return  New matrix.
+  spmatrix csc() const { return compress(GSL_SPMATRIX_CSC); }
+};
+
+
+/// Product of sparse matrix and dense vector: `y= a * x`.
+///
+/// - For compressed-row storage, rows are distributed over `p`.  Each element
+///   of `y` is computed by one thread, in order of stored elements, and so the
+///   result does not depend on the number of threads.
+///
+/// - For compressed-column storage, columns are split into gsl::spmv_copies
+///   ranges with about equal numbers of stored elements, and each range
+///   accumulates into its own copy of `y`.  The ranges do not depend on `p`,
+///   and the copies are added in order of range, and so the result does not
+///   depend on the number of threads.  At most gsl::spmv_copies ranges run
+///   concurrently.
+///
+/// - Coordinate storage is multiplied serially.
+///
+/// Below gsl::spmv_grain stored elements, every storage is multiplied
+/// serially, and compressed columns are accumulated directly into `y`.
+///
+/// \tparam T  Type of element in `x`.
+/// \tparam N  Compile-time number of elements in `x`.
+/// \tparam V  Type of interface to storage of `x`.
+/// \tparam M  Compile-time number of elements in `y`.
+/// \tparam W  Type of interface to storage of `y`.
+/// @param a  Sparse matrix.
+/// @param x  Dense vector with `a.size2()` elements.
+/// @param y  Dense vector with `a.size1()` elements.
+/// @param p  Pool over which to distribute rows or columns.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void spmv(
+      spmatrix const &a,
+      v_iface<T, N, V> const &x,
+      v_iface<double, M, W> &y,
+      thread_pool &p= thread_pool::global()) {
+  gsl_spmatrix const *const m= a.m();
+  if(x.size() != m->size2 || y.size() != m->size1) {
+    throw std::invalid_argument("mismatch in size");
+  }
+  size_t const sx= x.v()->stride, sy= y.v()->stride, n1= m->size1;
+  auto const *const xd= x.data();
+  double *const yd= y.data();
+  int const *const mi= m->i;
+  int const *const mp= m->p;
+  double const *const md= m->data;
+  bool const serial= (m->nz < spmv_grain || p.size() == 1);
+  if(m->sptype == GSL_SPMATRIX_CSR) {
+    auto const rows= [&](size_t b, size_t e, unsigned) {
+      for(size_t r= b; r < e; ++r) {
+        double t= 0.0;
+        for(int k= mp[r]; k < mp[r + 1]; ++k) {
+          t+= md[k] * double(xd[size_t(mi[k]) * sx]);
+        }
+        yd[r * sy]= t;
+      }
+    };
+    if(serial) {
+      rows(0, n1, 0);
+    } else {
+      p.for_chunks(n1, rows);
+    }
+    return;
+  }
+  for(size_t r= 0; r < n1; ++r) yd[r * sy]= 0.0;
+  if(m->sptype == GSL_SPMATRIX_CSC) {
+    auto const cols= [&](size_t b, size_t e, double *z, size_t sz) {
+      for(size_t c= b; c < e; ++c) {
+        double const xc= double(xd[c * sx]);
+        for(int k= mp[c]; k < mp[c + 1]; ++k) {
+          z[size_t(mi[k]) * sz]+= md[k] * xc;
+        }
+      }
+    };
+    size_t const n2= m->size2;
+    if(m->nz < spmv_grain) {
+      cols(0, n2, yd, sy);
+      return;
+    }
+    // Boundaries of ranges depend only on matrix.  First range accumulates
+    // directly into y.
+    size_t bnd[spmv_copies + 1];
+    bnd[0]= 0;
+    bnd[spmv_copies]= n2;
+    for(size_t c= 1; c < spmv_copies; ++c) {
+      int const t= int(m->nz * c / spmv_copies);
+      bnd[c]= size_t(std::lower_bound(mp, mp + n2, t) - mp);
+    }
+    std::vector<double> priv((spmv_copies - 1) * n1, 0.0);
+    p.for_each(spmv_copies, [&](size_t c, unsigned) {
+      if(c == 0) {
+        cols(bnd[0], bnd[1], yd, sy);
+      } else {
+        cols(bnd[c], bnd[c + 1], priv.data() + (c - 1) * n1, 1);
+      }
+    });
+    for(size_t c= 1; c < spmv_copies; ++c) {
+      double const *const z= priv.data() + (c - 1) * n1;
+      for(size_t r= 0; r < n1; ++r) yd[r * sy]+= z[r];
+    }
+    return;
+  }
+  for(size_t k= 0; k < m->nz; ++k) {
+    yd[size_t(mi[k]) * sy]+= md[k] * double(xd[size_t(mp[k]) * sx]);
+  }
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,12 @@
+/// \file       include/gslcpp/statistics.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for statistics.
+
+#pragma once
+
+#include "stats/quantile.hpp" // median, quantile, quantiles
+#include "stats/rstat.hpp" // rstat
+#include "stats/tdigest.hpp" // tdigest, tdigest_of
+#include "stats/v-stats.hpp" // mean, variance, sd, etc.
+
+// EOF
@@ -0,0 +1,314 @@
+/// \dir        include/gslcpp/stats
+/// \brief      Types and functions specific to statistics.
+
+/// \file       include/gslcpp/stats/moments.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::moments and gsl::comoments.
+
+#pragma once
+
+#include <algorithm> // min
+#include <cmath> // sqrt
+#include <type_traits> // is_same_v
+
+namespace gsl {
+
+
+/// Number of elements in each block processed by gsl::moments and by
+/// gsl::comoments.  A block is read twice, but the second read is from cache.
+constexpr size_t stats_block= 1024;
+
+/// Number of independent accumulators in the kernel for each block.  Because
+/// the accumulators are independent, the compiler can vectorize each loop
+/// without reordering any sum.
+constexpr size_t stats_lanes= 4;
+
+
+/// Sum over lanes of accumulator.
+/// @param s  Accumulator.
+/// @return  Sum of every lane.
+inline double lane_sum(double const (&s)[stats_lanes]) {
+  double t= 0.0;
+  for(size_t l= 0; l < stats_lanes; ++l) t+= s[l];
+  return t;
+}
+
+
+/// Mergeable accumulator for count, mean, and second, third, and fourth
+/// central moments.
+///
+/// Definitions of variance(), sd(), skew(), and kurtosis() match those of
+/// gsl_stats_variance(), gsl_stats_sd(), gsl_stats_skew(), and
+/// gsl_stats_kurtosis().
+///
+/// Values are added either one at a time (by Welford's update) or in blocks.
+/// For a block, the mean is computed first and then the central moments
+/// about it, as GSL does for a whole vector, and the block is then merged
+/// into the accumulator by Pébay's formulas.  Two accumulators of disjoint
+/// data may likewise be merged, so that chunks of a vector can be reduced in
+/// parallel.
+class moments {
+  size_t n_= 0; ///< Number of values.
+  double mean_= 0.0; ///< Mean.
+  double m2_= 0.0; ///< Sum of squares of deviations from mean.
+  double m3_= 0.0; ///< Sum of cubes of deviations from mean.
+  double m4_= 0.0; ///< Sum of fourth powers of deviations from mean.
+
+  /// Add contiguous block of at most gsl::stats_block values.
+  /// @param x  Pointer to first value.
+  /// @param m  Number of values.
+  void add_block(double const *x, size_t m) {
+    size_t const mv= m - m % stats_lanes;
+    double s[stats_lanes]= {};
+    for(size_t i= 0; i < mv; i+= stats_lanes) {
+      for(size_t l= 0; l < stats_lanes; ++l) s[l]+= x[i + l];
+    }
+    for(size_t i= mv; i < m; ++i) s[0]+= x[i];
+    double const mean= lane_sum(s) / m;
+    double s2[stats_lanes]= {}, s3[stats_lanes]= {}, s4[stats_lanes]= {};
+    for(size_t i= 0; i < mv; i+= stats_lanes) {
+      for(size_t l= 0; l < stats_lanes; ++l) {
+        double const d= x[i + l] - mean, d2= d * d;
+        s2[l]+= d2;
+        s3[l]+= d2 * d;
+        s4[l]+= d2 * d2;
+      }
+    }
+    for(size_t i= mv; i < m; ++i) {
+      double const d= x[i] - mean, d2= d * d;
+      s2[0]+= d2;
+      s3[0]+= d2 * d;
+      s4[0]+= d2 * d2;
+    }
+    moments b;
+    b.n_= m;
+    b.mean_= mean;
+    b.m2_= lane_sum(s2);
+    b.m3_= lane_sum(s3);
+    b.m4_= lane_sum(s4);
+    *this+= b;
+  }
+
+public:
+  /// Number of values.
+  /// @return  Number of values.
+  size_t count() const { return n_; }
+
+  /// Mean.
+  /// @return  Mean.
+  double mean() const { return mean_; }
+
+  /// Unbiased estimate of variance, with `n - 1` in denominator.
+  /// @return  Variance.
+  double variance() const { return m2_ / (double(n_) - 1.0); }
+
+  /// Square root of variance().
+  /// @return  Standard deviation.
+  double sd() const { return std::sqrt(variance()); }
+
+  /// Skewness, as mean of cube of deviation divided by sd().
+  /// @return  Skewness.
+  double skew() const {
+    double const s= sd();
+    return m3_ / double(n_) / (s * s * s);
+  }
+
+  /// Kurtosis, as mean of fourth power of deviation divided by sd(), minus
+  /// three.
+  /// @return  Excess kurtosis.
+  double kurtosis() const {
+    double const v= variance();
+    return m4_ / double(n_) / (v * v) - 3.0;
+  }
+
+  /// Add single value.
+  /// @param x  Value.
+  void add(double x) {
+    double const n1= double(n_++), n= double(n_);
+    double const d= x - mean_, dn= d / n, dn2= dn * dn, t= d * dn * n1;
+    mean_+= dn;
+    m4_+= t * dn2 * (n * n - 3.0 * n + 3.0) + 6.0 * dn2 * m2_ - 4.0 * dn * m3_;
+    m3_+= t * dn * (n - 2.0) - 3.0 * dn * m2_;
+    m2_+= t;
+  }
+
+  /// Add values from array.
+  /// \tparam T  Type of each value.
+  /// @param x  Pointer to first value.
+  /// @param m  Number of values.
+  /// @param stride  Offset between successive values.
+  template<typename T> void add(T const *x, size_t m, size_t stride= 1) {
+    double buf[stats_block];
+    for(size_t b= 0; b < m; b+= stats_block) {
+      size_t const k= std::min(stats_block, m - b);
+      T const *const y= x + b * stride;
+      if constexpr(std::is_same_v<T, double>) {
+        if(stride == 1) {
+          add_block(y, k);
+          continue;
+        }
+      }
+      for(size_t i= 0; i < k; ++i) buf[i]= double(y[i * stride]);
+      add_block(buf, k);
+    }
+  }
+
+  /// Merge moments of disjoint data.
+  /// @param b  Moments of other data.
+  /// @return  Reference to this instance.
+  moments &operator+=(moments const &b) {
+    if(b.n_ == 0) return *this;
+    if(n_ == 0) return *this= b;
+    double const na= double(n_), nb= double(b.n_), n= na + nb;
+    double const d= b.mean_ - mean_, d2= d * d, nab= na * nb;
+    double const m2= m2_ + b.m2_ + d2 * nab / n;
+    double const m3= m3_ + b.m3_ + d * d2 * nab * (na - nb) / (n * n) +
+                     3.0 * d * (na * b.m2_ - nb * m2_) / n;
+    m4_= m4_ + b.m4_ + d2 * d2 * nab * (na * na - nab + nb * nb) / (n * n * n) +
+         6.0 * d2 * (na * na * b.m2_ + nb * nb * m2_) / (n * n) +
+         4.0 * d * (na * b.m3_ - nb * m3_) / n;
+    m3_= m3;
+    m2_= m2;
+    mean_+= d * nb / n;
+    n_+= b.n_;
+    return *this;
+  }
+};
+
+
+/// Mergeable accumulator for count, means, variances, and covariance of pairs
+/// of values.
+///
+/// Definitions of covariance() and correlation() match those of
+/// gsl_stats_covariance() and gsl_stats_correlation().  Blocks and merging
+/// work as for gsl::moments.
+class comoments {
+  size_t n_= 0; ///< Number of pairs.
+  double mx_= 0.0; ///< Mean of first values.
+  double my_= 0.0; ///< Mean of second values.
+  double sxx_= 0.0; ///< Sum of squares of deviations of first values.
+  double syy_= 0.0; ///< Sum of squares of deviations of second values.
+  double sxy_= 0.0; ///< Sum of products of deviations.
+
+  /// Add contiguous blocks of at most gsl::stats_block pairs.
+  /// @param x  Pointer to first of first values.
+  /// @param y  Pointer to first of second values.
+  /// @param m  Number of pairs.
+  void add_block(double const *x, double const *y, size_t m) {
+    size_t const mv= m - m % stats_lanes;
+    double sx[stats_lanes]= {}, sy[stats_lanes]= {};
+    for(size_t i= 0; i < mv; i+= stats_lanes) {
+      for(size_t l= 0; l < stats_lanes; ++l) {
+        sx[l]+= x[i + l];
+        sy[l]+= y[i + l];
+      }
+    }
+    for(size_t i= mv; i < m; ++i) {
+      sx[0]+= x[i];
+      sy[0]+= y[i];
+    }
+    double const mx= lane_sum(sx) / m;
+    double const my= lane_sum(sy) / m;
+    double sxx[stats_lanes]= {}, syy[stats_lanes]= {}, sxy[stats_lanes]= {};
+    for(size_t i= 0; i < mv; i+= stats_lanes) {
+      for(size_t l= 0; l < stats_lanes; ++l) {
+        double const dx= x[i + l] - mx, dy= y[i + l] - my;
+        sxx[l]+= dx * dx;
+        syy[l]+= dy * dy;
+        sxy[l]+= dx * dy;
+      }
+    }
+    for(size_t i= mv; i < m; ++i) {
+      double const dx= x[i] - mx, dy= y[i] - my;
+      sxx[0]+= dx * dx;
+      syy[0]+= dy * dy;
+      sxy[0]+= dx * dy;
+    }
+    comoments b;
+    b.n_= m;
+    b.mx_= mx;
+    b.my_= my;
+    b.sxx_= lane_sum(sxx);
+    b.syy_= lane_sum(syy);
+    b.sxy_= lane_sum(sxy);
+    *this+= b;
+  }
+
+public:
+  /// Number of pairs.
+  /// @return  Number of pairs.
+  size_t count() const { return n_; }
+
+  /// Mean of first values.
+  /// @return  Mean of first values.
+  double mean_x() const { return mx_; }
+
+  /// Mean of second values.
+  /// @return  Mean of second values.
+  double mean_y() const { return my_; }
+
+  /// Unbiased estimate of covariance, with `n - 1` in denominator.
+  /// @return  Covariance.
+  double covariance() const { return sxy_ / (double(n_) - 1.0); }
+
+  /// Pearson correlation-coefficient.
+  /// @return  Correlation.
+  double correlation() const { return sxy_ / std::sqrt(sxx_ * syy_); }
+
+  /// Add single pair.
+  /// @param x  First value.
+  /// @param y  Second value.
+  void add(double x, double y) {
+    double const n= double(++n_);
+    double const dx= x - mx_, dy= y - my_;
+    mx_+= dx / n;
+    my_+= dy / n;
+    double const r= (n - 1.0) / n;
+    sxx_+= dx * dx * r;
+    syy_+= dy * dy * r;
+    sxy_+= dx * dy * r;
+  }
+
+  /// Add pairs from arrays.
+  /// \tparam T1  Type of each first value.
+  /// \tparam T2  Type of each second value.
+  /// @param x  Pointer to first of first values.
+  /// @param sx  Offset between successive first values.
+  /// @param y  Pointer to first of second values.
+  /// @param sy  Offset between successive second values.
+  /// @param m  Number of pairs.
+  template<typename T1, typename T2>
+  void add(T1 const *x, size_t sx, T2 const *y, size_t sy, size_t m) {
+    double bx[stats_block], by[stats_block];
+    for(size_t b= 0; b < m; b+= stats_block) {
+      size_t const k= std::min(stats_block, m - b);
+      T1 const *const u= x + b * sx;
+      T2 const *const v= y + b * sy;
+      for(size_t i= 0; i < k; ++i) bx[i]= double(u[i * sx]);
+      for(size_t i= 0; i < k; ++i) by[i]= double(v[i * sy]);
+      add_block(bx, by, k);
+    }
+  }
+
+  /// Merge comoments of disjoint data.
+  /// @param b  Comoments of other data.
+  /// @return  Reference to this instance.
+  comoments &operator+=(comoments const &b) {
+    if(b.n_ == 0) return *this;
+    if(n_ == 0) return *this= b;
+    double const na= double(n_), nb= double(b.n_), n= na + nb;
+    double const dx= b.mx_ - mx_, dy= b.my_ - my_, f= na * nb / n;
+    sxx_+= b.sxx_ + dx * dx * f;
+    syy_+= b.syy_ + dy * dy * f;
+    sxy_+= b.sxy_ + dx * dy * f;
+    mx_+= dx * nb / n;
+    my_+= dy * nb / n;
+    n_+= b.n_;
+    return *this;
+  }
+};
+
+
+} // namespace gsl
+
+// EOF
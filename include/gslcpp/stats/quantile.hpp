@@ -0,0 +1,208 @@
+/// \file       include/gslcpp/stats/quantile.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::quantile_workspace, gsl::select_many(),
+///             gsl::median(), gsl::quantile(), and gsl::quantiles().
+
+#pragma once
+
+#include "../sort/v-sort.hpp" // sort_key
+#include <algorithm> // min_element, nth_element, sort, unique
+#include <cmath> // floor
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Scratch space for computing quantiles by selection.
+///
+/// Each query copies the vector into the workspace and rearranges the copy
+/// in place.  Storage grows to the largest vector seen and is then reused, so
+/// that repeated queries allocate nothing.  By default, each function uses
+/// the calling thread's workspace, local().
+///
+/// \tparam T  Type of element.
+template<typename T> class quantile_workspace {
+  std::vector<T> buf_; ///< Copy of vector being queried.
+  std::vector<size_t> off_; ///< Offsets to select, for gsl::quantiles().
+
+public:
+  /// Workspace for current thread.
+  /// @return  Reference to thread-local workspace.
+  static quantile_workspace &local() {
+    static thread_local quantile_workspace w;
+    return w;
+  }
+
+  /// Copy vector into workspace.
+  /// \tparam U  Type of element in vector (`T` or `T const`).
+  /// \tparam N  Compile-time number of elements.
+  /// \tparam V  Type of interface to storage.
+  /// @param v  Vector.
+  /// @return  Pointer to first element of copy.
+  template<typename U, size_t N, template<typename, size_t> class V>
+  T *load(v_iface<U, N, V> const &v) {
+    size_t const n= v.size(), s= v.v()->stride;
+    if(n == 0) throw std::invalid_argument("empty vector");
+    if(buf_.size() < n) buf_.resize(n);
+    U const *const d= v.data();
+    for(size_t i= 0; i < n; ++i) buf_[i]= d[i * s];
+    return buf_.data();
+  }
+
+  /// Empty list of offsets to select, whose storage is reused.
+  /// @param m  Number of offsets for which to reserve storage.
+  /// @return  Reference to empty list.
+  std::vector<size_t> &offsets(size_t m) {
+    off_.clear();
+    off_.reserve(m);
+    return off_;
+  }
+
+  /// Number of elements for which storage is allocated.
+  /// @return  Capacity of workspace.
+  size_t capacity() const { return buf_.size(); }
+};
+
+
+/// Rearrange array so that each element at an offset in `k` is what it would
+/// be if the array were sorted.
+///
+/// The middle offset is selected first by `std::nth_element` (introselect),
+/// and then the elements on each side of it are processed recursively, so
+/// that the cost is O(n log m) rather than the O(n log n) of a full sort.
+///
+/// \tparam T  Type of element.
+/// @param d  Pointer to first element of array.
+/// @param b  Offset of first element of range to rearrange.
+/// @param e  Offset past last element of range to rearrange.
+/// @param k  Pointer to first of ascending offsets, each in `[b, e)`.
+/// @param m  Number of offsets.
+template<typename T>
+void select_many(T *d, size_t b, size_t e, size_t const *k, size_t m) {
+  if(m == 0) return;
+  size_t const h= m / 2, kh= k[h];
+  std::nth_element(d + b, d + kh, d + e, sort_key<T>());
+  select_many(d, b, kh, k, h);
+  select_many(d, kh + 1, e, k + h + 1, m - h - 1);
+}
+
+
+/// Lower offset and weight of upper neighbor for quantile, as in
+/// gsl_stats_quantile_from_sorted_data().
+/// @param n  Number of elements.
+/// @param f  Fraction in `[0, 1]`.
+/// @param w  On return, weight of element at returned offset plus one.
+/// @return  Offset of lower element.
+inline size_t quantile_offset(size_t n, double f, double &w) {
+  if(!(f >= 0.0 && f <= 1.0)) throw std::invalid_argument("bad fraction");
+  double const delta= (n - 1) * f;
+  size_t const i= size_t(std::floor(delta));
+  w= (i + 1 < n ? delta - i : 0.0);
+  return i;
+}
+
+
+/// Quantile of elements in vector, computed by selection rather than by
+/// sorting.  The definition matches gsl_stats_quantile_from_sorted_data()
+/// applied to a sorted copy of the vector.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param f  Fraction in `[0, 1]`.
+/// @param w  Workspace.
+/// @return  Quantile.
+template<typename T, size_t N, template<typename, size_t> class V>
+double quantile(
+      v_iface<T, N, V> const &v,
+      double f,
+      quantile_workspace<std::remove_const_t<T>> &w=
+            quantile_workspace<std::remove_const_t<T>>::local()) {
+  using E= std::remove_const_t<T>;
+  size_t const n= v.size();
+  E *const d= w.load(v);
+  double hi;
+  size_t const i= quantile_offset(n, f, hi);
+  std::nth_element(d, d + i, d + n, sort_key<E>());
+  if(hi == 0.0) return double(d[i]);
+  E const u= *std::min_element(d + i + 1, d + n, sort_key<E>());
+  return (1.0 - hi) * double(d[i]) + hi * double(u);
+}
+
+
+/// Median of elements in vector, computed by selection rather than by
+/// sorting.  The definition matches gsl_stats_median().
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param w  Workspace.
+/// @return  Median.
+template<typename T, size_t N, template<typename, size_t> class V>
+double median(
+      v_iface<T, N, V> const &v,
+      quantile_workspace<std::remove_const_t<T>> &w=
+            quantile_workspace<std::remove_const_t<T>>::local()) {
+  return quantile(v, 0.5, w);
+}
+
+
+/// Several quantiles of elements in vector, computed by a single copy and by
+/// gsl::select_many().
+/// \tparam T  Type of element in vector.
+/// \tparam TF  Type of element in vector of fractions.
+/// \tparam N  Compile-time number of elements in `v`.
+/// \tparam NF  Compile-time number of elements in `f`.
+/// \tparam NR  Compile-time number of elements in `r`.
+/// \tparam V  Type of interface to storage for `v`.
+/// \tparam VF  Type of interface to storage for `f`.
+/// \tparam VR  Type of interface to storage for `r`.
+/// @param v  Vector.
+/// @param f  Fractions, each in `[0, 1]`, in any order.
+/// @param r  On return, quantile for each fraction.
+/// @param w  Workspace.
+template<
+      typename T,
+      typename TF,
+      size_t N,
+      size_t NF,
+      size_t NR,
+      template<typename, size_t>
+      class V,
+      template<typename, size_t>
+      class VF,
+      template<typename, size_t>
+      class VR>
+void quantiles(
+      v_iface<T, N, V> const &v,
+      v_iface<TF, NF, VF> const &f,
+      v_iface<double, NR, VR> &r,
+      quantile_workspace<std::remove_const_t<T>> &w=
+            quantile_workspace<std::remove_const_t<T>>::local()) {
+  using E= std::remove_const_t<T>;
+  size_t const n= v.size(), m= f.size();
+  if(r.size() != m) throw std::invalid_argument("mismatch in size");
+  E *const d= w.load(v);
+  std::vector<size_t> &k= w.offsets(2 * m);
+  for(size_t j= 0; j < m; ++j) {
+    double hi;
+    size_t const i= quantile_offset(n, f[j], hi);
+    k.push_back(i);
+    if(hi > 0.0) k.push_back(i + 1);
+  }
+  std::sort(k.begin(), k.end());
+  k.erase(std::unique(k.begin(), k.end()), k.end());
+  select_many(d, 0, n, k.data(), k.size());
+  for(size_t j= 0; j < m; ++j) {
+    double hi;
+    size_t const i= quantile_offset(n, f[j], hi);
+    r[j]= double(d[i]);
+    if(hi > 0.0) r[j]= (1.0 - hi) * r[j] + hi * double(d[i + 1]);
+  }
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,199 @@
+/// \file       include/gslcpp/stats/rstat.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::rstat.
+
+#pragma once
+
+#include "tdigest.hpp" // tdigest
+#include "v-stats.hpp" // moments, stats_grain, stats_lanes, thread_pool
+#include <algorithm> // max, min
+#include <cmath> // sqrt
+#include <limits> // numeric_limits
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Running statistics of stream of values, which need not be stored.
+///
+/// This is a replacement for GSL's `gsl_rstat_workspace`, with the same
+/// results (except for the median, which is approximate in both but by
+/// different methods), and with two additions:
+///
+/// - A whole chunk (any gsl::v_iface) is ingested at once.  Moments are
+///   accumulated by gsl::moments, in blocks with independent accumulator
+///   lanes, and the chunk is split across a gsl::thread_pool.
+///
+/// - Two accumulators of disjoint data may be merged, so that each thread may
+///   keep its own.
+///
+/// The median and other quantiles come from a gsl::tdigest rather than from
+/// GSL's P-squared algorithm, because a t-digest can be merged.
+class rstat {
+  moments m_; ///< Count, mean, and central moments.
+  double min_= std::numeric_limits<double>::infinity(); ///< Least value.
+  double max_= -std::numeric_limits<double>::infinity(); ///< Greatest value.
+  tdigest t_; ///< Sketch for median and other quantiles.
+
+public:
+  /// Initialize empty accumulator.
+  /// @param compression  Compression of gsl::tdigest for median.
+  explicit rstat(double compression= 100.0): t_(compression) {}
+
+  /// Discard every value.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_reset
+  void reset() { *this= rstat(t_.compression()); }
+
+  /// Add single value.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_add
+  /// @param x  Value.
+  /// @return  Reference to this instance.
+  rstat &add(double x) {
+    m_.add(x);
+    min_= std::min(min_, x);
+    max_= std::max(max_, x);
+    t_.add(x);
+    return *this;
+  }
+
+  /// Add values from array.
+  /// \tparam T  Type of each value.
+  /// @param x  Pointer to first value.
+  /// @param m  Number of values.
+  /// @param stride  Offset between successive values.
+  /// @return  Reference to this instance.
+  template<typename T> rstat &add(T const *x, size_t m, size_t stride= 1) {
+    m_.add(x, m, stride);
+    t_.add(x, m, stride);
+    size_t const mv= m - m % stats_lanes;
+    double lo[stats_lanes], hi[stats_lanes];
+    for(size_t l= 0; l < stats_lanes; ++l) {
+      lo[l]= min_;
+      hi[l]= max_;
+    }
+    for(size_t i= 0; i < mv; i+= stats_lanes) {
+      for(size_t l= 0; l < stats_lanes; ++l) {
+        double const y= double(x[(i + l) * stride]);
+        lo[l]= (y < lo[l] ? y : lo[l]);
+        hi[l]= (y > hi[l] ? y : hi[l]);
+      }
+    }
+    for(size_t i= mv; i < m; ++i) {
+      double const y= double(x[i * stride]);
+      lo[0]= (y < lo[0] ? y : lo[0]);
+      hi[0]= (y > hi[0] ? y : hi[0]);
+    }
+    for(size_t l= 0; l < stats_lanes; ++l) {
+      min_= std::min(min_, lo[l]);
+      max_= std::max(max_, hi[l]);
+    }
+    return *this;
+  }
+
+  /// Add every element of vector.
+  /// Chunks of the vector are accumulated in parallel and merged in order, so
+  /// that the result does not depend on the number of threads.
+  /// \tparam T  Type of element in vector.
+  /// \tparam N  Compile-time number of elements.
+  /// \tparam V  Type of interface to storage.
+  /// @param v  Vector.
+  /// @param p  Pool over which to distribute chunks.
+  /// @return  Reference to this instance.
+  template<typename T, size_t N, template<typename, size_t> class V>
+  rstat &
+  add(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+    size_t const n= v.size(), s= v.v()->stride;
+    auto const *const d= v.data();
+    if(n <= stats_grain) return add(d, n, s);
+    size_t const k= (n + stats_grain - 1) / stats_grain;
+    std::vector<rstat> part(k, rstat(t_.compression()));
+    p.for_chunks(n, stats_grain, [&](size_t b, size_t e, unsigned) {
+      part[b / stats_grain].add(d + b * s, e - b, s);
+    });
+    for(rstat const &r: part) *this+= r;
+    return *this;
+  }
+
+  /// Merge accumulator of disjoint data.
+  /// @param r  Accumulator of other data.
+  /// @return  Reference to this instance.
+  rstat &operator+=(rstat const &r) {
+    m_+= r.m_;
+    min_= std::min(min_, r.min_);
+    max_= std::max(max_, r.max_);
+    t_+= r.t_;
+    return *this;
+  }
+
+  /// Number of values.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_n
+  /// @return  Number of values.
+  size_t n() const { return m_.count(); }
+
+  /// Least value, or zero if there be none.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_min
+  /// @return  Least value.
+  double min() const { return n() ? min_ : 0.0; }
+
+  /// Greatest value, or zero if there be none.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_max
+  /// @return  Greatest value.
+  double max() const { return n() ? max_ : 0.0; }
+
+  /// Mean.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_mean
+  /// @return  Mean.
+  double mean() const { return m_.mean(); }
+
+  /// Unbiased estimate of variance, or zero if there be fewer than two
+  /// values.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_variance
+  /// @return  Variance.
+  double variance() const { return n() > 1 ? m_.variance() : 0.0; }
+
+  /// Standard deviation, or zero if there be fewer than two values.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_sd
+  /// @return  Standard deviation.
+  double sd() const { return n() > 1 ? m_.sd() : 0.0; }
+
+  /// Standard deviation of mean, or zero if there be fewer than two values.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_sd_mean
+  /// @return  Standard deviation of mean.
+  double sd_mean() const {
+    return n() > 1 ? m_.sd() / std::sqrt(double(n())) : 0.0;
+  }
+
+  /// Root mean square, or zero if there be no value.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_rms
+  /// @return  Root mean square.
+  double rms() const {
+    if(n() == 0) return 0.0;
+    double const n1= double(n()), mean= m_.mean();
+    return std::sqrt(mean * mean + (n1 - 1.0) / n1 * variance());
+  }
+
+  /// Skewness, or zero if there be no value.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_skew
+  /// @return  Skewness.
+  double skew() const { return n() ? m_.skew() : 0.0; }
+
+  /// Excess kurtosis, or zero if there be no value.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_kurtosis
+  /// @return  Excess kurtosis.
+  double kurtosis() const { return n() ? m_.kurtosis() : 0.0; }
+
+  /// Approximate median.
+  /// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_rstat_median
+  /// @return  Approximate median.
+  double median() const { return t_.quantile(0.5); }
+
+  /// Approximate quantile.
+  /// @param q  Fraction in `[0, 1]`.
+  /// @return  Approximate quantile.
+  double quantile(double q) const { return t_.quantile(q); }
+};
+
+
+} // namespace gsl
+
+// EOF
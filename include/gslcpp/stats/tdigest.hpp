@@ -0,0 +1,205 @@
+/// \file       include/gslcpp/stats/tdigest.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition for gsl::tdigest and gsl::tdigest_of().
+
+#pragma once
+
+#include "v-stats.hpp" // stats_grain, thread_pool, v_iface
+#include <algorithm> // max, min, sort
+#include <cmath> // asin, quiet_NaN
+#include <limits> // numeric_limits
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Mergeable sketch for approximate quantiles (Dunning's merging t-digest).
+///
+/// Values are buffered and periodically merged into a sorted list of
+/// centroids.  The size of each centroid is limited by the arcsine scale
+/// function, so that centroids near either tail are small; the error of a
+/// quantile is thus smallest near 0 and 1, which suits p99 and the like.
+/// The number of centroids is bounded by about `compression`, independently
+/// of the number of values.
+///
+/// Two digests of disjoint data may be merged, so that a digest of a large
+/// vector can be built in parallel (see gsl::tdigest_of()).  The result of
+/// adding the same values in the same order is deterministic.
+///
+/// A query may merge the buffer, and so concurrent queries on the same
+/// instance, even a constant one, must be synchronized by the caller.
+class tdigest {
+  /// Mean and weight of cluster of values.
+  struct centroid {
+    double mean; ///< Mean of values in cluster.
+    double weight; ///< Number of values in cluster.
+
+    /// Order of centroids by mean.
+    /// @param a  First centroid.
+    /// @param b  Second centroid.
+    /// @return  True only if mean of `a` be less than mean of `b`.
+    static bool less(centroid const &a, centroid const &b) {
+      return a.mean < b.mean;
+    }
+  };
+
+  double delta_; ///< Compression.
+  mutable std::vector<centroid> c_; ///< Merged centroids, sorted by mean.
+  mutable std::vector<centroid> buf_; ///< Values not yet merged.
+  double weight_= 0.0; ///< Total weight, including buffer.
+  double min_= std::numeric_limits<double>::infinity(); ///< Least value.
+  double max_= -std::numeric_limits<double>::infinity(); ///< Greatest value.
+
+  /// Scale function.
+  /// @param q  Cumulative fraction of weight.
+  /// @return  Index of scale at `q`.
+  double k(double q) const {
+    double const pi= 3.14159265358979323846;
+    return delta_ / (2.0 * pi) * std::asin(std::min(1.0, 2.0 * q - 1.0));
+  }
+
+  /// Merge buffer into centroids.  This changes the representation but not
+  /// the logical state, and so is allowed on a constant instance.
+  void flush() const {
+    if(buf_.empty()) return;
+    buf_.insert(buf_.end(), c_.begin(), c_.end());
+    std::sort(buf_.begin(), buf_.end(), &centroid::less);
+    c_.clear();
+    double const w= weight_;
+    double cum= 0.0, klo= k(0.0);
+    centroid cur= buf_[0];
+    for(size_t i= 1; i < buf_.size(); ++i) {
+      centroid const &x= buf_[i];
+      if(k((cum + cur.weight + x.weight) / w) - klo <= 1.0) {
+        cur.weight+= x.weight;
+        cur.mean+= (x.mean - cur.mean) * x.weight / cur.weight;
+      } else {
+        c_.push_back(cur);
+        cum+= cur.weight;
+        klo= k(cum / w);
+        cur= x;
+      }
+    }
+    c_.push_back(cur);
+    buf_.clear();
+  }
+
+public:
+  /// Initialize empty digest.
+  /// @param compression  Bound on number of centroids; larger is more
+  ///                     accurate.
+  explicit tdigest(double compression= 100.0): delta_(compression) {
+    buf_.reserve(size_t(8 * delta_));
+  }
+
+  /// Compression.
+  /// @return  Bound on number of centroids.
+  double compression() const { return delta_; }
+
+  /// Number of values added.
+  /// @return  Total weight.
+  double count() const { return weight_; }
+
+  /// Add value.
+  /// @param x  Value.
+  /// @param w  Weight of value.
+  void add(double x, double w= 1.0) {
+    if(buf_.size() >= size_t(8 * delta_)) flush();
+    buf_.push_back({x, w});
+    weight_+= w;
+    min_= std::min(min_, x);
+    max_= std::max(max_, x);
+  }
+
+  /// Add values from array.
+  /// \tparam T  Type of each value.
+  /// @param x  Pointer to first value.
+  /// @param m  Number of values.
+  /// @param stride  Offset between successive values.
+  template<typename T> void add(T const *x, size_t m, size_t stride= 1) {
+    for(size_t i= 0; i < m; ++i) add(double(x[i * stride]));
+  }
+
+  /// Merge digest of other data.  Merging a digest with itself merges a copy,
+  /// so that every value counts twice.
+  /// @param d  Digest of other data.
+  /// @return  Reference to this instance.
+  tdigest &operator+=(tdigest const &d) {
+    if(&d == this) return *this+= tdigest(d);
+    for(centroid const &x: d.c_) add(x.mean, x.weight);
+    for(centroid const &x: d.buf_) add(x.mean, x.weight);
+    min_= std::min(min_, d.min_);
+    max_= std::max(max_, d.max_);
+    return *this;
+  }
+
+  /// Number of centroids after merging buffer.
+  /// @return  Number of centroids.
+  size_t size() const {
+    flush();
+    return c_.size();
+  }
+
+  /// Approximate quantile, by linear interpolation between centers of
+  /// adjacent centroids, and between extreme centroid and extreme value.
+  /// @param q  Fraction in `[0, 1]`.
+  /// @return  Approximate quantile, or NaN if digest be empty.
+  double quantile(double q) const {
+    flush();
+    if(c_.empty()) return std::numeric_limits<double>::quiet_NaN();
+    if(q <= 0.0) return min_;
+    if(q >= 1.0) return max_;
+    double const t= q * weight_;
+    centroid const &first= c_.front(), &last= c_.back();
+    if(t < first.weight / 2.0) {
+      return min_ + (first.mean - min_) * t / (first.weight / 2.0);
+    }
+    if(t > weight_ - last.weight / 2.0) {
+      double const r= (weight_ - t) / (last.weight / 2.0);
+      return max_ - (max_ - last.mean) * r;
+    }
+    double cum= first.weight / 2.0; // Weight up to center of centroid i.
+    for(size_t i= 0; i + 1 < c_.size(); ++i) {
+      double const gap= (c_[i].weight + c_[i + 1].weight) / 2.0;
+      if(t <= cum + gap) {
+        double const a= (t - cum) / gap;
+        return c_[i].mean + a * (c_[i + 1].mean - c_[i].mean);
+      }
+      cum+= gap;
+    }
+    return last.mean;
+  }
+};
+
+
+/// Digest of elements in vector, built in parallel.
+/// Each chunk of the vector is digested by one worker, and the digests are
+/// merged in order, so that the result does not depend on the number of
+/// threads.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param compression  Bound on number of centroids.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Digest of elements in `v`.
+template<typename T, size_t N, template<typename, size_t> class V>
+tdigest tdigest_of(
+      v_iface<T, N, V> const &v,
+      double compression= 100.0,
+      thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size(), s= v.v()->stride, grain= stats_grain;
+  auto const *const d= v.data();
+  std::vector<tdigest> part((n + grain - 1) / grain, tdigest(compression));
+  p.for_chunks(n, grain, [&](size_t b, size_t e, unsigned) {
+    part[b / grain].add(d + b * s, e - b, s);
+  });
+  tdigest t(compression);
+  for(tdigest const &c: part) t+= c;
+  return t;
+}
+
+
+} // namespace gsl
+
+// EOF
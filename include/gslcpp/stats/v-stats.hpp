@@ -0,0 +1,224 @@
+/// \file       include/gslcpp/stats/v-stats.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definition of gsl::moments_of(), gsl::mean(), gsl::variance(),
+///             gsl::sd(), gsl::skew(), gsl::kurtosis(), gsl::comoments_of(),
+///             gsl::covariance(), and gsl::correlation().
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vec/v-iface.hpp" // v_iface
+#include "moments.hpp" // moments, comoments
+#include <stdexcept> // invalid_argument
+#include <vector> // vector
+
+namespace gsl {
+
+
+/// Number of elements in each chunk reduced by a single worker.  Because
+/// chunks are fixed in size and are merged in order, every statistic is the
+/// same for any number of threads.
+constexpr size_t stats_grain= size_t(1) << 16;
+
+
+/// Moments of elements in vector, computed in a single pass.
+/// Chunks of the vector are reduced in parallel and merged in order.
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Moments of elements in `v`.
+template<typename T, size_t N, template<typename, size_t> class V>
+moments
+moments_of(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  size_t const n= v.size(), s= v.v()->stride;
+  auto const *const d= v.data();
+  if(n <= stats_grain) {
+    moments m;
+    m.add(d, n, s);
+    return m;
+  }
+  std::vector<moments> part((n + stats_grain - 1) / stats_grain);
+  p.for_chunks(n, stats_grain, [&](size_t b, size_t e, unsigned) {
+    part[b / stats_grain].add(d + b * s, e - b, s);
+  });
+  moments m;
+  for(moments const &c: part) m+= c;
+  return m;
+}
+
+
+/// Mean of elements in vector.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_mean
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Mean.
+template<typename T, size_t N, template<typename, size_t> class V>
+double mean(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  return moments_of(v, p).mean();
+}
+
+
+/// Unbiased estimate of variance of elements in vector.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_variance
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Variance.
+template<typename T, size_t N, template<typename, size_t> class V>
+double
+variance(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  return moments_of(v, p).variance();
+}
+
+
+/// Standard deviation of elements in vector.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_sd
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Standard deviation.
+template<typename T, size_t N, template<typename, size_t> class V>
+double sd(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  return moments_of(v, p).sd();
+}
+
+
+/// Skewness of elements in vector.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_skew
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Skewness.
+template<typename T, size_t N, template<typename, size_t> class V>
+double skew(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  return moments_of(v, p).skew();
+}
+
+
+/// Excess kurtosis of elements in vector.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_kurtosis
+/// \tparam T  Type of element in vector.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param v  Vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Excess kurtosis.
+template<typename T, size_t N, template<typename, size_t> class V>
+double
+kurtosis(v_iface<T, N, V> const &v, thread_pool &p= thread_pool::global()) {
+  return moments_of(v, p).kurtosis();
+}
+
+
+/// Comoments of corresponding elements in two vectors, computed in a single
+/// pass.  Chunks are reduced in parallel and merged in order.
+/// \tparam T1  Type of element in first vector.
+/// \tparam T2  Type of element in second vector.
+/// \tparam N1  Compile-time number of elements in first vector.
+/// \tparam N2  Compile-time number of elements in second vector.
+/// \tparam V1  Type of interface to storage for first vector.
+/// \tparam V2  Type of interface to storage for second vector.
+/// @param x  First vector.
+/// @param y  Second vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Comoments of `x` and `y`.
+template<
+      typename T1,
+      typename T2,
+      size_t N1,
+      size_t N2,
+      template<typename, size_t>
+      class V1,
+      template<typename, size_t>
+      class V2>
+comoments comoments_of(
+      v_iface<T1, N1, V1> const &x,
+      v_iface<T2, N2, V2> const &y,
+      thread_pool &p= thread_pool::global()) {
+  static_assert(N1 == N2 || N1 == 0 || N2 == 0);
+  size_t const n= x.size(), sx= x.v()->stride, sy= y.v()->stride;
+  if(y.size() != n) throw std::invalid_argument("mismatch in size");
+  auto const *const dx= x.data();
+  auto const *const dy= y.data();
+  std::vector<comoments> part((n + stats_grain - 1) / stats_grain);
+  p.for_chunks(n, stats_grain, [&](size_t b, size_t e, unsigned) {
+    part[b / stats_grain].add(dx + b * sx, sx, dy + b * sy, sy, e - b);
+  });
+  comoments m;
+  for(comoments const &c: part) m+= c;
+  return m;
+}
+
+
+/// Unbiased estimate of covariance of corresponding elements in two vectors.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_covariance
+/// \tparam T1  Type of element in first vector.
+/// \tparam T2  Type of element in second vector.
+/// \tparam N1  Compile-time number of elements in first vector.
+/// \tparam N2  Compile-time number of elements in second vector.
+/// \tparam V1  Type of interface to storage for first vector.
+/// \tparam V2  Type of interface to storage for second vector.
+/// @param x  First vector.
+/// @param y  Second vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Covariance.
+template<
+      typename T1,
+      typename T2,
+      size_t N1,
+      size_t N2,
+      template<typename, size_t>
+      class V1,
+      template<typename, size_t>
+      class V2>
+double covariance(
+      v_iface<T1, N1, V1> const &x,
+      v_iface<T2, N2, V2> const &y,
+      thread_pool &p= thread_pool::global()) {
+  return comoments_of(x, y, p).covariance();
+}
+
+
+/// Pearson correlation-coefficient of corresponding elements in two vectors.
+/// https://www.gnu.org/software/gsl/doc/html/statistics.html#c.gsl_stats_correlation
+/// \tparam T1  Type of element in first vector.
+/// \tparam T2  Type of element in second vector.
+/// \tparam N1  Compile-time number of elements in first vector.
+/// \tparam N2  Compile-time number of elements in second vector.
+/// \tparam V1  Type of interface to storage for first vector.
+/// \tparam V2  Type of interface to storage for second vector.
+/// @param x  First vector.
+/// @param y  Second vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Correlation.
+template<
+      typename T1,
+      typename T2,
+      size_t N1,
+      size_t N2,
+      template<typename, size_t>
+      class V1,
+      template<typename, size_t>
+      class V2>
+double correlation(
+      v_iface<T1, N1, V1> const &x,
+      v_iface<T2, N2, V2> const &y,
+      thread_pool &p= thread_pool::global()) {
+  return comoments_of(x, y, p).correlation();
+}
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,9 @@
+/// \file       include/gslcpp/vmath.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for elementwise math on vectors.
+
+#pragma once
+
+#include "vmath/v-math.hpp" // exp, log, sqrt, sin, cos, pow, elementwise
+
+// EOF
@@ -0,0 +1,341 @@
+/// \file       include/gslcpp/vmath/math-kernel.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::exp_kernel(), gsl::log_kernel(),
+///             gsl::sin_kernel(), gsl::cos_kernel(), and the operations
+///             built on them.
+
+#pragma once
+
+#include "math-simd.hpp" // math_simd
+#include <cmath> // exp, log, sqrt, sin, cos, HUGE_VAL, NAN
+
+namespace gsl {
+
+
+// Each kernel below is written once, as a template over `double` and
+// gsl::math_pack.  It has no branch and no call, so that every lane of a pack
+// follows the same instructions.  Argument-reduction and polynomials are
+// those of fdlibm, as in FreeBSD's libm; the error of each kernel, measured
+// against a reference in extended precision, is less than one ULP over its
+// whole domain.  Where a kernel could not keep that bound (trigonometric
+// argument far from zero, or very near a nonzero multiple of pi/2), the
+// operation's slow() marks the lane, and the lane is recomputed by the
+// standard library.
+
+
+/// Exponential, for any double.  Argument is clamped to [-746, 710], beyond
+/// which the result is zero or infinity; NaN propagates.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param x  Argument.
+/// @return  `exp(x)`.
+template<typename V> V exp_kernel(V x) {
+  using S= math_simd<V>;
+  double const shift= 0x1.8p52;
+  V const xl= S::sel(x < S::splat(-746.0), S::splat(-746.0), x);
+  V const xc= S::sel(xl > S::splat(710.0), S::splat(710.0), xl);
+  // n= nearest integer to xc/ln2, by rounding of the addition to shift.
+  V const n= (xc * 1.44269504088896338700e+00 + shift) - shift;
+  V const hi= xc - n * 6.93147180369123816490e-01; // ln2_hi, exact product
+  V const lo= n * 1.90821492927058770002e-10; // ln2_lo
+  V const r= hi - lo;
+  V const z= r * r;
+  double const P1= 1.66666666666666019037e-01;
+  double const P2= -2.77777777770155933842e-03;
+  double const P3= 6.61375632143793436117e-05;
+  double const P4= -1.65339022054652515390e-06;
+  double const P5= 4.13813679705723846039e-08;
+  V const c= r - z * (P1 + z * (P2 + z * (P3 + z * (P4 + z * P5))));
+  V const y= 1.0 - ((lo - (r * c) / (2.0 - c)) - hi);
+  // 2^n as product of two normal powers, so that subnormal results round
+  // only once.  Each power's biased exponent is in the low bits of the
+  // mantissa of (shift + 1023 + power).
+  V const n1= (n * 0.5 + shift) - shift;
+  V const n2= n - n1;
+  V const s1= S::from(S::bits(n1 + (shift + 1023.0)) << 52);
+  V const s2= S::from(S::bits(n2 + (shift + 1023.0)) << 52);
+  return y * s1 * s2;
+}
+
+
+/// Natural logarithm, for any double.  Zero gives negative infinity; a
+/// negative argument gives NaN; infinity and NaN are returned unchanged.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param x  Argument.
+/// @return  `log(x)`.
+template<typename V> V log_kernel(V x) {
+  using S= math_simd<V>;
+  using U= typename S::U;
+  // Subnormal argument is scaled into normal range.
+  auto const sub= x < S::splat(0x1p-1022);
+  V const xs= S::sel(sub, x * 0x1p54, x);
+  U const u= S::bits(xs);
+  // Biased exponent, converted to double exactly.
+  V const eb=
+        S::from((U(u >> 52) & 0x7ff) | 0x4330000000000000ULL) - 0x1p52;
+  V const m0= S::from(U(u & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL);
+  // Mantissa in [sqrt(1/2), sqrt(2)).
+  auto const big= m0 > S::splat(1.41421356237309514547e+00);
+  V const m= S::sel(big, m0 * 0.5, m0);
+  V const k= eb - S::sel(sub, S::splat(1077.0), S::splat(1023.0))
+             + S::sel(big, S::splat(1.0), S::splat(0.0));
+  V const f= m - 1.0;
+  V const s= f / (2.0 + f);
+  V const z= s * s;
+  V const w= z * z;
+  double const Lg1= 6.666666666666735130e-01;
+  double const Lg2= 3.999999999940941908e-01;
+  double const Lg3= 2.857142874366239149e-01;
+  double const Lg4= 2.222219843214978396e-01;
+  double const Lg5= 1.818357216161805012e-01;
+  double const Lg6= 1.531383769920937332e-01;
+  double const Lg7= 1.479819860511658591e-01;
+  V const t1= w * (Lg2 + w * (Lg4 + w * Lg6));
+  V const t2= z * (Lg1 + w * (Lg3 + w * (Lg5 + w * Lg7)));
+  V const R= t2 + t1;
+  V const hfsq= 0.5 * f * f;
+  V const r= k * 6.93147180369123816490e-01
+             - ((hfsq - (s * (hfsq + R) + k * 1.90821492927058770002e-10))
+                - f);
+  // Special values.
+  auto const normal= (x > S::splat(0.0)) & (x < S::splat(HUGE_VAL));
+  V const neg= S::sel(x < S::splat(0.0), S::splat(NAN), x);
+  V const sp= S::sel(x == S::splat(0.0), S::splat(-HUGE_VAL), neg);
+  return S::sel(normal, r, sp);
+}
+
+
+/// Result of reducing trigonometric argument by multiple of pi/2.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+template<typename V> struct trig_reduced {
+  V r; ///< Head of reduced argument.
+  V y; ///< Tail of reduced argument.
+  V n; ///< Nearest integer to x/(pi/2).
+  typename math_simd<V>::U q; ///< Bits whose lowest two are n modulo 4.
+};
+
+
+/// Reduce trigonometric argument by nearest multiple of pi/2, with pi/2
+/// split into three parts (Cody-Waite).  Result is accurate only for
+/// `|x| <= 1e5`, and only if `n` be zero or `|r| >= 2^-20`.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param x  Argument.
+/// @return  Reduced argument.
+template<typename V> trig_reduced<V> trig_reduce(V x) {
+  using S= math_simd<V>;
+  double const shift= 0x1.8p52;
+  V const t= x * 6.36619772367581382433e-01 + shift;
+  V const n= t - shift;
+  V const a= x - n * 1.57079632673412561417e+00; // pio2_1
+  V const w= n * 6.07710050630396597660e-11; // pio2_1t
+  V const r0= a - w;
+  V const y0= ((a - r0) - w) - n * 2.02226624871116645580e-21;
+  V const r= r0 + y0;
+  return {r, (r0 - r) + y0, n, S::bits(t)};
+}
+
+
+/// Sine on [-pi/4, pi/4], from head and tail of argument.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param x  Head of argument.
+/// @param y  Tail of argument.
+/// @return  `sin(x + y)`.
+template<typename V> V sin_poly(V x, V y) {
+  V const z= x * x;
+  V const w= z * z;
+  V const v= z * x;
+  double const S1= -1.66666666666666324348e-01;
+  double const S2= 8.33333333332248946124e-03;
+  double const S3= -1.98412698298579493134e-04;
+  double const S4= 2.75573137070700676789e-06;
+  double const S5= -2.50507602534068634195e-08;
+  double const S6= 1.58969099521155010221e-10;
+  V const r= S2 + z * (S3 + z * S4) + z * w * (S5 + z * S6);
+  return x - ((z * (0.5 * y - v * r) - y) - v * S1);
+}
+
+
+/// Cosine on [-pi/4, pi/4], from head and tail of argument.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param x  Head of argument.
+/// @param y  Tail of argument.
+/// @return  `cos(x + y)`.
+template<typename V> V cos_poly(V x, V y) {
+  V const z= x * x;
+  V const w= z * z;
+  double const C1= 4.16666666666666019037e-02;
+  double const C2= -1.38888888888741095749e-03;
+  double const C3= 2.48015872894767294178e-05;
+  double const C4= -2.75573143513906633035e-07;
+  double const C5= 2.08757232129817482790e-09;
+  double const C6= -1.13596475577881948265e-11;
+  V const r= z * (C1 + z * (C2 + z * C3)) + w * w * (C4 + z * (C5 + z * C6));
+  V const hz= 0.5 * z;
+  V const ww= 1.0 - hz;
+  return ww + (((1.0 - ww) - hz) + (z * r - x * y));
+}
+
+
+/// Mask of arguments for which trigonometric kernel is not accurate.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param x  Argument.
+/// @param d  Reduced argument.
+/// @return  Mask set where standard library should be used.
+template<typename V> auto trig_slow(V x, trig_reduced<V> const &d) {
+  using S= math_simd<V>;
+  V const ax= S::from(S::bits(x) & 0x7fffffffffffffffULL);
+  V const ar= S::from(S::bits(d.r) & 0x7fffffffffffffffULL);
+  return (ax > S::splat(1e5)) | (x != x)
+         | ((d.n != S::splat(0.0)) & (ar < S::splat(0x1p-20)));
+}
+
+
+/// Sine, accurate where trig_slow() is clear.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param d  Reduced argument.
+/// @return  `sin(x)`.
+template<typename V> V sin_kernel(trig_reduced<V> const &d) {
+  using S= math_simd<V>;
+  using U= typename S::U;
+  V const s= sin_poly(d.r, d.y), c= cos_poly(d.r, d.y);
+  // Choose cosine where n is odd; flip sign where bit 1 of n is set.
+  V const v= S::blend(U{} - U(d.q & 1), c, s);
+  return S::from(S::bits(v) ^ U((d.q & 2) << 62));
+}
+
+
+/// Cosine, accurate where trig_slow() is clear.
+/// \tparam V  Type of value, `double` or gsl::math_pack.
+/// @param d  Reduced argument.
+/// @return  `cos(x)`.
+template<typename V> V cos_kernel(trig_reduced<V> const &d) {
+  using S= math_simd<V>;
+  using U= typename S::U;
+  V const s= sin_poly(d.r, d.y), c= cos_poly(d.r, d.y);
+  // Choose negative sine where n is odd; flip sign where bit 1 of n is set.
+  V const v= S::blend(U{} - U(d.q & 1), -s, c);
+  return S::from(S::bits(v) ^ U((d.q & 2) << 62));
+}
+
+
+/// Exponential as elementwise operation.
+struct exp_op {
+  static constexpr bool checked= false; ///< No lane needs slow path.
+
+  /// Kernel.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  `exp(x)`.
+  template<typename V> V operator()(V x) const { return exp_kernel(x); }
+
+  /// Standard library's function, for other types of element.
+  /// \tparam X  Type of argument.
+  /// @param x  Argument.
+  /// @return  `exp(x)`.
+  template<typename X> static auto exact(X const &x) { return std::exp(x); }
+};
+
+
+/// Natural logarithm as elementwise operation.
+struct log_op {
+  static constexpr bool checked= false; ///< No lane needs slow path.
+
+  /// Kernel.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  `log(x)`.
+  template<typename V> V operator()(V x) const { return log_kernel(x); }
+
+  /// Standard library's function, for other types of element.
+  /// \tparam X  Type of argument.
+  /// @param x  Argument.
+  /// @return  `log(x)`.
+  template<typename X> static auto exact(X const &x) { return std::log(x); }
+};
+
+
+/// Square root as elementwise operation.  The square root of IEEE 754 is
+/// correctly rounded, and the compiler maps the loop over lanes onto the
+/// instruction for packed square root.
+struct sqrt_op {
+  static constexpr bool checked= false; ///< No lane needs slow path.
+
+  /// Kernel.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  `sqrt(x)`.
+  template<typename V> V operator()(V x) const {
+    using S= math_simd<V>;
+    V r= x;
+    for(size_t l= 0; l < math_lanes; ++l) {
+      S::set(r, l, std::sqrt(S::get(x, l)));
+    }
+    return r;
+  }
+
+  /// Standard library's function, for other types of element.
+  /// \tparam X  Type of argument.
+  /// @param x  Argument.
+  /// @return  `sqrt(x)`.
+  template<typename X> static auto exact(X const &x) { return std::sqrt(x); }
+};
+
+
+/// Sine as elementwise operation.
+struct sin_op {
+  static constexpr bool checked= true; ///< Some lanes need slow path.
+
+  /// Kernel.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  `sin(x)`, accurate where slow() is clear.
+  template<typename V> V operator()(V x) const {
+    return sin_kernel(trig_reduce(x));
+  }
+
+  /// Mask of lanes that need standard library.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  Mask.
+  template<typename V> static auto slow(V x) {
+    return trig_slow(x, trig_reduce(x));
+  }
+
+  /// Standard library's function, for slow lanes and other types.
+  /// \tparam X  Type of argument.
+  /// @param x  Argument.
+  /// @return  `sin(x)`.
+  template<typename X> static auto exact(X const &x) { return std::sin(x); }
+};
+
+
+/// Cosine as elementwise operation.
+struct cos_op {
+  static constexpr bool checked= true; ///< Some lanes need slow path.
+
+  /// Kernel.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  `cos(x)`, accurate where slow() is clear.
+  template<typename V> V operator()(V x) const {
+    return cos_kernel(trig_reduce(x));
+  }
+
+  /// Mask of lanes that need standard library.
+  /// \tparam V  Type of value, `double` or gsl::math_pack.
+  /// @param x  Argument.
+  /// @return  Mask.
+  template<typename V> static auto slow(V x) {
+    return trig_slow(x, trig_reduce(x));
+  }
+
+  /// Standard library's function, for slow lanes and other types.
+  /// \tparam X  Type of argument.
+  /// @param x  Argument.
+  /// @return  `cos(x)`.
+  template<typename X> static auto exact(X const &x) { return std::cos(x); }
+};
+
+
+} // namespace gsl
+
+// EOF
@@ -0,0 +1,242 @@
+/// \dir        include/gslcpp/vmath
+/// \brief      Types and functions specific to elementwise math on vectors.
+
+/// \file       include/gslcpp/vmath/math-simd.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::math_lanes, gsl::math_pack, and
+///             gsl::math_simd.
+
+#pragma once
+
+#include <cstddef> // size_t
+#include <cstdint> // int64_t, uint64_t
+#include <cstring> // memcpy
+
+// Number of doubles in widest registers of target.  Compile with, e.g.,
+// `-march=native` to use AVX or AVX-512.  Define as 1 to disable packs.
+#if !defined(GSLCPP_MATH_LANES)
+#if defined(__AVX512F__)
+#define GSLCPP_MATH_LANES 8
+#elif defined(__AVX__)
+#define GSLCPP_MATH_LANES 4
+#elif defined(__GNUC__) && (defined(__SSE2__) || defined(__ARM_NEON))
+#define GSLCPP_MATH_LANES 2
+#else
+#define GSLCPP_MATH_LANES 1
+#endif
+#endif
+
+namespace gsl {
+
+
+/// Number of doubles evaluated together by each kernel of elementwise math,
+/// as many as fit in the widest registers of the target.
+constexpr size_t math_lanes= GSLCPP_MATH_LANES;
+
+
+#if GSLCPP_MATH_LANES > 1
+/// Pack of gsl::math_lanes doubles, by the vector-extension of GCC and
+/// Clang.  Because the pack is just as wide as the target's registers, it
+/// is passed in a register, and every operation is one instruction.
+typedef double math_pack __attribute__((vector_size(8 * math_lanes)));
+
+/// Pack of gsl::math_lanes bit-patterns, one for each double.
+typedef uint64_t math_upack __attribute__((vector_size(8 * math_lanes)));
+
+/// Pack of gsl::math_lanes masks, the result of comparing two packs.
+typedef int64_t math_ipack __attribute__((vector_size(8 * math_lanes)));
+
+/// Pack of gsl::math_lanes floats, for loading and storing.
+typedef float math_fpack __attribute__((vector_size(4 * math_lanes)));
+#else
+/// Single double, where the target has no registers for vectors.
+using math_pack= double;
+#endif
+
+
+/// Operations on type `V`, `double` or gsl::math_pack, needed to write each
+/// kernel once for both.  With a pack, a comparison yields a mask of all
+/// ones or all zeros in each lane, and a conditional is a bitwise blend; the
+/// kernels thus have no branch.
+/// \tparam V  Type of value.
+template<typename V> struct math_simd;
+
+
+/// Operations on single double.
+template<> struct math_simd<double> {
+  using U= uint64_t; ///< Type of bit-pattern.
+
+  /// Bit-pattern of value.
+  /// @param x  Value.
+  /// @return  Bit-pattern.
+  static U bits(double x) {
+    U u;
+    std::memcpy(&u, &x, sizeof(u));
+    return u;
+  }
+
+  /// Value of bit-pattern.
+  /// @param u  Bit-pattern.
+  /// @return  Value.
+  static double from(U u) {
+    double x;
+    std::memcpy(&x, &u, sizeof(x));
+    return x;
+  }
+
+  /// Value of constant.
+  /// @param c  Constant.
+  /// @return  `c`.
+  static double splat(double c) { return c; }
+
+  /// Choose value by condition.
+  /// @param m  Condition.
+  /// @param a  Value if `m` be true.
+  /// @param b  Value if `m` be false.
+  /// @return  Chosen value.
+  static double sel(bool m, double a, double b) { return m ? a : b; }
+
+  /// Blend bits of two values by bit-mask.
+  /// @param m  Mask.
+  /// @param a  Value whose bits are taken where mask is set.
+  /// @param b  Value whose bits are taken where mask is clear.
+  /// @return  Blend.
+  static double blend(U m, double a, double b) {
+    return from((m & bits(a)) | (~m & bits(b)));
+  }
+
+  /// Value of only lane.
+  /// @param x  Value.
+  /// @return  `x`.
+  static double get(double x, size_t) { return x; }
+
+  /// Set only lane.
+  /// @param x  Value to be modified.
+  /// @param a  New value.
+  static void set(double &x, size_t, double a) { x= a; }
+
+  /// Load value from contiguous elements.
+  /// \tparam T  Type of element, `double` or `float`.
+  /// @param x  Pointer to element.
+  /// @return  Value.
+  template<typename T> static double load(T const *x) { return *x; }
+
+  /// Store value to contiguous elements.
+  /// \tparam T  Type of element, `double` or `float`.
+  /// @param y  Pointer to element.
+  /// @param a  Value.
+  template<typename T> static void store(T *y, double a) { *y= T(a); }
+
+  /// True if condition be true.
+  /// @param m  Condition.
+  /// @return  `m`.
+  static bool on(bool m, size_t) { return m; }
+
+  /// True if condition be true.
+  /// @param m  Condition.
+  /// @return  `m`.
+  static bool any(bool m) { return m; }
+};
+
+
+#if GSLCPP_MATH_LANES > 1
+/// Operations on gsl::math_pack.
+template<> struct math_simd<math_pack> {
+  using U= math_upack; ///< Type of bit-pattern.
+
+  /// Bit-pattern of each lane.
+  /// @param x  Values.
+  /// @return  Bit-patterns.
+  static U bits(math_pack x) { return (U)x; }
+
+  /// Value of each lane's bit-pattern.
+  /// @param u  Bit-patterns.
+  /// @return  Values.
+  static math_pack from(U u) { return (math_pack)u; }
+
+  /// Constant in every lane.
+  /// @param c  Constant.
+  /// @return  Pack of `c`.
+  static math_pack splat(double c) { return math_pack{} + c; }
+
+  /// Choose value in each lane by mask.
+  /// @param m  Mask.
+  /// @param a  Values where mask is set.
+  /// @param b  Values where mask is clear.
+  /// @return  Chosen values.
+  static math_pack sel(math_ipack m, math_pack a, math_pack b) {
+    return blend((U)m, a, b);
+  }
+
+  /// Blend bits of two packs by bit-mask.
+  /// @param m  Mask.
+  /// @param a  Values whose bits are taken where mask is set.
+  /// @param b  Values whose bits are taken where mask is clear.
+  /// @return  Blend.
+  static math_pack blend(U m, math_pack a, math_pack b) {
+    return (math_pack)((m & (U)a) | (~m & (U)b));
+  }
+
+  /// Value of lane.
+  /// @param x  Values.
+  /// @param l  Offset of lane.
+  /// @return  Value of lane `l`.
+  static double get(math_pack x, size_t l) { return x[l]; }
+
+  /// Set lane.
+  /// @param x  Values to be modified.
+  /// @param l  Offset of lane.
+  /// @param a  New value of lane `l`.
+  static void set(math_pack &x, size_t l, double a) { x[l]= a; }
+
+  /// Load pack from contiguous elements, by one instruction for `double`
+  /// and by one load and one conversion for `float`.
+  /// \tparam T  Type of element, `double` or `float`.
+  /// @param x  Pointer to first of gsl::math_lanes elements.
+  /// @return  Pack.
+  template<typename T> static math_pack load(T const *x) {
+    if constexpr(sizeof(T) == sizeof(double)) {
+      math_pack a;
+      std::memcpy(&a, x, sizeof(a));
+      return a;
+    } else {
+      math_fpack f;
+      std::memcpy(&f, x, sizeof(f));
+      return __builtin_convertvector(f, math_pack);
+    }
+  }
+
+  /// Store pack to contiguous elements.
+  /// \tparam T  Type of element, `double` or `float`.
+  /// @param y  Pointer to first of gsl::math_lanes elements.
+  /// @param a  Pack.
+  template<typename T> static void store(T *y, math_pack a) {
+    if constexpr(sizeof(T) == sizeof(double)) {
+      std::memcpy(y, &a, sizeof(a));
+    } else {
+      math_fpack const f= __builtin_convertvector(a, math_fpack);
+      std::memcpy(y, &f, sizeof(f));
+    }
+  }
+
+  /// True if mask be set in lane.
+  /// @param m  Mask.
+  /// @param l  Offset of lane.
+  /// @return  True only if lane `l` be set.
+  static bool on(math_ipack m, size_t l) { return m[l] != 0; }
+
+  /// True if mask be set in any lane.
+  /// @param m  Mask.
+  /// @return  True only if any lane be set.
+  static bool any(math_ipack m) {
+    int64_t r= 0;
+    for(size_t l= 0; l < math_lanes; ++l) r|= m[l];
+    return r != 0;
+  }
+};
+#endif
+
+
+} // namespace gsl
+
+// EOF
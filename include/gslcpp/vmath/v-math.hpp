@@ -0,0 +1,521 @@
+/// \file       include/gslcpp/vmath/v-math.hpp
+/// \copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// \brief      Definitions for gsl::exp(), gsl::log(), gsl::sqrt(),
+///             gsl::sin(), gsl::cos(), gsl::pow(), and gsl::elementwise()
+///             on vectors.
+
+#pragma once
+
+#include "../par/thread-pool.hpp" // thread_pool
+#include "../vector.hpp" // vector
+#include "math-kernel.hpp" // exp_op, log_op, sqrt_op, sin_op, cos_op
+#include <cmath> // pow
+#include <stdexcept> // invalid_argument
+#include <type_traits> // is_same, remove_const_t
+
+namespace gsl {
+
+
+/// Number of elements in each chunk of parallel elementwise math.  The grain
+/// is a multiple of gsl::math_lanes, so that every result is the same for any
+/// number of threads.
+constexpr size_t math_grain= size_t(1) << 14;
+
+
+/// Evaluate operation on gsl::math_pack.  Lanes that the kernel cannot
+/// evaluate accurately are recomputed by the standard library.
+/// \tparam O  Type of operation.
+/// @param x  Arguments.
+/// @param op  Operation.
+/// @return  Results.
+template<typename O> math_pack math_block(math_pack x, O const &op) {
+  using S= math_simd<math_pack>;
+  math_pack y= op(x);
+  if constexpr(O::checked) {
+    auto const m= O::slow(x);
+    if(S::any(m)) {
+      for(size_t l= 0; l < math_lanes; ++l) {
+        if(S::on(m, l)) S::set(y, l, O::exact(S::get(x, l)));
+      }
+    }
+  }
+  return y;
+}
+
+
+/// Apply operation to range of elements.  Elements of type `double` or
+/// `float` are loaded into gsl::math_pack, gsl::math_lanes at a time, and
+/// evaluated by the operation's kernel, through `double`.  Contiguous
+/// elements are loaded and stored whole packs at a time.  Any
+/// other type of element, such as `long double` or gsl::complex, is
+/// evaluated by the standard library.
+/// \tparam O  Type of operation.
+/// \tparam T  Type of source element.
+/// \tparam U  Type of destination element.
+/// @param x  Pointer to first element of source.
+/// @param sx  Stride of source.
+/// @param y  Pointer to first element of destination.
+/// @param sy  Stride of destination.
+/// @param b  Offset of first element in range.
+/// @param e  Offset past last element in range.
+/// @param op  Operation.
+template<typename O, typename T, typename U>
+void math_range(
+      T const *x,
+      size_t sx,
+      U *y,
+      size_t sy,
+      size_t b,
+      size_t e,
+      O const &op) {
+  using R= std::remove_const_t<T>;
+  using S= math_simd<math_pack>;
+  if constexpr(std::is_same<R, double>::value
+               || std::is_same<R, float>::value) {
+    math_pack a= S::splat(1.0);
+    size_t i= b;
+    if constexpr(std::is_same<R, U>::value) {
+      if(sx == 1 && sy == 1) {
+        for(; i + math_lanes <= e; i+= math_lanes) {
+          S::store(y + i, math_block(S::load(x + i), op));
+        }
+      }
+    }
+    for(; i + math_lanes <= e; i+= math_lanes) {
+      for(size_t l= 0; l < math_lanes; ++l) S::set(a, l, x[(i + l) * sx]);
+      math_pack const r= math_block(a, op);
+      for(size_t l= 0; l < math_lanes; ++l) y[(i + l) * sy]= U(S::get(r, l));
+    }
+    if(i == e) return;
+    // Unused lanes of last pack are set to one, for which every kernel is
+    // defined.
+    size_t const m= e - i;
+    for(size_t l= 0; l < math_lanes; ++l) {
+      S::set(a, l, l < m ? double(x[(i + l) * sx]) : 1.0);
+    }
+    math_pack const r= math_block(a, op);
+    for(size_t l= 0; l < m; ++l) y[(i + l) * sy]= U(S::get(r, l));
+  } else {
+    for(size_t i= b; i < e; ++i) y[i * sy]= U(O::exact(x[i * sx]));
+  }
+}
+
+
+/// Function of one argument as elementwise operation, evaluated by scalar
+/// call for every type of element.
+/// \tparam F  Type of function.
+template<typename F> struct scalar_op {
+  F f; ///< Function.
+
+  /// Call function.
+  /// \tparam X  Type of argument.
+  /// @param x  Argument.
+  /// @return  `f(x)`.
+  template<typename X> auto exact(X const &x) const { return f(x); }
+};
+
+
+/// Apply scalar operation to range of elements.
+/// \tparam F  Type of function.
+/// \tparam T  Type of source element.
+/// \tparam U  Type of destination element.
+/// @param x  Pointer to first element of source.
+/// @param sx  Stride of source.
+/// @param y  Pointer to first element of destination.
+/// @param sy  Stride of destination.
+/// @param b  Offset of first element in range.
+/// @param e  Offset past last element in range.
+/// @param op  Operation.
+template<typename F, typename T, typename U>
+void math_range(
+      T const *x,
+      size_t sx,
+      U *y,
+      size_t sy,
+      size_t b,
+      size_t e,
+      scalar_op<F> const &op) {
+  for(size_t i= b; i < e; ++i) y[i * sy]= U(op.exact(x[i * sx]));
+}
+
+
+/// Apply operation to every element of source, writing destination.
+/// Chunks of gsl::math_grain elements are processed in parallel.
+/// \tparam O  Type of operation.
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param op  Operation.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename O,
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void math_each(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      O const &op,
+      thread_pool &p) {
+  size_t const n= src.size(), sx= src.v()->stride, sy= dst.v()->stride;
+  if(dst.size() != n) throw std::invalid_argument("mismatch in size");
+  T const *const x= src.data();
+  U *const y= dst.data();
+  if(n <= math_grain || p.size() == 1) {
+    return math_range(x, sx, y, sy, 0, n, op);
+  }
+  p.for_chunks(n, math_grain, [&](size_t b, size_t e, unsigned) {
+    math_range(x, sx, y, sy, b, e, op);
+  });
+}
+
+
+/// Exponential of each element.
+///
+/// For `double` and `float`, the error is less than one ULP; `float` is
+/// computed through `double`.  For other types, including gsl::complex,
+/// `std::exp` is called.  `src` and `dst` may be the same vector.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void exp(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  math_each(src, dst, exp_op(), p);
+}
+
+
+/// Exponential of each element, as new vector.
+/// \tparam T  Type of element.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param src  Source vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of results.
+template<typename T, size_t N, template<typename, size_t> class V>
+vector<std::remove_const_t<T>>
+exp(v_iface<T, N, V> const &src, thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(src.size());
+  math_each(src, r, exp_op(), p);
+  return r;
+}
+
+
+/// Natural logarithm of each element.
+///
+/// For `double` and `float`, the error is less than one ULP; `float` is
+/// computed through `double`.  For other types, including gsl::complex,
+/// `std::log` is called.  `src` and `dst` may be the same vector.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void log(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  math_each(src, dst, log_op(), p);
+}
+
+
+/// Natural logarithm of each element, as new vector.
+/// \tparam T  Type of element.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param src  Source vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of results.
+template<typename T, size_t N, template<typename, size_t> class V>
+vector<std::remove_const_t<T>>
+log(v_iface<T, N, V> const &src, thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(src.size());
+  math_each(src, r, log_op(), p);
+  return r;
+}
+
+
+/// Square root of each element.
+///
+/// For `double` and `float`, the result is correctly rounded.  For other
+/// types, including gsl::complex, `std::sqrt` is called.  `src` and `dst`
+/// may be the same vector.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void sqrt(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  math_each(src, dst, sqrt_op(), p);
+}
+
+
+/// Square root of each element, as new vector.
+/// \tparam T  Type of element.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param src  Source vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of results.
+template<typename T, size_t N, template<typename, size_t> class V>
+vector<std::remove_const_t<T>>
+sqrt(v_iface<T, N, V> const &src, thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(src.size());
+  math_each(src, r, sqrt_op(), p);
+  return r;
+}
+
+
+/// Sine of each element.
+///
+/// For `double` and `float`, the error is less than one ULP.  Elements
+/// larger than 1e5 in magnitude, and those very near a nonzero multiple of
+/// pi/2, are passed to `std::sin`, as are elements of other types, including
+/// gsl::complex.  `src` and `dst` may be the same vector.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void sin(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  math_each(src, dst, sin_op(), p);
+}
+
+
+/// Sine of each element, as new vector.
+/// \tparam T  Type of element.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param src  Source vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of results.
+template<typename T, size_t N, template<typename, size_t> class V>
+vector<std::remove_const_t<T>>
+sin(v_iface<T, N, V> const &src, thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(src.size());
+  math_each(src, r, sin_op(), p);
+  return r;
+}
+
+
+/// Cosine of each element.
+///
+/// For `double` and `float`, the error is less than one ULP.  Elements
+/// larger than 1e5 in magnitude, and those very near an odd multiple of
+/// pi/2, are passed to `std::cos`, as are elements of other types, including
+/// gsl::complex.  `src` and `dst` may be the same vector.
+///
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W>
+void cos(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  math_each(src, dst, cos_op(), p);
+}
+
+
+/// Cosine of each element, as new vector.
+/// \tparam T  Type of element.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// @param src  Source vector.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of results.
+template<typename T, size_t N, template<typename, size_t> class V>
+vector<std::remove_const_t<T>>
+cos(v_iface<T, N, V> const &src, thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(src.size());
+  math_each(src, r, cos_op(), p);
+  return r;
+}
+
+
+/// Apply function of one argument to each element.  This is the way to
+/// evaluate a special function of GSL, like `gsl_sf_bessel_J0`, over a
+/// vector; the function is called once for each element, but chunks of
+/// gsl::math_grain elements are processed in parallel.  `src` and `dst` may
+/// be the same vector.
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// \tparam F  Type of function, callable as `f(x)` from any thread.
+/// @param src  Source vector.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param f  Function.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W,
+      typename F>
+void elementwise(
+      v_iface<T, N, V> const &src,
+      v_iface<U, M, W> &dst,
+      F const &f,
+      thread_pool &p= thread_pool::global()) {
+  math_each(src, dst, scalar_op<F>{f}, p);
+}
+
+
+/// Raise each element to power.  There is no vector kernel for `pow`;
+/// `std::pow` is called for each element, and chunks of gsl::math_grain
+/// elements are processed in parallel.  `src` and `dst` may be the same
+/// vector.
+/// \tparam T  Type of source element.
+/// \tparam N  Compile-time number of source elements.
+/// \tparam V  Type of interface to storage of source.
+/// \tparam U  Type of destination element.
+/// \tparam M  Compile-time number of destination elements.
+/// \tparam W  Type of interface to storage of destination.
+/// \tparam E  Type of exponent.
+/// @param src  Source vector.
+/// @param e  Exponent.
+/// @param dst  Destination vector, with as many elements as `src`.
+/// @param p  Pool over which to distribute chunks.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename U,
+      size_t M,
+      template<typename, size_t>
+      class W,
+      typename E>
+void pow(
+      v_iface<T, N, V> const &src,
+      E const &e,
+      v_iface<U, M, W> &dst,
+      thread_pool &p= thread_pool::global()) {
+  gsl::elementwise(src, dst, [e](auto const &x) { return std::pow(x, e); }, p);
+}
+
+
+/// Each element raised to power, as new vector.
+/// \tparam T  Type of element.
+/// \tparam N  Compile-time number of elements.
+/// \tparam V  Type of interface to storage.
+/// \tparam E  Type of exponent.
+/// @param src  Source vector.
+/// @param e  Exponent.
+/// @param p  Pool over which to distribute chunks.
+/// @return  Vector of results.
+template<
+      typename T,
+      size_t N,
+      template<typename, size_t>
+      class V,
+      typename E>
+vector<std::remove_const_t<T>> pow(
+      v_iface<T, N, V> const &src,
+      E const &e,
+      thread_pool &p= thread_pool::global()) {
+  vector<std::remove_const_t<T>> r(src.size());
+  gsl::pow(src, e, r, p);
+  return r;
+}
+
+
+} // namespace gsl
+
+// EOF
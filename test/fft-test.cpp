@@ -0,0 +1,109 @@
+/// @file       test/fft-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for fast Fourier transforms.
+
+#include "gslcpp/fft.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // abs, cos, sin
+
+using gsl::complex;
+using gsl::fft_backward;
+using gsl::fft_forward;
+using gsl::fft_forward_batch;
+using gsl::fft_halfcomplex_inverse;
+using gsl::fft_halfcomplex_inverse_batch;
+using gsl::fft_inverse;
+using gsl::fft_real;
+using gsl::fft_real_batch;
+using gsl::halfcomplex_unpack;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+/// Discrete Fourier transform by definition.
+/// @param x  Input.
+/// @param k  Offset of output.
+/// @return  Output at offset `k`.
+template<typename X> std::complex<double> dft(X const &x, size_t k) {
+  size_t const n= x.size();
+  double const pi= 3.14159265358979323846;
+  std::complex<double> s= 0.0;
+  for(size_t j= 0; j < n; ++j) {
+    double const a= -2.0 * pi * double((j * k) % n) / double(n);
+    s+= std::complex<double>(x[j]) * std::complex<double>(cos(a), sin(a));
+  }
+  return s;
+}
+
+
+TEST_CASE("Complex FFT on strided view matches DFT.", "[fft]") {
+  size_t const n= 12;
+  vector<complex<double>> z(2 * n);
+  for(size_t i= 0; i < 2 * n; ++i) z[i]= complex<double>(i % 5, 0.5 * i);
+  auto s= z.subvector(n, 1, 2);
+  std::vector<std::complex<double>> x(n);
+  for(size_t i= 0; i < n; ++i) x[i]= s[i];
+  REQUIRE(fft_forward(s) == GSL_SUCCESS);
+  bool ok= true;
+  for(size_t k= 0; k < n; ++k) ok&= (std::abs(s[k] - dft(x, k)) < 1e-10);
+  REQUIRE(ok);
+  REQUIRE(z[0] == complex<double>(0.0, 0.0)); // Untouched.
+  REQUIRE(fft_inverse(s) == GSL_SUCCESS);
+  for(size_t i= 0; i < n; ++i) ok&= (std::abs(s[i] - x[i]) < 1e-12);
+  REQUIRE(ok);
+  REQUIRE(fft_forward(s) == GSL_SUCCESS);
+  REQUIRE(fft_backward(s) == GSL_SUCCESS);
+  for(size_t i= 0; i < n; ++i) ok&= (std::abs(s[i] - x[i] * double(n)) < 1e-9);
+  REQUIRE(ok);
+}
+
+
+TEST_CASE("Real FFT matches DFT and unpacks.", "[fft]") {
+  for(size_t n: {7, 8}) {
+    vector<double> v(n);
+    for(size_t i= 0; i < n; ++i) v[i]= 1.0 + i * i % 3;
+    std::vector<double> x(n);
+    for(size_t i= 0; i < n; ++i) x[i]= v[i];
+    REQUIRE(fft_real(v) == GSL_SUCCESS);
+    vector<complex<double>> z(n);
+    halfcomplex_unpack(v, z);
+    bool ok= true;
+    for(size_t k= 0; k < n; ++k) ok&= (std::abs(z[k] - dft(x, k)) < 1e-10);
+    REQUIRE(ok);
+    REQUIRE(fft_halfcomplex_inverse(v) == GSL_SUCCESS);
+    for(size_t i= 0; i < n; ++i) ok&= (std::abs(v[i] - x[i]) < 1e-12);
+    REQUIRE(ok);
+  }
+}
+
+
+TEST_CASE("Batched FFT matches FFT of each segment.", "[fft]") {
+  size_t const n= 10, m= 37;
+  thread_pool p(3);
+  vector<complex<float>> z(n * m), ref(n * m);
+  vector<double> r(n * m), rref(n * m);
+  for(size_t i= 0; i < n * m; ++i) {
+    z[i]= ref[i]= complex<float>(float(i % 11), float(i % 7));
+    r[i]= rref[i]= double(i % 13);
+  }
+  REQUIRE(fft_forward_batch(z, n, p) == GSL_SUCCESS);
+  REQUIRE(fft_real_batch(r, n, p) == GSL_SUCCESS);
+  for(size_t j= 0; j < m; ++j) {
+    auto s= ref.subvector(n, j * n);
+    auto t= rref.subvector(n, j * n);
+    fft_forward(s);
+    fft_real(t);
+  }
+  bool ok= true;
+  for(size_t i= 0; i < n * m; ++i) ok&= (z[i] == ref[i] && r[i] == rref[i]);
+  REQUIRE(ok);
+  REQUIRE(fft_halfcomplex_inverse_batch(r, n, p) == GSL_SUCCESS);
+  for(size_t i= 0; i < n * m; ++i) {
+    ok&= (std::abs(r[i] - double(i % 13)) < 1e-12);
+  }
+  REQUIRE(ok);
+  REQUIRE_THROWS_AS(fft_forward_batch(z, 7, p), std::invalid_argument);
+}
+
+// EOF
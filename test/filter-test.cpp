@@ -0,0 +1,130 @@
+/// @file       test/filter-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for digital filters.
+
+#include "gslcpp/filter.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <random> // mt19937_64, normal_distribution
+
+using gsl::filter_stream;
+using gsl::gaussian_filter;
+using gsl::impulse_filter;
+using gsl::median_filter;
+using gsl::rmedian_filter;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+/// Random input with occasional spikes.
+/// @param n  Number of samples.
+/// @param seed  Seed for generator.
+/// @return  Input.
+static vector<double> noisy(size_t n, unsigned seed) {
+  std::mt19937_64 g(seed);
+  std::normal_distribution<double> d;
+  vector<double> x(n);
+  for(size_t i= 0; i < n; ++i) x[i]= d(g) + (i % 97 == 0 ? 20.0 : 0.0);
+  return x;
+}
+
+
+TEST_CASE("Blocked filter matches single call to GSL.", "[filter]") {
+  size_t const n= 150001; // More than two blocks.
+  auto const x= noisy(n, 3);
+  thread_pool p(3);
+  vector<double> y(n), ref(n);
+  for(auto e: {GSL_FILTER_END_PADZERO, GSL_FILTER_END_TRUNCATE}) {
+    median_filter m(7, e, p);
+    REQUIRE(m.h() == 3);
+    REQUIRE(m.k() == 7);
+    REQUIRE(m(x, y) == GSL_SUCCESS);
+    gsl_filter_median_workspace *w= gsl_filter_median_alloc(7);
+    gsl_filter_median(e, x.v(), ref.v(), w);
+    gsl_filter_median_free(w);
+    bool ok= true;
+    for(size_t i= 0; i < n; ++i) ok&= (y[i] == ref[i]);
+    REQUIRE(ok);
+
+    gaussian_filter g(9, 2.5, 0, e, p);
+    REQUIRE(g(x, y) == GSL_SUCCESS);
+    gsl_filter_gaussian_workspace *wg= gsl_filter_gaussian_alloc(9);
+    gsl_filter_gaussian(e, 2.5, 0, x.v(), ref.v(), wg);
+    gsl_filter_gaussian_free(wg);
+    for(size_t i= 0; i < n; ++i) ok&= (y[i] == ref[i]);
+    REQUIRE(ok);
+  }
+}
+
+
+TEST_CASE("Impulse filter counts outliers across blocks.", "[filter]") {
+  size_t const n= 140000;
+  auto const x= noisy(n, 5);
+  thread_pool p(4);
+  impulse_filter f(11, 5.0, GSL_FILTER_SCALE_MAD, GSL_FILTER_END_PADVALUE, p);
+  vector<double> y(n), m(n), s(n), ry(n), rm(n), rs(n);
+  vector<int> o(n), ro(n);
+  size_t c= 0, rc= 0;
+  REQUIRE(f(x, y, m, s, c, o) == GSL_SUCCESS);
+  gsl_filter_impulse_workspace *w= gsl_filter_impulse_alloc(11);
+  gsl_filter_impulse(
+        GSL_FILTER_END_PADVALUE, GSL_FILTER_SCALE_MAD, 5.0, x.v(), ry.v(),
+        rm.v(), rs.v(), &rc, ro.v(), w);
+  gsl_filter_impulse_free(w);
+  REQUIRE(c == rc);
+  REQUIRE(c >= n / 97);
+  bool ok= true;
+  for(size_t i= 0; i < n; ++i) {
+    ok&= (y[i] == ry[i] && m[i] == rm[i] && s[i] == rs[i] && o[i] == ro[i]);
+  }
+  REQUIRE(ok);
+}
+
+
+TEST_CASE("Recursive median filter accepts strided views.", "[filter]") {
+  size_t const n= 1000;
+  auto const x= noisy(2 * n, 7);
+  vector<double> y(2 * n), ref(n), xc(n);
+  for(size_t i= 0; i < n; ++i) xc[i]= x[2 * i];
+  auto const xs= x.subvector(n, 0, 2);
+  auto ys= y.subvector(n, 1, 2);
+  rmedian_filter f(5);
+  REQUIRE(f(xs, ys) == GSL_SUCCESS);
+  REQUIRE(f(xc, ref) == GSL_SUCCESS);
+  bool ok= true;
+  for(size_t i= 0; i < n; ++i) ok&= (ys[i] == ref[i]);
+  REQUIRE(ok);
+}
+
+
+TEST_CASE("Streaming filter matches filter on whole input.", "[filter]") {
+  size_t const n= 5000;
+  auto const x= noisy(n, 11);
+  thread_pool p(2);
+  for(auto e: {GSL_FILTER_END_PADVALUE, GSL_FILTER_END_TRUNCATE}) {
+    median_filter f(9, e, p);
+    vector<double> ref(n);
+    f(x, ref);
+    filter_stream<median_filter> s(f);
+    std::vector<double> out;
+    vector<double> y(n);
+    size_t const sizes[]= {1, 3, 250, 7, 1000, 2};
+    size_t b= 0;
+    for(size_t i= 0; b < n; ++i) {
+      size_t const m= std::min(n - b, sizes[i % 6]);
+      size_t const k= s.push(x.subvector(m, b), y);
+      REQUIRE(k <= m);
+      for(size_t j= 0; j < k; ++j) out.push_back(y[j]);
+      b+= m;
+    }
+    REQUIRE(s.pending() == 4);
+    size_t const k= s.finish(y);
+    for(size_t j= 0; j < k; ++j) out.push_back(y[j]);
+    REQUIRE(out.size() == n);
+    bool ok= true;
+    for(size_t i= 0; i < n; ++i) ok&= (out[i] == ref[i]);
+    REQUIRE(ok);
+  }
+}
+
+// EOF
@@ -0,0 +1,95 @@
+/// @file       test/histogram-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for histograms.
+
+#include "gslcpp/histogram.hpp"
+#include "gslcpp/rng.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // nan, nextafter
+
+using gsl::bin_index;
+using gsl::hist_grain;
+using gsl::histogram;
+using gsl::histogram2d;
+using gsl::ran_fill;
+using gsl::ran_gaussian;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+TEST_CASE("Lookup of bin agrees with ranges.", "[histogram]") {
+  double const u[]= {0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 0.8, 0.9, 1.0};
+  double const r[]= {-1.0, 0.0, 0.5, 3.0, 3.25, 10.0};
+  bin_index bu(u, 10), br(r, 5);
+  REQUIRE(bu.uniform());
+  REQUIRE(!br.uniform());
+  for(size_t i= 0; i < 10; ++i) {
+    REQUIRE(bu(u[i]) == i);
+    REQUIRE(bu(std::nextafter(u[i + 1], 0.0)) == i);
+  }
+  for(size_t i= 0; i < 5; ++i) {
+    REQUIRE(br(r[i]) == i);
+    REQUIRE(br(std::nextafter(r[i + 1], -2.0)) == i);
+  }
+  REQUIRE(bu(1.0) == 10);
+  REQUIRE(bu(-0.1) == 10);
+  REQUIRE(br(std::nan("")) == 5);
+}
+
+
+TEST_CASE("Histogram of vector matches GSL's increment.", "[histogram]") {
+  size_t const n= 3 * hist_grain + 11;
+  vector<double> x(n);
+  ran_fill(x, ran_gaussian{2.0}, 5);
+  thread_pool p(4), q(1);
+  histogram a(40, -5.0, 5.0), b(40, -5.0, 5.0);
+  a.increment(x, p);
+  b.increment(x, q);
+  gsl_histogram *const g= gsl_histogram_alloc(40);
+  gsl_histogram_set_ranges_uniform(g, -5.0, 5.0);
+  for(size_t i= 0; i < n; ++i) gsl_histogram_increment(g, x[i]);
+  bool same= true;
+  for(size_t i= 0; i < a.size(); ++i) {
+    same&= (a[i] == g->bin[i] && b[i] == g->bin[i]);
+  }
+  gsl_histogram_free(g);
+  REQUIRE(same);
+  vector<double> r({-1.0, 0.0, 0.5, 3.0});
+  histogram c(r);
+  REQUIRE(c.size() == 3);
+  REQUIRE(!c.uniform());
+  vector<double> w(n);
+  for(size_t i= 0; i < n; ++i) w[i]= 0.5;
+  c.accumulate(x, w, p);
+  c.increment(0.25);
+  REQUIRE(c.accumulate(10.0, 1.0) == false);
+  double t= 0.0;
+  for(size_t i= 0; i < n; ++i) t+= (x[i] >= 0.0 && x[i] < 0.5 ? 0.5 : 0.0);
+  REQUIRE(c[1] == Approx(t + 1.0));
+}
+
+
+TEST_CASE("Two-dimensional histogram counts pairs.", "[histogram]") {
+  size_t const n= 2 * hist_grain + 5;
+  vector<double> x(n), y(n);
+  ran_fill(x, ran_gaussian{}, 1);
+  ran_fill(y, ran_gaussian{}, 2);
+  thread_pool p(4);
+  histogram2d h(8, -2.0, 2.0, 4, -1.0, 1.0);
+  h.increment(x, y, p);
+  double total= 0.0;
+  for(size_t i= 0; i < h.nx(); ++i) {
+    for(size_t j= 0; j < h.ny(); ++j) total+= h(i, j);
+  }
+  size_t in= 0;
+  for(size_t i= 0; i < n; ++i) {
+    in+= (x[i] >= -2.0 && x[i] < 2.0 && y[i] >= -1.0 && y[i] < 1.0);
+  }
+  REQUIRE(total == double(in));
+  REQUIRE(h.increment(0.1, 0.1));
+  REQUIRE(!h.increment(0.1, 3.0));
+  REQUIRE(h(4, 2) > 0.0);
+}
+
+// EOF
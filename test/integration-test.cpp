@@ -0,0 +1,132 @@
+/// @file       test/integration-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for numerical integration.
+
+#include "gslcpp/integration.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // exp, log, sqrt
+
+using gsl::acquire;
+using gsl::cquad;
+using gsl::fixed_quad;
+using gsl::qag;
+using gsl::qagi;
+using gsl::qagiu;
+using gsl::qags;
+using gsl::qng;
+using gsl::thread_pool;
+using gsl::vector;
+using std::exp;
+using std::log;
+using std::sqrt;
+
+
+TEST_CASE("qng and qag integrate polynomial.", "[integration]") {
+  auto const f= [](double x) { return 3.0 * x * x; };
+  auto const r1= qng(f, 0.0, 2.0, 0.0, 1.0E-10);
+  REQUIRE(r1.status == GSL_SUCCESS);
+  REQUIRE(r1.value == Approx(8.0));
+  REQUIRE(r1.neval > 0);
+  auto const r2= qag(f, 0.0, 2.0, 0.0, 1.0E-10, GSL_INTEG_GAUSS61);
+  REQUIRE(r2.status == GSL_SUCCESS);
+  REQUIRE(r2.value == Approx(8.0));
+  REQUIRE(r2.abserr >= 0.0);
+}
+
+
+TEST_CASE("qags integrates singular integrand.", "[integration]") {
+  // Example from GSL's documentation.
+  double alpha= 1.0;
+  auto const f= [&alpha](double x) { return log(alpha * x) / sqrt(x); };
+  auto const r= qags(f, 0.0, 1.0, 0.0, 1.0E-7);
+  REQUIRE(r.status == GSL_SUCCESS);
+  REQUIRE(r.value == Approx(-4.0).epsilon(1.0E-6));
+}
+
+
+TEST_CASE("qagi and qagiu integrate over infinite range.", "[integration]") {
+  auto const g= [](double x) { return exp(-x * x); };
+  auto const r1= qagi(g, 0.0, 1.0E-8);
+  REQUIRE(r1.value == Approx(sqrt(M_PI)).epsilon(1.0E-6));
+  auto const r2= qagiu(g, 0.0, 0.0, 1.0E-8);
+  REQUIRE(r2.value == Approx(0.5 * sqrt(M_PI)).epsilon(1.0E-6));
+}
+
+
+TEST_CASE("cquad integrates smooth integrand.", "[integration]") {
+  auto const r= cquad([](double x) { return exp(x); }, 0.0, 1.0, 0.0, 1.0E-10);
+  REQUIRE(r.status == GSL_SUCCESS);
+  REQUIRE(r.value == Approx(exp(1.0) - 1.0));
+  REQUIRE(r.neval > 0);
+}
+
+
+TEST_CASE("Nested integration leases distinct workspaces.", "[integration]") {
+  // Integral over unit square of x*y is 1/4.
+  auto const inner= [](double x) {
+    return qag([x](double y) { return x * y; }, 0.0, 1.0, 0.0, 1.0E-10).value;
+  };
+  auto const r= qag(inner, 0.0, 1.0, 0.0, 1.0E-10);
+  REQUIRE(r.value == Approx(0.25));
+}
+
+
+TEST_CASE("workspace_pool reuses workspace.", "[integration]") {
+  gsl_integration_workspace *p1;
+  {
+    auto const w= acquire<gsl_integration_workspace>(500);
+    p1= w.get();
+    REQUIRE(p1->limit >= 500);
+  }
+  {
+    auto const w= acquire<gsl_integration_workspace>(100);
+    REQUIRE(w.get() == p1);
+    auto const v= acquire<gsl_integration_workspace>(100);
+    REQUIRE(v.get() != p1);
+  }
+}
+
+
+TEST_CASE("fixed_quad integrates single integrand.", "[integration]") {
+  fixed_quad const q(8, 0.0, 2.0);
+  REQUIRE(q.size() == 8);
+  REQUIRE(q.nodes().size() == 8);
+  double sw= 0.0;
+  for(size_t i= 0; i < q.size(); ++i) sw+= q.weights()[i];
+  REQUIRE(sw == Approx(2.0));
+  // Eight-point Gauss-Legendre is exact for polynomial of degree 15.
+  REQUIRE(q([](double x) { return 3.0 * x * x; }) == Approx(8.0));
+}
+
+
+TEST_CASE("fixed_quad integrates over many parameters.", "[integration]") {
+  fixed_quad const q(16, 0.0, 1.0);
+  size_t const n= 1000;
+  vector<double> p(n), r(n), e(n);
+  for(size_t i= 0; i < n; ++i) p[i]= 0.01 * (i + 1);
+  auto const f= [](double x, double a) { return exp(a * x); };
+  thread_pool pool(4);
+  q(f, p, r, e, pool);
+  bool ok= true;
+  for(size_t i= 0; i < n; ++i) {
+    double const a= p[i];
+    double const x= (exp(a) - 1.0) / a;
+    if(std::abs(r[i] - x) > 1.0E-12 * x) ok= false;
+    if(!(e[i] >= 0.0 && e[i] < 1.0E-6 * x)) ok= false;
+  }
+  REQUIRE(ok);
+  // Without error, on strided view, result is identical.
+  vector<double> r2(n / 2);
+  q(f, p.subvector(n / 2, 0, 2), r2, pool);
+  for(size_t i= 0; i < n / 2; ++i) REQUIRE(r2[i] == r[2 * i]);
+  vector<double> bad(n - 1);
+  REQUIRE_THROWS(q(f, p, bad, pool));
+  // Single node has no rule of lower order for estimate of error.
+  fixed_quad const q1(1, 0.0, 1.0);
+  q1(f, p, r, pool);
+  REQUIRE(r[0] == Approx(exp(0.005)));
+  REQUIRE_THROWS_AS(q1(f, p, r, e, pool), std::invalid_argument);
+}
+
+// EOF
@@ -0,0 +1,63 @@
+/// @file       test/interp-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for interpolation.
+
+#include "gslcpp/interpolation.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // isnan, sin
+
+using gsl::interp;
+using gsl::interp_grain;
+using gsl::interp_locate;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+TEST_CASE("Located interval contains query.", "[interp]") {
+  double const x[]= {0.0, 1.0, 1.5, 4.0, 4.5, 7.0, 9.0, 9.5};
+  size_t const n= 8;
+  for(size_t h= 0; h < n - 1; ++h) {
+    for(double q= 0.0; q <= 9.5; q+= 0.25) {
+      size_t const i= interp_locate(x, n, q, h);
+      REQUIRE(i < n - 1);
+      REQUIRE(x[i] <= q);
+      REQUIRE((q < x[i + 1] || q == 9.5));
+    }
+  }
+}
+
+
+TEST_CASE("Batch evaluation matches single evaluation.", "[interp]") {
+  size_t const m= 50, n= 3 * interp_grain + 9;
+  vector<double> x(m), y(m), q(n), a(n), b(n);
+  for(size_t i= 0; i < m; ++i) {
+    x[i]= i + 0.01 * i * i;
+    y[i]= std::sin(0.1 * x[i]);
+  }
+  double const hi= x[m - 1];
+  for(size_t k= 0; k < n; ++k) q[k]= hi * k / (n - 1);
+  q[7]= -1.0;
+  q[n / 2]= 2.0 * hi;
+  thread_pool p(4);
+  for(auto const *t: {gsl_interp_linear, gsl_interp_cspline}) {
+    interp s(x, y, t);
+    REQUIRE(s.size() == m);
+    REQUIRE(s.eval(q, a, p) == 2);
+    REQUIRE(s.deriv(q, b, p) == 2);
+    bool same= true;
+    for(size_t k= 0; k < n; ++k) {
+      if(k == 7 || k == n / 2) continue;
+      same&= (a[k] == s.eval(q[k]));
+      same&= (b[k] == s.deriv(q[k]));
+    }
+    REQUIRE(same);
+    REQUIRE(std::isnan(a[7]));
+    REQUIRE(std::isnan(b[n / 2]));
+  }
+  auto const xs= x.subvector(m / 2, 0, 2), ys= y.subvector(m / 2, 0, 2);
+  interp c(xs, ys, gsl_interp_linear);
+  REQUIRE(c.eval(x[2]) == Approx(y[2]));
+}
+
+// EOF
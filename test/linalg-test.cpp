@@ -0,0 +1,142 @@
+/// @file       test/linalg-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for linear algebra.
+
+#include "gslcpp/linalg.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // abs, isfinite, sqrt
+
+using gsl::cholesky;
+using gsl::lu;
+using gsl::qr;
+using gsl::small_grain;
+using gsl::small_systems;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+namespace {
+
+
+/// Symmetric, positive-definite matrix, stored by rows.
+double const spd[]= {4.0, 1.0, 0.5, 1.0, 3.0, 0.2, 0.5, 0.2, 2.0};
+
+
+/// Product of matrix and vector.
+/// @param a  Matrix, stored by rows.
+/// @param x  Vector.
+/// @param i  Offset of element of product.
+/// @return  Element `i` of product.
+double product(double const *a, vector<double> const &x, size_t i) {
+  return a[3 * i] * x[0] + a[3 * i + 1] * x[1] + a[3 * i + 2] * x[2];
+}
+
+
+} // namespace
+
+
+TEST_CASE("LU and Cholesky solve same system.", "[linalg]") {
+  auto const a= gsl_matrix_const_view_array(spd, 3, 3);
+  vector<double> b({1.0, 2.0, 3.0}), x(3), y(3);
+  lu d(3);
+  cholesky c(3);
+  REQUIRE(d.factor(&a.matrix) == 0);
+  REQUIRE(c.factor(&a.matrix) == 0);
+  REQUIRE(d.solve(b, x) == 0);
+  REQUIRE(c.solve(b, y) == 0);
+  for(size_t i= 0; i < 3; ++i) {
+    REQUIRE(product(spd, x, i) == Approx(b[i]));
+    REQUIRE(y[i] == Approx(x[i]));
+  }
+  REQUIRE(d.det() == Approx(4.0 * 5.96 - 1.0 * 1.9 + 0.5 * -1.3));
+  REQUIRE(c.lndet() == Approx(d.lndet()));
+  REQUIRE(d.sgndet() == 1);
+  x= b;
+  REQUIRE(d.svx(x) == 0);
+  REQUIRE(x[2] == Approx(y[2]));
+  lu e(4);
+  REQUIRE_THROWS(e.factor(&a.matrix));
+}
+
+
+TEST_CASE("Columns of right-hand side are solved in parallel.", "[linalg]") {
+  auto const a= gsl_matrix_const_view_array(spd, 3, 3);
+  size_t const k= 17;
+  double bd[3 * k], xd[3 * k], yd[3 * k];
+  for(size_t i= 0; i < 3 * k; ++i) bd[i]= double(i % 7) - 2.0;
+  auto const b= gsl_matrix_const_view_array(bd, 3, k);
+  auto x= gsl_matrix_view_array(xd, 3, k);
+  auto y= gsl_matrix_view_array(yd, 3, k);
+  thread_pool p(4);
+  lu d(3);
+  cholesky c(3);
+  d.factor(&a.matrix);
+  c.factor(&a.matrix);
+  REQUIRE(d.solve(&b.matrix, &x.matrix, p) == 0);
+  REQUIRE(c.solve(&b.matrix, &y.matrix, p) == 0);
+  for(size_t i= 0; i < 3 * k; ++i) REQUIRE(xd[i] == Approx(yd[i]));
+}
+
+
+TEST_CASE("QR solves least-squares problem.", "[linalg]") {
+  // Fit line through (0, 1), (1, 3), (2, 5), (3, 8); best fit is
+  // 0.8 + 2.3 t, with residuals 0.2, -0.1, -0.4, 0.3.
+  double const ad[]= {1.0, 0.0, 1.0, 1.0, 1.0, 2.0, 1.0, 3.0};
+  auto const a= gsl_matrix_const_view_array(ad, 4, 2);
+  vector<double> b({1.0, 3.0, 5.0, 8.0}), x(2);
+  qr d(4, 2);
+  REQUIRE(d.factor(&a.matrix) == 0);
+  REQUIRE(d.lssolve(b, x) == 0);
+  REQUIRE(x[0] == Approx(0.8));
+  REQUIRE(x[1] == Approx(2.3));
+  REQUIRE(d.residual_norm() == Approx(std::sqrt(0.3)));
+  double bd[]= {1.0, 0.0, 3.0, 1.0, 5.0, 2.0, 8.0, 3.0}, xd[4];
+  auto const bm= gsl_matrix_const_view_array(bd, 4, 2);
+  auto xm= gsl_matrix_view_array(xd, 2, 2);
+  REQUIRE(d.lssolve(&bm.matrix, &xm.matrix) == 0);
+  REQUIRE(xd[0] == Approx(0.8));
+  REQUIRE(xd[2] == Approx(2.3));
+  REQUIRE(xd[1] == Approx(0.0).margin(1e-12));
+  REQUIRE(xd[3] == Approx(1.0));
+  vector<double> y(4);
+  REQUIRE_THROWS(d.lssolve(b, y));
+  REQUIRE_THROWS(qr(2, 3));
+}
+
+
+TEST_CASE("Batched small systems are solved.", "[linalg]") {
+  size_t const n= 2 * small_grain + 5;
+  small_systems<4> c(n), d(n);
+  for(size_t s= 0; s < n; ++s) {
+    for(size_t i= 0; i < 4; ++i) {
+      for(size_t j= 0; j < 4; ++j) {
+        double const v= (i == j ? 5.0 + double(s % 3) : 1.0 / (1 + i + j));
+        c.a(s, i, j)= d.a(s, i, j)= v;
+      }
+      c.b(s, i)= d.b(s, i)= double(i) - double(s % 5);
+    }
+  }
+  d.a(3, 0, 0)= -1.0;
+  for(size_t j= 0; j < 4; ++j) c.a(n - 1, 2, j)= 0.0;
+  thread_pool p(4);
+  small_systems<4> const e= c;
+  REQUIRE(c.lu_solve(p) == 1);
+  REQUIRE(d.cholesky_solve(p) == 1);
+  REQUIRE(!std::isfinite(c.b(n - 1, 0)));
+  bool ok= true;
+  for(size_t s= 0; s + 1 < n; ++s) {
+    for(size_t i= 0; i < 4; ++i) {
+      double r= 0.0;
+      for(size_t j= 0; j < 4; ++j) r+= e.a(s, i, j) * c.b(s, j);
+      ok&= (std::abs(r - e.b(s, i)) < 1e-12);
+      if(s != 3) ok&= (std::abs(c.b(s, i) - d.b(s, i)) < 1e-12);
+    }
+  }
+  REQUIRE(ok);
+  auto const x= c.rhs(7);
+  REQUIRE(x.size() == 4);
+  REQUIRE(x[2] == c.b(7, 2));
+}
+
+// EOF
@@ -0,0 +1,71 @@
+/// @file       test/monte-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for Monte Carlo integration.
+
+#include "gslcpp/monte.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+
+using gsl::monte_grain;
+using gsl::monte_plain;
+using gsl::monte_vegas;
+using gsl::point_view;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+namespace {
+
+
+/// Integrand whose integral over unit square is 1/4.
+/// @param x  Point.
+/// @return  Product of coordinates.
+double product(point_view const &x) { return x[0] * x[1]; }
+
+
+} // namespace
+
+
+TEST_CASE("Plain integration is independent of threads.", "[monte]") {
+  thread_pool p(4), q(1);
+  vector<double> lo({0.0, 0.0}), hi({1.0, 1.0});
+  monte_plain a(2, gsl_rng_mt19937, p), b(2, gsl_rng_mt19937, q);
+  size_t const calls= 5 * monte_grain + 3;
+  auto const ra= a.integrate(product, lo, hi, calls, 7);
+  auto const rb= b.integrate(product, lo, hi, calls, 7);
+  REQUIRE(ra.status == 0);
+  REQUIRE(ra.neval == calls);
+  REQUIRE(ra.value == rb.value);
+  REQUIRE(ra.abserr == rb.abserr);
+  REQUIRE(ra.value == Approx(0.25).margin(5.0 * ra.abserr));
+  auto const rc= a.integrate(product, lo, hi, calls, 8);
+  REQUIRE(rc.value != ra.value);
+  vector<double> bad(3);
+  REQUIRE_THROWS(a.integrate(product, lo, bad, calls, 7));
+}
+
+
+TEST_CASE("VEGAS replicas are independent of threads.", "[monte]") {
+  thread_pool p(4), q(1);
+  vector<double> lo({0.0, 0.0}), hi({1.0, 1.0});
+  monte_vegas a(2, 6, 11, gsl_rng_mt19937, p);
+  monte_vegas b(2, 6, 11, gsl_rng_mt19937, q);
+  REQUIRE(a.replicas() == 6);
+  auto const ra= a.integrate(product, lo, hi, 60000);
+  auto const rb= b.integrate(product, lo, hi, 60000);
+  REQUIRE(ra.status == 0);
+  REQUIRE(ra.value == rb.value);
+  REQUIRE(ra.abserr == rb.abserr);
+  REQUIRE(ra.value == Approx(0.25).margin(5.0 * ra.abserr + 1e-3));
+  auto v= a.params();
+  v.stage= 1;
+  a.set_params(v);
+  REQUIRE(a.params().stage == 1);
+  v.stage= 0;
+  a.set_params(v);
+  a.init(11);
+  auto const rc= a.integrate(product, lo, hi, 60000);
+  REQUIRE(rc.value == ra.value);
+}
+
+// EOF
@@ -0,0 +1,148 @@
+/// @file       test/movstat-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for moving-window statistics.
+
+#include "gslcpp/movstat.hpp"
+#include "gslcpp/vector.hpp"
+#include <algorithm> // max_element, min_element, sort
+#include <catch.hpp>
+#include <random> // mt19937_64, normal_distribution
+
+using gsl::movstat;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+/// Reference-values computed by brute force over each window.
+struct brute {
+  std::vector<double> mean, sum, min, max, median;
+
+  brute(std::vector<double> const &x,
+        size_t h,
+        size_t j,
+        gsl_movstat_end_t e) {
+    ptrdiff_t const n= x.size();
+    for(ptrdiff_t i= 0; i < n; ++i) {
+      std::vector<double> w;
+      for(ptrdiff_t k= i - ptrdiff_t(h); k <= i + ptrdiff_t(j); ++k) {
+        if(k >= 0 && k < n) {
+          w.push_back(x[k]);
+        } else if(e == GSL_MOVSTAT_END_PADZERO) {
+          w.push_back(0.0);
+        } else if(e == GSL_MOVSTAT_END_PADVALUE) {
+          w.push_back(k < 0 ? x[0] : x[n - 1]);
+        }
+      }
+      double s= 0.0;
+      for(double v: w) s+= v;
+      sum.push_back(s);
+      mean.push_back(s / w.size());
+      min.push_back(*std::min_element(w.begin(), w.end()));
+      max.push_back(*std::max_element(w.begin(), w.end()));
+      std::sort(w.begin(), w.end());
+      size_t const m= w.size();
+      median.push_back(
+            m % 2 ? w[m / 2] : 0.5 * (w[m / 2 - 1] + w[m / 2]));
+    }
+  }
+};
+
+
+TEST_CASE("Native kernels match brute force at every end.", "[movstat]") {
+  size_t const n= 1001;
+  std::mt19937_64 g(7);
+  std::normal_distribution<double> d;
+  std::vector<double> x(n);
+  for(auto &v: x) v= d(g);
+  // Include ties, which stress the deque and the heaps.
+  for(size_t i= 0; i < n; i+= 10) x[i]= 0.5;
+  vector<double> xv(n);
+  for(size_t i= 0; i < n; ++i) xv[i]= x[i];
+  vector<double> y(n), z(n);
+  gsl_movstat_end_t const ends[]= {
+        GSL_MOVSTAT_END_PADZERO,
+        GSL_MOVSTAT_END_PADVALUE,
+        GSL_MOVSTAT_END_TRUNCATE};
+  size_t const hj[][2]= {{0, 0}, {3, 3}, {2, 5}, {6, 1}, {4, 0}};
+  for(auto e: ends) {
+    for(auto const &w: hj) {
+      brute const b(x, w[0], w[1], e);
+      movstat m(w[0], w[1], e);
+      bool ok= true;
+      m.mean(xv, y);
+      for(size_t i= 0; i < n; ++i) ok&= (y[i] == Approx(b.mean[i]));
+      m.sum(xv, y);
+      for(size_t i= 0; i < n; ++i) ok&= (y[i] == Approx(b.sum[i]));
+      m.minmax(xv, y, z);
+      for(size_t i= 0; i < n; ++i) ok&= (y[i] == b.min[i]);
+      for(size_t i= 0; i < n; ++i) ok&= (z[i] == b.max[i]);
+      m.median(xv, y);
+      for(size_t i= 0; i < n; ++i) ok&= (y[i] == b.median[i]);
+      REQUIRE(ok);
+    }
+  }
+}
+
+
+TEST_CASE("Result of movstat is independent of threads.", "[movstat]") {
+  size_t const n= 200003; // More than one chunk.
+  std::mt19937_64 g(11);
+  std::normal_distribution<double> d;
+  vector<double> x(2 * n);
+  for(size_t i= 0; i < 2 * n; ++i) x[i]= d(g);
+  auto const s= x.subvector(n, 1, 2); // Strided input.
+  std::vector<double> ref(n);
+  for(size_t i= 0; i < n; ++i) ref[i]= s[i];
+  brute const b(ref, 5, 5, GSL_MOVSTAT_END_PADVALUE);
+  thread_pool p(4), q(1);
+  movstat mp(11, GSL_MOVSTAT_END_PADVALUE, p);
+  movstat mq(11, GSL_MOVSTAT_END_PADVALUE, q);
+  REQUIRE(mp.h() == 5);
+  REQUIRE(mp.j() == 5);
+  vector<double> yp(n), yq(n);
+  mp.median(s, yp);
+  mq.median(s, yq);
+  bool ok= true;
+  for(size_t i= 0; i < n; ++i) ok&= (yp[i] == yq[i] && yp[i] == b.median[i]);
+  REQUIRE(ok);
+  mp.max(s, yp);
+  for(size_t i= 0; i < n; ++i) ok&= (yp[i] == b.max[i]);
+  REQUIRE(ok);
+}
+
+
+TEST_CASE("Chunked GSL call matches call on whole vector.", "[movstat]") {
+  size_t const n= 150001; // More than one chunk.
+  std::mt19937_64 g(13);
+  std::normal_distribution<double> d;
+  vector<double> x(n);
+  for(size_t i= 0; i < n; ++i) x[i]= d(g);
+  thread_pool p(3);
+  gsl_movstat_workspace *w= gsl_movstat_alloc2(4, 2);
+  vector<double> y(n), ref(n), y2(n), ref2(n);
+  for(auto e: {GSL_MOVSTAT_END_PADZERO, GSL_MOVSTAT_END_TRUNCATE}) {
+    movstat m(4, 2, e, p);
+    REQUIRE(m.variance(x, y) == GSL_SUCCESS);
+    gsl_movstat_variance(e, x.v(), ref.v(), w);
+    bool ok= true;
+    for(size_t i= 0; i < n; ++i) ok&= (y[i] == Approx(ref[i]));
+    REQUIRE(m.mad(x, y, y2) == GSL_SUCCESS);
+    gsl_movstat_mad(e, x.v(), ref.v(), ref2.v(), w);
+    for(size_t i= 0; i < n; ++i) ok&= (y[i] == ref[i] && y2[i] == ref2[i]);
+    REQUIRE(m.qqr(x, 0.25, y) == GSL_SUCCESS);
+    gsl_movstat_qqr(e, x.v(), 0.25, ref.v(), w);
+    for(size_t i= 0; i < n; ++i) ok&= (y[i] == ref[i]);
+    REQUIRE(ok);
+  }
+  gsl_movstat_free(w);
+}
+
+
+TEST_CASE("Mismatch in size throws.", "[movstat]") {
+  vector<double> x(5), y(4);
+  movstat m(3);
+  REQUIRE_THROWS_AS(m.mean(x, y), std::invalid_argument);
+  REQUIRE_THROWS_AS(m.sd(x, y), std::invalid_argument);
+}
+
+// EOF
@@ -0,0 +1,206 @@
+/// @file       test/multimin-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for gsl::f_minimizer and gsl::fdf_minimizer.
+
+#include "gslcpp/multimin.hpp"
+#include "gslcpp/vector-view.hpp"
+#include <catch.hpp>
+
+using gsl::batch_minimizer;
+using gsl::CENTRAL;
+using gsl::f_minimizer;
+using gsl::fd_gradient;
+using gsl::FORWARD;
+using gsl::fdf_minimizer;
+using gsl::gradient_view;
+using gsl::point_view;
+using gsl::thread_pool;
+using gsl::vector;
+using gsl::vector_view;
+
+
+/// Paraboloid with minimum of 30 at (x0, y0), as in GSL's documentation.
+struct paraboloid {
+  double x0; ///< Location of minimum along first dimension.
+  double y0; ///< Location of minimum along second dimension.
+  int calls= 0; ///< Number of evaluations of f().
+
+  /// Value at `x`.
+  /// @param x  Point at which to evaluate.
+  /// @return  Value at `x`.
+  double f(point_view const &x) {
+    ++calls;
+    double const dx= x[0] - x0, dy= x[1] - y0;
+    return 10.0 * dx * dx + 20.0 * dy * dy + 30.0;
+  }
+
+  /// Gradient at `x`.
+  /// @param x  Point at which to evaluate.
+  /// @param g  On return, gradient at `x`.
+  void df(point_view const &x, gradient_view &g) {
+    g[0]= 20.0 * (x[0] - x0);
+    g[1]= 40.0 * (x[1] - y0);
+  }
+
+  /// Value of paraboloid, for use with f_minimizer.
+  /// @param x  Point at which to evaluate.
+  /// @return  Value at `x`.
+  double operator()(point_view const &x) { return f(x); }
+};
+
+
+TEST_CASE("fdf_minimizer finds minimum of paraboloid.", "[multimin]") {
+  fdf_minimizer m(2);
+  paraboloid p{1.0, 2.0};
+  vector x= {5.0, 7.0};
+  auto const r= m.minimize(p, x, 1.0E-6);
+  REQUIRE(r.status == GSL_SUCCESS);
+  REQUIRE(r.iter > 0);
+  REQUIRE(r.f == Approx(30.0));
+  REQUIRE(x[0] == Approx(1.0));
+  REQUIRE(x[1] == Approx(2.0));
+  REQUIRE(m.x()[0] == x[0]);
+  REQUIRE(m.minimum() == r.f);
+}
+
+
+TEST_CASE("fdf_minimizer is reused across solves.", "[multimin]") {
+  fdf_minimizer m(2, gsl_multimin_fdfminimizer_conjugate_fr);
+  double a[]= {0.0, 0.0, 5.0, 7.0};
+  vector_view x(a + 2, 2); // Result is written through view into a[].
+  for(int i= 0; i < 3; ++i) {
+    paraboloid p{double(i), -double(i)};
+    auto const r= m.minimize(p, x, 1.0E-6);
+    REQUIRE(r.status == GSL_SUCCESS);
+    REQUIRE(a[2] == Approx(double(i)).margin(1.0E-5));
+    REQUIRE(a[3] == Approx(-double(i)).margin(1.0E-5));
+  }
+  REQUIRE(a[0] == 0.0);
+  REQUIRE(a[1] == 0.0);
+}
+
+
+TEST_CASE("fdf_minimizer honors maximum number of iterations.", "[multimin]") {
+  fdf_minimizer m(2, gsl_multimin_fdfminimizer_steepest_descent);
+  paraboloid p{1.0, 2.0};
+  vector x= {5.0, 7.0};
+  auto const r= m.minimize(p, x, 1.0E-12, 1);
+  REQUIRE(r.iter == 1);
+  REQUIRE(r.status == GSL_CONTINUE);
+}
+
+
+TEST_CASE("f_minimizer finds minimum of paraboloid.", "[multimin]") {
+  f_minimizer m(2);
+  paraboloid p{1.0, 2.0};
+  vector x= {5.0, 7.0};
+  auto const r= m.minimize(p, x, 1.0E-4);
+  REQUIRE(r.status == GSL_SUCCESS);
+  REQUIRE(p.calls > 0);
+  REQUIRE(r.f == Approx(30.0));
+  REQUIRE(x[0] == Approx(1.0).margin(1.0E-3));
+  REQUIRE(x[1] == Approx(2.0).margin(1.0E-3));
+}
+
+
+TEST_CASE("f_minimizer works after move.", "[multimin]") {
+  f_minimizer m1(2);
+  f_minimizer m2(std::move(m1));
+  auto lambda= [](point_view const &x) { return x[0] * x[0] + x[1] * x[1]; };
+  vector x= {1.0, -1.0};
+  auto const r= m2.minimize(lambda, x, 1.0E-4);
+  REQUIRE(r.status == GSL_SUCCESS);
+  REQUIRE(r.f == Approx(0.0).margin(1.0E-6));
+  // Move in middle of solve, and iterate moved-to instance to convergence.
+  f_minimizer m3(2);
+  vector y= {1.0, -1.0};
+  REQUIRE(m3.set(lambda, y, 0.5) == GSL_SUCCESS);
+  REQUIRE(m3.iterate() == GSL_SUCCESS);
+  f_minimizer m4(std::move(m3));
+  int status= GSL_CONTINUE;
+  for(int i= 0; i < 1000 && status == GSL_CONTINUE; ++i) {
+    REQUIRE(m4.iterate() == GSL_SUCCESS);
+    status= gsl_multimin_test_size(m4.characteristic_size(), 1.0E-4);
+  }
+  REQUIRE(status == GSL_SUCCESS);
+  REQUIRE(m4.minimum() == Approx(0.0).margin(1.0E-6));
+  REQUIRE(m4.x()[0] == Approx(0.0).margin(1.0E-3));
+  REQUIRE(m4.x()[1] == Approx(0.0).margin(1.0E-3));
+}
+
+
+TEST_CASE("batch_minimizer solves independent problems.", "[multimin]") {
+  thread_pool p(4);
+  batch_minimizer<fdf_minimizer> b(2, p);
+  size_t const n= 100;
+  vector<double> x(2 * n);
+  x.set_all(5.0);
+  auto const make= [](size_t i) { return paraboloid{double(i), -double(i)}; };
+  auto const r= b.minimize(make, x, 1.0E-6, 100);
+  REQUIRE(r.size() == n);
+  for(size_t i= 0; i < n; ++i) {
+    REQUIRE(r[i].status == GSL_SUCCESS);
+    REQUIRE(r[i].iter > 0);
+    REQUIRE(r[i].seconds >= 0.0);
+    REQUIRE(x[2 * i] == Approx(double(i)).margin(1.0E-5));
+    REQUIRE(x[2 * i + 1] == Approx(-double(i)).margin(1.0E-5));
+  }
+}
+
+
+TEST_CASE("batch_minimizer rejects incomplete problem.", "[multimin]") {
+  batch_minimizer<f_minimizer> b(2, gsl_multimin_fminimizer_nmsimplex2);
+  vector x= {1.0, 2.0, 3.0};
+  auto const make= [](size_t) { return paraboloid{0.0, 0.0}; };
+  REQUIRE_THROWS(b.minimize(make, x, 1.0E-4, 100));
+}
+
+
+TEST_CASE("fd_gradient approximates analytic gradient.", "[multimin]") {
+  thread_pool p(3);
+  paraboloid a{1.0, 2.0};
+  // Copy for each call, so that concurrent calls do not share `calls`.
+  auto const f= [a](point_view const &x) { return paraboloid(a).f(x); };
+  vector x= {0.5, -3.0};
+  vector<double> g(2), ga(2);
+  auto const xv= gsl::point(x.v());
+  auto gv= gsl::gradient(g.v());
+  auto gav= gsl::gradient(ga.v());
+  a.df(xv, gav);
+  for(auto s: {CENTRAL, FORWARD}) {
+    fd_gradient d(f, 2, s, p);
+    d.df(xv, gv);
+    REQUIRE(g[0] == Approx(ga[0]).epsilon(1.0E-6));
+    REQUIRE(g[1] == Approx(ga[1]).epsilon(1.0E-6));
+    g.set_zero();
+    REQUIRE(d.fdf(xv, gv) == Approx(a.f(xv)));
+    REQUIRE(g[0] == Approx(ga[0]).epsilon(1.0E-6));
+    REQUIRE(g[1] == Approx(ga[1]).epsilon(1.0E-6));
+  }
+  fd_gradient d(f, 2, CENTRAL, p);
+  REQUIRE(d.size() == 2);
+  vector y= {0.5, -3.0, 1.0};
+  vector<double> h(3);
+  auto const yv= gsl::point(y.v());
+  auto hv= gsl::gradient(h.v());
+  REQUIRE_THROWS_AS(d.df(yv, hv), std::invalid_argument);
+  REQUIRE_THROWS_AS(d.fdf(yv, hv), std::invalid_argument);
+  REQUIRE_THROWS_AS(d.df(xv, hv), std::invalid_argument);
+}
+
+
+TEST_CASE("fdf_minimizer works with fd_gradient.", "[multimin]") {
+  auto const f= [](point_view const &x) {
+    double const dx= x[0] - 3.0, dy= x[1] + 1.0;
+    return dx * dx + 4.0 * dy * dy;
+  };
+  fd_gradient d(f, 2);
+  fdf_minimizer m(2);
+  vector x= {0.0, 0.0};
+  auto const r= m.minimize(d, x, 1.0E-5);
+  REQUIRE(r.status == GSL_SUCCESS);
+  REQUIRE(x[0] == Approx(3.0).margin(1.0E-4));
+  REQUIRE(x[1] == Approx(-1.0).margin(1.0E-4));
+}
+
+// EOF
@@ -0,0 +1,179 @@
+/// @file       test/poly-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for polynomials over vectors.
+
+#include "gslcpp/poly.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // isnan
+#include <gsl/gsl_errno.h> // GSL_EINVAL, GSL_SUCCESS
+#include <gsl/gsl_poly.h> // gsl_poly_eval, etc.
+
+using gsl::batch_poly_solver;
+using gsl::complex;
+using gsl::poly_eval;
+using gsl::poly_eval_derivs;
+using gsl::poly_grain;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+namespace {
+
+
+/// Comparison against GSL's value, which allows for contraction of
+/// multiply-add by compiler.
+/// @param r  Reference-value.
+/// @return  Approximation of `r`.
+Approx near(double r) { return Approx(r).epsilon(1e-13).margin(1e-12); }
+
+
+} // namespace
+
+
+TEST_CASE("Real polynomial is evaluated at every point.", "[poly]") {
+  double const c[]= {1.5, -2.0, 0.25, 3.0, -0.5};
+  vector<double> k({1.5, -2.0, 0.25, 3.0, -0.5});
+  size_t const n= 1003; // not multiple of poly_block
+  vector<double> x(n), y(n);
+  for(size_t i= 0; i < n; ++i) x[i]= 0.004 * double(i) - 2.0;
+  poly_eval(k, x, y);
+  for(size_t i= 0; i < n; ++i) {
+    REQUIRE(y[i] == near(gsl_poly_eval(c, 5, x[i])));
+  }
+  // Points in view with stride, and in place.
+  vector<float> f({0.0f, 1.0f, 2.0f, 3.0f});
+  vector<double> const g= poly_eval(k, f);
+  REQUIRE(g[2] == near(gsl_poly_eval(c, 5, 2.0)));
+  auto u= x.subvector(3, 0, 2);
+  poly_eval(k, u, u);
+  REQUIRE(x[2] == near(gsl_poly_eval(c, 5, 0.008 - 2.0)));
+  REQUIRE(x[3] == 0.004 * 3.0 - 2.0);
+  // Constant polynomial.
+  vector<double> one({7.0});
+  REQUIRE(poly_eval(one, f)[3] == 7.0);
+  vector<double> none(0), z(3);
+  REQUIRE_THROWS_AS(poly_eval(none, f), std::invalid_argument);
+  REQUIRE_THROWS_AS(poly_eval(k, f, z), std::invalid_argument);
+}
+
+
+TEST_CASE("Complex polynomial is evaluated at every point.", "[poly]") {
+  double const c[]= {1.0, -0.5, 2.0};
+  vector<double> k({1.0, -0.5, 2.0});
+  vector<complex<double>> x(100);
+  for(size_t i= 0; i < x.size(); ++i) {
+    x[i]= complex<double>(0.1 * double(i) - 5.0, 0.03 * double(i));
+  }
+  vector<complex<double>> const y= poly_eval(k, x);
+  for(size_t i= 0; i < x.size(); ++i) {
+    gsl_complex const r= gsl_poly_complex_eval(c, 3, x[i]);
+    REQUIRE(y[i].real() == near(GSL_REAL(r)));
+    REQUIRE(y[i].imag() == near(GSL_IMAG(r)));
+  }
+  vector<complex<double>> kz(3);
+  kz[0]= complex<double>(1.0, 2.0);
+  kz[1]= complex<double>(-0.5, 0.0);
+  kz[2]= complex<double>(0.0, 1.0);
+  gsl_complex const kc[]= {kz[0], kz[1], kz[2]};
+  vector<complex<double>> const w= poly_eval(kz, x);
+  for(size_t i= 0; i < x.size(); ++i) {
+    gsl_complex const r= gsl_complex_poly_complex_eval(kc, 3, x[i]);
+    REQUIRE(w[i].real() == near(GSL_REAL(r)));
+    REQUIRE(w[i].imag() == near(GSL_IMAG(r)));
+  }
+  // Complex coefficients at real points.
+  vector<double> t({2.0});
+  vector<complex<double>> const v= poly_eval(kz, t);
+  REQUIRE(v[0].real() == near(0.0));
+  REQUIRE(v[0].imag() == near(6.0));
+}
+
+
+TEST_CASE("Derivatives of polynomial match GSL.", "[poly]") {
+  double const c[]= {1.5, -2.0, 0.25, 3.0, -0.5};
+  vector<double> k({1.5, -2.0, 0.25, 3.0, -0.5});
+  size_t const n= 130;
+  vector<double> x(n);
+  for(size_t i= 0; i < n; ++i) x[i]= 0.03 * double(i) - 2.0;
+  for(size_t m: {1, 3, 5, 7}) {
+    gsl_matrix *d= gsl_matrix_alloc(n, m);
+    poly_eval_derivs(k, x, d);
+    std::vector<double> r(m);
+    for(size_t i= 0; i < n; ++i) {
+      gsl_poly_eval_derivs(c, 5, x[i], r.data(), m);
+      for(size_t j= 0; j < m; ++j) {
+        REQUIRE(*gsl_matrix_ptr(d, i, j) == near(r[j]));
+      }
+    }
+    gsl_matrix_free(d);
+  }
+}
+
+
+TEST_CASE("Polynomial in parallel matches serial.", "[poly]") {
+  thread_pool p(4), q(1);
+  vector<double> k({0.5, 1.0, -1.0, 0.125});
+  size_t const n= 5 * poly_grain + 3;
+  vector<double> x(n), a(n), b(n);
+  for(size_t i= 0; i < n; ++i) x[i]= 1e-4 * double(i) - 3.0;
+  poly_eval(k, x, a, p);
+  poly_eval(k, x, b, q);
+  bool same= true;
+  for(size_t i= 0; i < n; ++i) same= same && a[i] == b[i];
+  REQUIRE(same);
+  gsl_matrix *d= gsl_matrix_alloc(n, 2), *e= gsl_matrix_alloc(n, 2);
+  poly_eval_derivs(k, x, d, p);
+  poly_eval_derivs(k, x, e, q);
+  for(size_t i= 0; i < n; ++i) {
+    same= same && *gsl_matrix_ptr(d, i, 1) == *gsl_matrix_ptr(e, i, 1);
+  }
+  REQUIRE(same);
+  gsl_matrix_free(d);
+  gsl_matrix_free(e);
+}
+
+
+TEST_CASE("Roots of batch of polynomials are found.", "[poly]") {
+  gsl_error_handler_t *const old= gsl_set_error_handler_off();
+  thread_pool p(3);
+  // Two quadratics: (x - 1)(x - 2), and x^2 + 1; then one with zero leading
+  // coefficient.
+  vector<double> a({2.0, -3.0, 1.0, 1.0, 0.0, 1.0, 1.0, 1.0, 0.0});
+  vector<complex<double>> z(6);
+  batch_poly_solver s(3, p);
+  REQUIRE(s.size() == 3);
+  std::vector<int> const r= s.solve(a, z);
+  REQUIRE(r.size() == 3);
+  REQUIRE(r[0] == GSL_SUCCESS);
+  REQUIRE(z[0].real() == Approx(1.0));
+  REQUIRE(z[1].real() == Approx(2.0));
+  REQUIRE(r[1] == GSL_SUCCESS);
+  REQUIRE(std::abs(z[2].imag()) == Approx(1.0));
+  REQUIRE(z[2].imag() == Approx(-z[3].imag()));
+  REQUIRE(r[2] == GSL_EINVAL);
+  REQUIRE(std::isnan(z[4].real()));
+  // Linear, cubic, and quartic; each root makes polynomial vanish.
+  for(size_t m: {2, 4, 5}) {
+    size_t const np= 50;
+    vector<double> b(np * m);
+    for(size_t i= 0; i < b.size(); ++i) b[i]= std::sin(double(i)) + 0.1;
+    vector<complex<double>> w(np * (m - 1));
+    batch_poly_solver t(m, p);
+    std::vector<int> const u= t.solve(b, w);
+    for(size_t i= 0; i < np; ++i) {
+      REQUIRE(u[i] == GSL_SUCCESS);
+      auto const bi= b.subvector(m, i * m);
+      auto const wi= w.subvector(m - 1, i * (m - 1));
+      vector<complex<double>> const f= poly_eval(bi, wi);
+      for(size_t j= 0; j < m - 1; ++j) REQUIRE(std::abs(f[j]) < 1e-8);
+    }
+  }
+  REQUIRE_THROWS_AS(batch_poly_solver(0), std::invalid_argument);
+  REQUIRE_THROWS_AS(batch_poly_solver(1), std::invalid_argument);
+  vector<double> c(7);
+  REQUIRE_THROWS_AS(s.solve(c, z), std::invalid_argument);
+  gsl_set_error_handler(old);
+}
+
+// EOF
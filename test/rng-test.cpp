@@ -0,0 +1,75 @@
+/// @file       test/rng-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for random numbers.
+
+#include "gslcpp/rng.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <cmath> // sqrt
+
+using gsl::ran_exponential;
+using gsl::ran_fill;
+using gsl::ran_gaussian;
+using gsl::ran_poisson;
+using gsl::ran_uniform;
+using gsl::rng;
+using gsl::rng_grain;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+TEST_CASE("Serial fill matches draws from same generator.", "[rng]") {
+  rng a(42), b(42);
+  REQUIRE(a.name() != nullptr);
+  vector<double> v(1000);
+  v.set_zero();
+  auto s= v.subvector(300, 1, 3);
+  ran_fill(s, ran_gaussian{2.0}, a);
+  bool ok= true;
+  for(size_t i= 0; i < 300; ++i) {
+    ok&= (s[i] == gsl_ran_gaussian(b.r(), 2.0));
+  }
+  REQUIRE(ok);
+  REQUIRE(v[0] == 0.0);
+  rng c= a.clone();
+  REQUIRE(a.get() == c.get());
+}
+
+
+TEST_CASE("Parallel fill is reproducible across threads.", "[rng]") {
+  size_t const n= 3 * rng_grain + 17;
+  thread_pool p(4), q(1);
+  vector<double> x(n), y(n), z(n);
+  ran_fill(x, ran_uniform(), 99, gsl_rng_mt19937, p);
+  ran_fill(y, ran_uniform(), 99, gsl_rng_mt19937, q);
+  ran_fill(z, ran_uniform(), 100, gsl_rng_mt19937, p);
+  bool same= true;
+  size_t diff= 0;
+  for(size_t i= 0; i < n; ++i) {
+    same&= (x[i] == y[i]);
+    diff+= (x[i] != z[i]);
+  }
+  REQUIRE(same);
+  REQUIRE(diff > n - 10);
+  // Different chunks have different streams.
+  REQUIRE(x[0] != x[rng_grain]);
+}
+
+
+TEST_CASE("Parallel fill has expected moments.", "[rng]") {
+  size_t const n= 4 * rng_grain;
+  thread_pool p(3);
+  vector<double> e(n);
+  vector<unsigned> k(n);
+  ran_fill(e, ran_exponential{2.0}, 5, gsl_rng_mt19937, p);
+  ran_fill(k, ran_poisson{3.5}, 6, gsl_rng_mt19937, p);
+  double se= 0.0, sk= 0.0;
+  for(size_t i= 0; i < n; ++i) {
+    se+= e[i];
+    sk+= k[i];
+  }
+  REQUIRE(se / n == Approx(2.0).margin(5.0 * 2.0 / std::sqrt(double(n))));
+  REQUIRE(sk / n == Approx(3.5).margin(5.0 * std::sqrt(3.5 / n)));
+}
+
+// EOF
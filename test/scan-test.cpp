@@ -0,0 +1,77 @@
+/// @file       test/scan-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for prefix sums and scans.
+
+#include "gslcpp/scan.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <functional> // multiplies
+
+using gsl::cumprod;
+using gsl::cumsum;
+using gsl::exclusive_scan;
+using gsl::scan_grain;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+TEST_CASE("Scans of short vector match serial loop.", "[scan]") {
+  vector<double> v({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0});
+  vector<double> s(7), e(7);
+  cumsum(v, s);
+  REQUIRE(s[0] == 1.0);
+  REQUIRE(s[4] == 15.0);
+  REQUIRE(s[6] == 28.0);
+  exclusive_scan(v, e);
+  REQUIRE(e[0] == 0.0);
+  REQUIRE(e[6] == 21.0);
+  // Qualified, lest std::exclusive_scan be found through std::multiplies.
+  gsl::exclusive_scan(v, e, 1.0, std::multiplies<double>());
+  REQUIRE(e[6] == 720.0);
+  cumprod(v);
+  REQUIRE(v[3] == 24.0);
+  REQUIRE(v[6] == 5040.0);
+  // Every second element of a view.
+  vector<int> w({1, 0, 2, 0, 3, 0, 4, 0, 5});
+  auto odd= w.subvector(5, 0, 2);
+  cumsum(odd);
+  REQUIRE(w[8] == 15);
+  REQUIRE(w[1] == 0);
+  vector<double> bad(3);
+  REQUIRE_THROWS(cumsum(s, bad));
+}
+
+
+TEST_CASE("Two-pass scan matches serial loop exactly.", "[scan]") {
+  size_t const n= 5 * scan_grain + 3;
+  vector<long> v(n), a(n), b(n), c(n);
+  for(size_t i= 0; i < n; ++i) v[i]= long(i % 13) - 6;
+  thread_pool p(4), q(1);
+  gsl::inclusive_scan(v, a, std::plus<long>(), p);
+  gsl::exclusive_scan(v, b, 100L, std::plus<long>(), p);
+  cumsum(v, c, q);
+  bool ok= true;
+  long t= 0;
+  for(size_t i= 0; i < n; ++i) {
+    ok&= (b[i] == t + 100);
+    t+= v[i];
+    ok&= (a[i] == t && c[i] == t);
+  }
+  REQUIRE(ok);
+}
+
+
+TEST_CASE("Floating-point scan is same for any number of threads.", "[scan]") {
+  size_t const n= 3 * scan_grain + 1001;
+  vector<double> v(n), a(n), b(n);
+  for(size_t i= 0; i < n; ++i) v[i]= 1.0 / double(i + 1);
+  thread_pool p(3), q(1);
+  cumsum(v, a, p);
+  cumsum(v, b, q);
+  REQUIRE(a == b);
+  double t= 0.0;
+  for(size_t i= 0; i < n; ++i) t+= v[i];
+  REQUIRE(a[n - 1] == Approx(t).epsilon(1e-11));
+}
+
+// EOF
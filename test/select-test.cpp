@@ -0,0 +1,95 @@
+/// @file       test/select-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for selection by predicate or mask.
+
+#include "gslcpp/select.hpp"
+#include <catch.hpp>
+
+using gsl::add_where;
+using gsl::compress;
+using gsl::count_if;
+using gsl::div_where;
+using gsl::mask_if;
+using gsl::select_grain;
+using gsl::thread_pool;
+using gsl::transform_where;
+using gsl::vector;
+using gsl::where;
+
+
+TEST_CASE("Compaction keeps selected elements in order.", "[select]") {
+  vector<double> v({3.0, -1.0, 4.0, -1.0, 5.0, -9.0, 2.0});
+  auto const pos= [](double x) { return x > 0.0; };
+  REQUIRE(count_if(v, pos) == 4);
+  vector<double> const c= compress(v, pos);
+  REQUIRE(c.size() == 4);
+  REQUIRE(c[0] == 3.0);
+  REQUIRE(c[3] == 2.0);
+  vector<double> d(7);
+  d.set_all(8.0);
+  REQUIRE(compress(v, [](double x) { return x < 0.0; }, d) == 3);
+  REQUIRE(d[2] == -9.0);
+  REQUIRE(d[3] == 8.0);
+  // Destination smaller than source but large enough for selection.
+  vector<double> e(4);
+  REQUIRE(compress(v, pos, e) == 4);
+  REQUIRE(e[1] == 4.0);
+  vector<double> f(3);
+  REQUIRE_THROWS_AS(compress(v, pos, f), std::invalid_argument);
+  REQUIRE_THROWS_AS(
+        compress(v, [](double x) { return x > 9.0; }), std::length_error);
+}
+
+
+TEST_CASE("Parallel compaction matches serial.", "[select]") {
+  size_t const n= 4 * select_grain + 77;
+  vector<long> v(n);
+  for(size_t i= 0; i < n; ++i) v[i]= long((i * 2654435761u) % 1000);
+  auto const pred= [](long x) { return x % 3 == 0; };
+  thread_pool p(4), q(1);
+  size_t const k= count_if(v, pred, p);
+  REQUIRE(k == count_if(v, pred, q));
+  vector<long> const a= compress(v, pred, p);
+  vector<long> b(n);
+  REQUIRE(compress(v, pred, b, q) == k);
+  REQUIRE(a.size() == k);
+  bool ok= true;
+  size_t j= 0;
+  for(size_t i= 0; i < n; ++i) {
+    if(pred(v[i])) ok&= (a[j] == v[i] && b[j++] == v[i]);
+  }
+  REQUIRE(ok);
+  REQUIRE(j == k);
+}
+
+
+TEST_CASE("Masked operations touch only selected elements.", "[select]") {
+  vector<double> a({1.0, 2.0, 3.0, 4.0});
+  vector<double> b({10.0, 20.0, 30.0, 40.0});
+  vector<unsigned char> const m= mask_if(a, [](double x) { return x > 2.5; });
+  REQUIRE(m[1] == 0);
+  REQUIRE(m[2] == 1);
+  vector<double> const w= where(m, a, b);
+  REQUIRE(w[0] == 10.0);
+  REQUIRE(w[3] == 4.0);
+  add_where(a, m, b);
+  REQUIRE(a[1] == 2.0);
+  REQUIRE(a[2] == 33.0);
+  div_where(a, m, b);
+  REQUIRE(a[3] == 44.0 / 40.0);
+  transform_where(b, m, [](double x) { return -x; });
+  REQUIRE(b[0] == 10.0);
+  REQUIRE(b[3] == -40.0);
+  vector<int> bad(3);
+  REQUIRE_THROWS(add_where(a, bad, b));
+  // Zero divisor outside mask is never used.
+  vector<int> i({7, 9, -8, 5}), d({2, 0, 0, -5});
+  vector<int> const dm({1, 0, 0, 1});
+  div_where(i, dm, d);
+  REQUIRE(i[0] == 3);
+  REQUIRE(i[1] == 9);
+  REQUIRE(i[2] == -8);
+  REQUIRE(i[3] == -1);
+}
+
+// EOF
@@ -0,0 +1,99 @@
+/// @file       test/sf-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for special functions over vectors.
+
+#include "gslcpp/sf.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+#include <gsl/gsl_errno.h> // gsl_set_error_handler_off, GSL_EDOM, etc.
+
+using gsl::sf_bessel_Jn;
+using gsl::sf_bessel_Jn_array;
+using gsl::sf_erf;
+using gsl::sf_eval;
+using gsl::sf_gamma;
+using gsl::sf_grain;
+using gsl::sf_legendre_Pl;
+using gsl::sf_legendre_Pl_array;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+TEST_CASE("Special function is evaluated at every element.", "[sf]") {
+  vector<double> x({0.5, 1.0, 2.0, 3.5});
+  vector<double> y(4), e(4);
+  REQUIRE(sf_eval(x, y, sf_gamma()) == GSL_SUCCESS);
+  REQUIRE(y[1] == Approx(1.0));
+  REQUIRE(y[2] == Approx(1.0));
+  REQUIRE(y[0] == Approx(std::sqrt(M_PI)));
+  REQUIRE(sf_eval(x, y, e, sf_erf()) == GSL_SUCCESS);
+  for(size_t i= 0; i < 4; ++i) {
+    gsl_sf_result r;
+    gsl_sf_erf_e(x[i], &r);
+    REQUIRE(y[i] == r.val);
+    REQUIRE(e[i] == r.err);
+  }
+  REQUIRE(sf_eval(x, y, gsl_sf_bessel_J0_e) == GSL_SUCCESS);
+  REQUIRE(y[3] == gsl_sf_bessel_J0(3.5));
+  vector<double> z(3);
+  REQUIRE_THROWS_AS(sf_eval(x, z, sf_erf()), std::invalid_argument);
+}
+
+
+TEST_CASE("Parallel evaluation reports first failure.", "[sf]") {
+  gsl_error_handler_t *const old= gsl_set_error_handler_off();
+  thread_pool p(4), q(1);
+  size_t const n= 7 * sf_grain + 5;
+  vector<double> x(n), a(n), b(n);
+  for(size_t i= 0; i < n; ++i) x[i]= -1.0 + 2.0 * double(i) / double(n - 1);
+  REQUIRE(sf_eval(x, a, sf_legendre_Pl{3}, p) == GSL_SUCCESS);
+  REQUIRE(sf_eval(x, b, sf_legendre_Pl{3}, q) == GSL_SUCCESS);
+  bool same= true;
+  for(size_t i= 0; i < n; ++i) same= same && a[i] == b[i];
+  REQUIRE(same);
+  REQUIRE(a[n - 1] == Approx(1.0));
+  // Legendre-polynomial inside [-1, 1]; gamma-function beyond 100, where
+  // it overflows.  Below -1, the Legendre-polynomial fails by domain.
+  auto const f= [](double t, gsl_sf_result *r) {
+    return t > 100.0 ? gsl_sf_gamma_e(t, r) : gsl_sf_legendre_Pl_e(3, t, r);
+  };
+  REQUIRE(sf_eval(x, a, f, p) == GSL_SUCCESS);
+  x[2 * sf_grain]= -2.0;
+  x[5 * sf_grain]= 200.0;
+  REQUIRE(sf_eval(x, a, f, p) == GSL_EDOM);
+  REQUIRE(a[0] == b[0]);
+  x[2 * sf_grain]= 200.0;
+  x[5 * sf_grain]= -2.0;
+  REQUIRE(sf_eval(x, a, f, p) == GSL_EOVRFLW);
+  gsl_set_error_handler(old);
+}
+
+
+TEST_CASE("Array-functions fill one row per argument.", "[sf]") {
+  thread_pool p(3);
+  size_t const n= 1000;
+  vector<double> x(n);
+  for(size_t i= 0; i < n; ++i) x[i]= 0.01 * double(i + 1);
+  std::vector<double> d(n * 6);
+  auto m= gsl_matrix_view_array(d.data(), n, 6);
+  REQUIRE(sf_bessel_Jn_array(2, 7, x, &m.matrix, p) == GSL_SUCCESS);
+  for(size_t i= 0; i < n; i+= 97) {
+    for(int k= 0; k < 6; ++k) {
+      double const j= gsl_sf_bessel_Jn(2 + k, x[i]);
+      REQUIRE(gsl_matrix_get(&m.matrix, i, k) == Approx(j).margin(1e-14));
+    }
+  }
+  vector<double> c({-1.0, 0.0, 0.5, 1.0});
+  std::vector<double> l(4 * 6);
+  auto q= gsl_matrix_view_array(l.data(), 4, 6);
+  REQUIRE(sf_legendre_Pl_array(5, c, &q.matrix) == GSL_SUCCESS);
+  REQUIRE(gsl_matrix_get(&q.matrix, 0, 3) == Approx(-1.0));
+  REQUIRE(gsl_matrix_get(&q.matrix, 2, 2) == Approx(-0.125));
+  REQUIRE_THROWS_AS(
+        sf_legendre_Pl_array(4, c, &q.matrix), std::invalid_argument);
+  vector<double> v(n);
+  sf_eval(x, v, sf_bessel_Jn{4}, p);
+  REQUIRE(v[500] == Approx(gsl_matrix_get(&m.matrix, 500, 2)));
+}
+
+// EOF
@@ -0,0 +1,143 @@
+/// @file       test/sort-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for sorting.
+
+#include "gslcpp/sort.hpp"
+#include <algorithm> // is_sorted, sort, stable_sort
+#include <catch.hpp>
+#include <cmath> // signbit
+#include <limits> // numeric_limits
+#include <random> // mt19937_64, uniform_int_distribution, etc.
+#include <utility> // pair
+
+using gsl::merge_sort;
+using gsl::nth_element;
+using gsl::partial_sort;
+using gsl::sort;
+using gsl::sort_index;
+using gsl::thread_pool;
+using gsl::vector;
+using std::mt19937_64;
+
+
+TEST_CASE("sort matches std::sort for large vector.", "[sort]") {
+  size_t const n= 300001; // Five chunks, the last partial.
+  mt19937_64 g(1);
+  std::normal_distribution<double> d;
+  vector<double> v(n);
+  std::vector<double> s(n);
+  for(size_t i= 0; i < n; ++i) s[i]= v[i]= d(g);
+  std::sort(s.begin(), s.end());
+  thread_pool p(4);
+  sort(v, p);
+  bool same= true;
+  for(size_t i= 0; i < n; ++i) same= same && (v[i] == s[i]);
+  REQUIRE(same);
+}
+
+
+TEST_CASE("sort handles integers and strided view.", "[sort]") {
+  size_t const n= 2000;
+  mt19937_64 g(2);
+  std::uniform_int_distribution<int> d(-1000, 1000);
+  vector<int> v(2 * n);
+  for(size_t i= 0; i < 2 * n; ++i) v[i]= d(g);
+  vector<int> const orig(v);
+  auto even= v.subvector(n, 0, 2);
+  sort(even);
+  for(size_t i= 1; i < n; ++i) REQUIRE(even[i - 1] <= even[i]);
+  for(size_t i= 1; i < 2 * n; i+= 2) REQUIRE(v[i] == orig[i]);
+}
+
+
+TEST_CASE("sort orders signed zero and NaN.", "[sort]") {
+  double const nan= std::numeric_limits<double>::quiet_NaN();
+  double const inf= std::numeric_limits<double>::infinity();
+  vector<double> v({nan, 0.0, -inf, -0.0, 1.0});
+  sort(v);
+  REQUIRE(v[0] == -inf);
+  REQUIRE(std::signbit(v[1]));
+  REQUIRE(v[2] == 0.0);
+  REQUIRE(!std::signbit(v[2]));
+  REQUIRE(v[3] == 1.0);
+  REQUIRE(v[4] != v[4]);
+  vector<long double> w({3.0L, -1.0L, 2.0L});
+  sort(w);
+  REQUIRE(w[0] == -1.0L);
+  REQUIRE(w[2] == 3.0L);
+}
+
+
+TEST_CASE("sort_index is stable permutation.", "[sort]") {
+  size_t const n= 100000;
+  mt19937_64 g(3);
+  std::uniform_int_distribution<unsigned> d(0, 99);
+  vector<unsigned> v(n);
+  for(size_t i= 0; i < n; ++i) v[i]= d(g);
+  thread_pool p(3);
+  vector<size_t> const perm= sort_index(v, p);
+  bool ok= true;
+  for(size_t i= 1; i < n; ++i) {
+    unsigned const a= v[perm[i - 1]], b= v[perm[i]];
+    ok= ok && (a < b || (a == b && perm[i - 1] < perm[i]));
+  }
+  REQUIRE(ok);
+  vector<float> f({2.5f, -1.0f, 2.5f, 0.0f});
+  vector<size_t> q(4);
+  sort_index(q, f);
+  REQUIRE(q[0] == 1);
+  REQUIRE(q[1] == 3);
+  REQUIRE(q[2] == 0);
+  REQUIRE(q[3] == 2);
+  vector<size_t> bad(3);
+  REQUIRE_THROWS(sort_index(bad, f));
+}
+
+
+TEST_CASE("partial_sort and nth_element place smallest.", "[sort]") {
+  vector<long> v({9, 3, 7, 1, 8, 2, 6, 4, 5, 0});
+  partial_sort(v, 4);
+  REQUIRE(v[0] == 0);
+  REQUIRE(v[1] == 1);
+  REQUIRE(v[2] == 2);
+  REQUIRE(v[3] == 3);
+  for(size_t i= 4; i < v.size(); ++i) REQUIRE(v[i] > 3);
+  vector<long> w({9, 3, 7, 1, 8, 2, 6, 4, 5, 0});
+  nth_element(w, 6);
+  REQUIRE(w[6] == 6);
+  for(size_t i= 0; i < 6; ++i) REQUIRE(w[i] < 6);
+  REQUIRE_THROWS(nth_element(w, 10));
+}
+
+
+TEST_CASE("merge_sort gives same result for any number of threads.",
+          "[sort]") {
+  // Records are (key, original offset), and only the key is compared, so
+  // that any difference in the order of equal keys would be visible.
+  using rec= std::pair<int, size_t>;
+  size_t const n= 1001;
+  mt19937_64 g(4);
+  std::uniform_int_distribution<int> d(0, 20);
+  std::vector<rec> a(n), t(n);
+  for(size_t i= 0; i < n; ++i) a[i]= {d(g), i};
+  auto const less= [](rec const &x, rec const &y) {
+    return x.first < y.first;
+  };
+  auto const leaf= [&](rec *b, rec *, size_t m) {
+    std::stable_sort(b, b + m, less);
+  };
+  thread_pool q(1);
+  std::vector<rec> s(a);
+  merge_sort(s.data(), t.data(), n, less, leaf, q, 7);
+  REQUIRE(std::is_sorted(s.begin(), s.end())); // stable, so also by offset
+  for(unsigned k: {2u, 5u}) {
+    thread_pool p(k);
+    std::vector<rec> b(a);
+    merge_sort(b.data(), t.data(), n, less, leaf, p, 7);
+    bool same= true;
+    for(size_t i= 0; i < n; ++i) same= same && b[i] == s[i];
+    REQUIRE(same);
+  }
+}
+
+// EOF
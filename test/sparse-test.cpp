@@ -0,0 +1,160 @@
+/// @file       test/sparse-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for sparse vectors and matrices.
+
+#include "gslcpp/sparse.hpp"
+#include "gslcpp/vector.hpp"
+#include <catch.hpp>
+
+using gsl::axpy;
+using gsl::dot;
+using gsl::gather;
+using gsl::gather_grain;
+using gsl::scatter;
+using gsl::scatter_add;
+using gsl::sparse_vector;
+using gsl::spmatrix;
+using gsl::spmv;
+using gsl::spmv_grain;
+using gsl::thread_pool;
+using gsl::vector;
+
+
+TEST_CASE("Sparse vector combines with dense vector.", "[sparse]") {
+  vector<double> d({0.0, 2.0, 0.0, 0.0, -1.0, 0.0, 3.0});
+  sparse_vector<> s(d);
+  REQUIRE(s.size() == 7);
+  REQUIRE(s.nnz() == 3);
+  REQUIRE(s[4] == -1.0);
+  REQUIRE(s[5] == 0.0);
+  REQUIRE(!s.isnull());
+  REQUIRE(dot(s, d) == 14.0);
+  s.set(0, 5.0);
+  s.set(6, 4.0);
+  REQUIRE(s.nnz() == 4);
+  REQUIRE(s.indices()[0] == 0);
+  REQUIRE(s[6] == 4.0);
+  sparse_vector<> t(7);
+  REQUIRE(t.isnull());
+  t.set(6, 0.5);
+  t.set(2, 9.0);
+  REQUIRE(dot(s, t) == 2.0);
+  vector<double> y(7);
+  y.set_zero();
+  axpy(2.0, s, y);
+  REQUIRE(y[0] == 10.0);
+  REQUIRE(y[1] == 4.0);
+  REQUIRE(y[2] == 0.0);
+  scatter(t, y);
+  REQUIRE(y[2] == 9.0);
+  REQUIRE(y[6] == 0.5);
+  gather(d, s);
+  REQUIRE(s[0] == 0.0);
+  REQUIRE(s[6] == 3.0);
+  REQUIRE_THROWS(s.set(7, 1.0));
+}
+
+
+TEST_CASE("Sparse product is same in every storage.", "[sparse]") {
+  size_t const n= 3000, m= 2000;
+  spmatrix coo(n, m);
+  for(size_t r= 0; r < n; ++r) {
+    for(size_t k= 0; k < 12; ++k) {
+      size_t const c= (r * 7 + k * 131) % m;
+      coo.set(r, c, double((r + c) % 9) - 4.0);
+    }
+  }
+  REQUIRE(coo.nnz() > spmv_grain);
+  spmatrix const csr= coo.csr(), csc= coo.csc();
+  REQUIRE(csr.get(5, (5 * 7 + 131) % m) == coo.get(5, (5 * 7 + 131) % m));
+  vector<double> x(m), a(n), b(n), c(n), d(n);
+  for(size_t j= 0; j < m; ++j) x[j]= double(j % 5) - 2.0;
+  thread_pool p(4), q(1);
+  spmv(coo, x, a, p);
+  spmv(csr, x, b, p);
+  spmv(csc, x, c, p);
+  spmv(csr, x, d, q);
+  bool same= true;
+  for(size_t r= 0; r < n; ++r) {
+    // Products are sums of small integers, which are exact in every order.
+    same&= (a[r] == b[r] && b[r] == c[r] && b[r] == d[r]);
+  }
+  REQUIRE(same);
+  // With inexact sums, compressed columns still give same result on every
+  // run and with every number of threads.
+  for(size_t j= 0; j < m; ++j) x[j]= 1.0 / double(j + 3);
+  spmv(csc, x, c, q);
+  for(int t= 0; t < 5; ++t) {
+    thread_pool r(unsigned(t) + 2);
+    spmv(csc, x, d, t % 2 ? p : r);
+    for(size_t i= 0; i < n; ++i) same&= (c[i] == d[i]);
+  }
+  REQUIRE(same);
+  vector<double> bad(n);
+  REQUIRE_THROWS(spmv(csr, bad, a, p));
+}
+
+
+TEST_CASE("Gather and scatter follow vector of indices.", "[sparse]") {
+  vector<double> src({10.0, 11.0, 12.0, 13.0, 14.0, 15.0});
+  vector<int> idx({5, 0, 3, 3, 1});
+  vector<double> dst(5);
+  gather(src, idx, dst);
+  REQUIRE(dst[0] == 15.0);
+  REQUIRE(dst[1] == 10.0);
+  REQUIRE(dst[3] == 13.0);
+  vector<double> out(6);
+  out.set_all(0.0);
+  scatter(dst, idx, out);
+  REQUIRE(out[5] == 15.0);
+  REQUIRE(out[3] == 13.0);
+  REQUIRE(out[2] == 0.0);
+  scatter_add(dst, idx, out);
+  REQUIRE(out[3] == 39.0);
+  REQUIRE(out[1] == 22.0);
+  vector<int> bad({0, 6});
+  vector<double> two(2);
+  REQUIRE_THROWS_AS(gather(src, bad, two), std::out_of_range);
+  REQUIRE_THROWS_AS(scatter(two, bad, src), std::out_of_range);
+  REQUIRE(src[0] == 10.0);
+  REQUIRE_THROWS_AS(gather(src, idx, two), std::invalid_argument);
+}
+
+
+TEST_CASE("Parallel gather and scatter-add match serial.", "[sparse]") {
+  size_t const n= 3 * gather_grain + 17, m= 1000;
+  vector<double> table(m), x(n), a(n), b(n);
+  vector<int> i32(n);
+  vector<unsigned long> i64(n);
+  for(size_t j= 0; j < m; ++j) table[j]= double(j) * 0.5;
+  for(size_t j= 0; j < n; ++j) {
+    i32[j]= int((j * 7919) % m);
+    i64[j]= (j * 104729) % m;
+    x[j]= double(j % 11) - 5.0;
+  }
+  thread_pool p(4), q(1);
+  gather(table, i32, a, p);
+  gather(table, i64, b, q);
+  bool ok= true;
+  for(size_t j= 0; j < n; ++j) {
+    ok&= (a[j] == table[size_t(i32[j])] && b[j] == table[i64[j]]);
+  }
+  REQUIRE(ok);
+  vector<double> u(m), v(m);
+  u.set_all(1.0);
+  v.set_all(1.0);
+  // Every index repeats many times, and so threads would conflict without
+  // partition.
+  scatter_add(x, i64, u, p);
+  scatter_add(x, i64, v, q);
+  bool same= true;
+  for(size_t j= 0; j < m; ++j) same&= (u[j] == v[j]);
+  REQUIRE(same);
+  double s= 0.0;
+  for(size_t j= 0; j < m; ++j) s+= u[j] - 1.0;
+  double t= 0.0;
+  for(size_t j= 0; j < n; ++j) t+= x[j];
+  REQUIRE(s == t);
+}
+
+// EOF
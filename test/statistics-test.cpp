@@ -0,0 +1,261 @@
+/// @file       test/statistics-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for statistics.
+
+#include "gslcpp/statistics.hpp"
+#include "gslcpp/vector.hpp"
+#include <algorithm> // sort
+#include <catch.hpp>
+#include <cmath> // sqrt
+#include <random> // mt19937_64, gamma_distribution
+
+using gsl::comoments_of;
+using gsl::correlation;
+using gsl::covariance;
+using gsl::kurtosis;
+using gsl::mean;
+using gsl::median;
+using gsl::moments;
+using gsl::moments_of;
+using gsl::quantile;
+using gsl::quantile_workspace;
+using gsl::quantiles;
+using gsl::rstat;
+using gsl::sd;
+using gsl::skew;
+using gsl::tdigest;
+using gsl::tdigest_of;
+using gsl::thread_pool;
+using gsl::variance;
+using gsl::vector;
+using std::sqrt;
+
+
+/// Reference-values computed by two passes, as in GSL, but in long double.
+struct two_pass {
+  double mean, var, skew, kurt;
+
+  two_pass(std::vector<double> const &x) {
+    long double const n= x.size();
+    long double m= 0.0L, m2= 0.0L, m3= 0.0L, m4= 0.0L;
+    for(double v: x) m+= v;
+    m/= n;
+    for(double v: x) {
+      long double const d= v - m, d2= d * d;
+      m2+= d2;
+      m3+= d2 * d;
+      m4+= d2 * d2;
+    }
+    long double const v= m2 / (n - 1.0L);
+    mean= double(m);
+    var= double(v);
+    skew= double(m3 / n / (v * std::sqrt(v)));
+    kurt= double(m4 / n / (v * v) - 3.0L);
+  }
+};
+
+
+TEST_CASE("Moments match two-pass reference.", "[statistics]") {
+  size_t const n= 200003;
+  std::mt19937_64 g(5);
+  std::gamma_distribution<double> d(2.0, 1.0);
+  vector<double> v(n);
+  std::vector<double> x(n);
+  for(size_t i= 0; i < n; ++i) x[i]= v[i]= 1.0E6 + d(g);
+  two_pass const r(x);
+  thread_pool p(4);
+  REQUIRE(mean(v, p) == Approx(r.mean).epsilon(1.0E-14));
+  REQUIRE(variance(v, p) == Approx(r.var).epsilon(1.0E-10));
+  REQUIRE(sd(v, p) == Approx(sqrt(r.var)).epsilon(1.0E-10));
+  REQUIRE(skew(v, p) == Approx(r.skew).epsilon(1.0E-9));
+  REQUIRE(kurtosis(v, p) == Approx(r.kurt).epsilon(1.0E-9));
+  // Same result, bit for bit, for any number of threads.
+  thread_pool q(1);
+  REQUIRE(variance(v, q) == variance(v, p));
+  REQUIRE(kurtosis(v, q) == kurtosis(v, p));
+}
+
+
+TEST_CASE("Moments merge and accept strided view.", "[statistics]") {
+  vector<int> v({1, 100, 2, 100, 3, 100, 4, 100, 5, 100});
+  auto const s= v.subvector(5, 0, 2);
+  moments const m= moments_of(s);
+  REQUIRE(m.count() == 5);
+  REQUIRE(m.mean() == Approx(3.0));
+  REQUIRE(m.variance() == Approx(2.5));
+  REQUIRE(m.skew() == Approx(0.0).margin(1.0E-15));
+  moments a, b;
+  for(double x: {1.0, 2.0}) a.add(x);
+  for(double x: {3.0, 4.0, 5.0}) b.add(x);
+  a+= b;
+  REQUIRE(a.count() == 5);
+  REQUIRE(a.mean() == Approx(3.0));
+  REQUIRE(a.variance() == Approx(2.5));
+  REQUIRE(a.kurtosis() == Approx(m.kurtosis()));
+}
+
+
+TEST_CASE("Covariance and correlation match reference.", "[statistics]") {
+  size_t const n= 100000;
+  std::mt19937_64 g(6);
+  std::normal_distribution<double> d;
+  vector<double> x(n), y(n);
+  double mx= 0.0, my= 0.0;
+  for(size_t i= 0; i < n; ++i) {
+    x[i]= d(g);
+    y[i]= 0.5 * x[i] + d(g);
+    mx+= x[i];
+    my+= y[i];
+  }
+  mx/= n;
+  my/= n;
+  double sxy= 0.0, sxx= 0.0, syy= 0.0;
+  for(size_t i= 0; i < n; ++i) {
+    sxy+= (x[i] - mx) * (y[i] - my);
+    sxx+= (x[i] - mx) * (x[i] - mx);
+    syy+= (y[i] - my) * (y[i] - my);
+  }
+  thread_pool p(3);
+  REQUIRE(covariance(x, y, p) == Approx(sxy / (n - 1)).epsilon(1.0E-10));
+  REQUIRE(correlation(x, y, p) == Approx(sxy / sqrt(sxx * syy)));
+  REQUIRE(comoments_of(x, y, p).mean_y() == Approx(my));
+  vector<double> z(n - 1);
+  REQUIRE_THROWS(covariance(x, z, p));
+}
+
+
+/// Quantile of sorted data as defined by GSL.
+/// @param s  Sorted data.
+/// @param f  Fraction.
+/// @return  Quantile.
+double sorted_quantile(std::vector<double> const &s, double f) {
+  double const delta= (s.size() - 1) * f;
+  size_t const i= size_t(delta);
+  if(i + 1 >= s.size()) return s[i];
+  return (1.0 - (delta - i)) * s[i] + (delta - i) * s[i + 1];
+}
+
+
+TEST_CASE("Quantiles by selection match sorted data.", "[statistics]") {
+  size_t const n= 10001;
+  std::mt19937_64 g(7);
+  std::exponential_distribution<double> d;
+  vector<double> v(n);
+  std::vector<double> s(n);
+  for(size_t i= 0; i < n; ++i) s[i]= v[i]= d(g);
+  vector<double> const orig(v);
+  std::sort(s.begin(), s.end());
+  REQUIRE(median(v) == sorted_quantile(s, 0.5));
+  REQUIRE(quantile(v, 0.0) == s.front());
+  REQUIRE(quantile(v, 1.0) == s.back());
+  REQUIRE(quantile(v, 0.123) == Approx(sorted_quantile(s, 0.123)));
+  REQUIRE(v == orig); // Input is not modified.
+  quantile_workspace<double> w;
+  vector<double> f({0.99, 0.5, 0.9, 0.25, 0.9}), r(5);
+  quantiles(v, f, r, w);
+  REQUIRE(w.capacity() >= n);
+  size_t const *const k= w.offsets(10).data();
+  quantiles(v, f, r, w);
+  REQUIRE(w.offsets(10).data() == k); // Offsets reuse storage.
+  for(size_t j= 0; j < f.size(); ++j) {
+    REQUIRE(r[j] == Approx(sorted_quantile(s, f[j])));
+  }
+  REQUIRE_THROWS(quantile(v, 1.5));
+  vector<int> even({4, 1, 3, 2});
+  REQUIRE(median(even) == 2.5);
+  REQUIRE(median(even.subvector(2, 0, 2)) == 3.5);
+}
+
+
+TEST_CASE("tdigest approximates quantiles.", "[statistics]") {
+  size_t const n= 300000;
+  std::mt19937_64 g(8);
+  std::normal_distribution<double> d;
+  vector<double> v(n);
+  std::vector<double> s(n);
+  for(size_t i= 0; i < n; ++i) s[i]= v[i]= d(g);
+  std::sort(s.begin(), s.end());
+  thread_pool p(4);
+  tdigest t= tdigest_of(v, 200.0, p);
+  REQUIRE(t.count() == n);
+  REQUIRE(t.size() <= 200);
+  for(double q: {0.01, 0.5, 0.9, 0.99, 0.999}) {
+    REQUIRE(t.quantile(q) == Approx(sorted_quantile(s, q)).margin(0.01));
+  }
+  REQUIRE(t.quantile(0.0) == s.front());
+  REQUIRE(t.quantile(1.0) == s.back());
+  thread_pool q(1);
+  REQUIRE(tdigest_of(v, 200.0, q).quantile(0.99) == t.quantile(0.99));
+  REQUIRE(tdigest().quantile(0.5) != tdigest().quantile(0.5)); // NaN.
+  // Merging with itself doubles every weight.
+  double const m= t.quantile(0.5);
+  t+= t;
+  REQUIRE(t.count() == 2 * n);
+  REQUIRE(t.size() <= 200);
+  REQUIRE(t.quantile(0.5) == Approx(m).margin(0.01));
+  REQUIRE(t.quantile(0.0) == s.front());
+}
+
+
+TEST_CASE("rstat ingests chunks and merges.", "[statistics]") {
+  size_t const n= 150000;
+  std::mt19937_64 g(9);
+  std::uniform_real_distribution<double> d(-1.0, 3.0);
+  vector<double> v(n);
+  for(size_t i= 0; i < n; ++i) v[i]= d(g);
+  thread_pool p(4);
+  rstat a, b, all;
+  a.add(v.subvector(n / 3, 0), p);
+  b.add(v.subvector(n - n / 3, n / 3), p);
+  for(size_t i= 0; i < n; ++i) all.add(v[i]);
+  a+= b;
+  REQUIRE(a.n() == n);
+  REQUIRE(a.min() == all.min());
+  REQUIRE(a.max() == all.max());
+  REQUIRE(a.mean() == Approx(all.mean()).epsilon(1.0E-12));
+  REQUIRE(a.variance() == Approx(all.variance()).epsilon(1.0E-12));
+  REQUIRE(a.skew() == Approx(all.skew()).epsilon(1.0E-9));
+  REQUIRE(a.kurtosis() == Approx(all.kurtosis()).epsilon(1.0E-9));
+  REQUIRE(a.variance() == Approx(variance(v, p)).epsilon(1.0E-12));
+  double sq= 0.0;
+  for(size_t i= 0; i < n; ++i) sq+= v[i] * v[i];
+  REQUIRE(a.rms() == Approx(sqrt(sq / n)));
+  REQUIRE(a.sd_mean() == Approx(a.sd() / sqrt(double(n))));
+  REQUIRE(a.median() == Approx(median(v)).margin(0.02));
+  a.reset();
+  REQUIRE(a.n() == 0);
+  a.add(2.0).add(4.0);
+  REQUIRE(a.mean() == 3.0);
+  REQUIRE(a.median() == 3.0);
+}
+
+
+TEST_CASE("rstat of zero or one value matches GSL.", "[statistics]") {
+  rstat a;
+  REQUIRE(a.n() == 0);
+  REQUIRE(a.min() == 0.0);
+  REQUIRE(a.max() == 0.0);
+  REQUIRE(a.mean() == 0.0);
+  REQUIRE(a.variance() == 0.0);
+  REQUIRE(a.sd() == 0.0);
+  REQUIRE(a.sd_mean() == 0.0);
+  REQUIRE(a.rms() == 0.0);
+  REQUIRE(a.skew() == 0.0);
+  REQUIRE(a.kurtosis() == 0.0);
+  rstat b;
+  b.add(-2.5);
+  b+= a; // Merging empty accumulator changes nothing.
+  REQUIRE(b.n() == 1);
+  REQUIRE(b.min() == -2.5);
+  REQUIRE(b.max() == -2.5);
+  REQUIRE(b.mean() == -2.5);
+  REQUIRE(b.variance() == 0.0);
+  REQUIRE(b.sd() == 0.0);
+  REQUIRE(b.sd_mean() == 0.0);
+  REQUIRE(b.rms() == 2.5);
+  a+= b;
+  REQUIRE(a.min() == -2.5);
+  REQUIRE(a.max() == -2.5);
+}
+
+// EOF
@@ -0,0 +1,72 @@
+/// @file       test/thread-pool-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for gsl::thread_pool.
+
+#include "gslcpp/par/thread-pool.hpp"
+#include <catch.hpp>
+#include <stdexcept> // runtime_error
+
+using gsl::thread_pool;
+using std::runtime_error;
+using std::vector;
+
+
+TEST_CASE("thread_pool visits every element exactly once.", "[thread-pool]") {
+  thread_pool p(4);
+  REQUIRE(p.size() == 4);
+  vector<int> hits(1000, 0);
+  vector<unsigned> worker(hits.size(), 0);
+  // Catch's assertions are not thread-safe; record, and check afterward.
+  p.for_each(hits.size(), [&](size_t i, unsigned w) {
+    ++hits[i];
+    worker[i]= w;
+  });
+  for(int h: hits) REQUIRE(h == 1);
+  for(unsigned w: worker) REQUIRE(w < 4);
+  p.for_chunks(hits.size(), 7, [&](size_t b, size_t e, unsigned) {
+    for(size_t i= b; i < e; ++i) hits[i]+= int(e - b <= 7 && b % 7 == 0);
+  });
+  for(int h: hits) REQUIRE(h == 2);
+}
+
+
+TEST_CASE("thread_pool runs nested call serially.", "[thread-pool]") {
+  thread_pool p(3);
+  vector<int> sums(10, 0);
+  vector<int> same(10, 1);
+  p.for_each(sums.size(), [&](size_t i, unsigned w) {
+    p.for_each(5, [&](size_t j, unsigned wj) {
+      same[i]&= int(wj == w);
+      sums[i]+= int(j);
+    });
+  });
+  for(int s: sums) REQUIRE(s == 10);
+  for(int s: same) REQUIRE(s == 1);
+}
+
+
+TEST_CASE("thread_pool with one worker runs on caller.", "[thread-pool]") {
+  thread_pool p(1);
+  REQUIRE(p.size() == 1);
+  size_t sum= 0;
+  p.for_chunks(100, [&](size_t b, size_t e, unsigned w) {
+    REQUIRE(w == 0);
+    for(size_t i= b; i < e; ++i) sum+= i;
+  });
+  REQUIRE(sum == 4950);
+}
+
+
+TEST_CASE("thread_pool propagates exception.", "[thread-pool]") {
+  thread_pool p(4);
+  auto const f= [](size_t i, unsigned) {
+    if(i == 17) throw runtime_error("seventeen");
+  };
+  REQUIRE_THROWS_AS(p.for_each(100, f), runtime_error);
+  // Pool remains usable.
+  int n= 0;
+  p.for_each(1, [&](size_t, unsigned) { ++n; });
+  REQUIRE(n == 1);
+}
+
+// EOF
@@ -0,0 +1,146 @@
+/// @file       test/vmath-test.cpp
+/// @copyright  2022 Thomas E. Vaughan, all rights reserved.
+/// @brief      Tests for elementwise math on vectors.
+
+#include "gslcpp/vmath.hpp"
+#include <catch.hpp>
+#include <cmath> // nextafter, isnan
+#include <limits> // numeric_limits
+#include <random> // mt19937_64, uniform_real_distribution
+
+using gsl::complex;
+using gsl::elementwise;
+using gsl::math_grain;
+using gsl::thread_pool;
+using gsl::vector;
+using std::numeric_limits;
+
+
+/// Error in ULPs of result relative to reference in extended precision.
+/// @param r  Result.
+/// @param x  Reference.
+/// @return  Error in ULPs.
+double ulps(double r, long double x) {
+  double const d= double(x);
+  double const u= std::nextafter(std::abs(d), HUGE_VAL) - std::abs(d);
+  return double(std::abs((long double)r - x) / u);
+}
+
+
+/// Largest error in ULPs of function of vector over random arguments.
+/// @param f  Function of vector into vector.
+/// @param g  Reference function in extended precision.
+/// @param lo  Least argument.
+/// @param hi  Greatest argument.
+/// @return  Largest error.
+template<typename F, typename G>
+double max_ulps(F const &f, G const &g, double lo, double hi) {
+  std::mt19937_64 gen(17);
+  std::uniform_real_distribution<double> dist(lo, hi);
+  size_t const n= 100003; // not multiple of math_lanes
+  vector<double> x(n), y(n);
+  for(size_t i= 0; i < n; ++i) x[i]= dist(gen);
+  f(x, y);
+  double m= 0.0;
+  for(size_t i= 0; i < n; ++i) {
+    m= std::max(m, ulps(y[i], g((long double)x[i])));
+  }
+  return m;
+}
+
+
+TEST_CASE("Elementwise exp and log are within one ULP.", "[vmath]") {
+  auto const e= [](auto &x, auto &y) { gsl::exp(x, y); };
+  auto const l= [](auto &x, auto &y) { gsl::log(x, y); };
+  auto const re= [](long double x) { return std::exp(x); };
+  auto const rl= [](long double x) { return std::log(x); };
+  REQUIRE(max_ulps(e, re, -700.0, 700.0) < 1.0);
+  REQUIRE(max_ulps(e, re, -1.0, 1.0) < 1.0);
+  REQUIRE(max_ulps(l, rl, 1e-300, 1e300) < 1.0);
+  REQUIRE(max_ulps(l, rl, 0.5, 2.0) < 1.0);
+  double const inf= numeric_limits<double>::infinity();
+  double const nan= numeric_limits<double>::quiet_NaN();
+  vector<double> x({0.0, -1.0, inf, -inf, nan, 800.0, -800.0, 4.9e-324});
+  vector<double> const a= gsl::exp(x);
+  REQUIRE(a[0] == 1.0);
+  REQUIRE(a[2] == inf);
+  REQUIRE(a[3] == 0.0);
+  REQUIRE(std::isnan(a[4]));
+  REQUIRE(a[5] == inf);
+  REQUIRE(a[6] == 0.0);
+  vector<double> const b= gsl::log(x);
+  REQUIRE(b[0] == -inf);
+  REQUIRE(std::isnan(b[1]));
+  REQUIRE(b[2] == inf);
+  REQUIRE(std::isnan(b[3]));
+  REQUIRE(std::isnan(b[4]));
+  REQUIRE(b[7] == std::log(4.9e-324));
+}
+
+
+TEST_CASE("Elementwise sin and cos are within one ULP.", "[vmath]") {
+  auto const s= [](auto &x, auto &y) { gsl::sin(x, y); };
+  auto const c= [](auto &x, auto &y) { gsl::cos(x, y); };
+  auto const rs= [](long double x) { return std::sin(x); };
+  auto const rc= [](long double x) { return std::cos(x); };
+  REQUIRE(max_ulps(s, rs, -10.0, 10.0) < 1.0);
+  REQUIRE(max_ulps(c, rc, -10.0, 10.0) < 1.0);
+  REQUIRE(max_ulps(s, rs, -1e6, 1e6) < 1.0);
+  REQUIRE(max_ulps(c, rc, -1e6, 1e6) < 1.0);
+  // Near multiples of pi/2, and special values.
+  double const inf= numeric_limits<double>::infinity();
+  vector<double> x({M_PI, 2.0 * M_PI, 0.5 * M_PI, 1e-310, -0.0, inf, 1e300});
+  vector<double> const a= gsl::sin(x);
+  vector<double> const b= gsl::cos(x);
+  for(size_t i= 0; i < 5; ++i) {
+    REQUIRE(ulps(a[i], std::sin((long double)x[i])) < 1.0);
+    REQUIRE(ulps(b[i], std::cos((long double)x[i])) < 1.0);
+  }
+  REQUIRE(std::isnan(a[5]));
+  REQUIRE(a[6] == std::sin(1e300));
+}
+
+
+TEST_CASE("Elementwise math handles float, complex, and views.", "[vmath]") {
+  vector<float> f({0.0f, 1.0f, 2.0f, 4.0f});
+  gsl::sqrt(f, f);
+  REQUIRE(f[1] == 1.0f);
+  REQUIRE(f[2] == std::sqrt(2.0f));
+  REQUIRE(f[3] == 2.0f);
+  vector<float> const e= gsl::exp(f);
+  REQUIRE(e[3] == std::exp(2.0f));
+  vector<complex<double>> z(2);
+  z[0]= complex<double>(0.0, M_PI);
+  z[1]= complex<double>(1.0, 1.0);
+  vector<complex<double>> const w= gsl::exp(z);
+  REQUIRE(w[0].real() == Approx(-1.0));
+  REQUIRE(w[1] == std::exp(std::complex<double>(1.0, 1.0)));
+  vector<complex<double>> const q= gsl::sqrt(z);
+  REQUIRE(q[1] == std::sqrt(std::complex<double>(1.0, 1.0)));
+  vector<double> v({1.0, 2.0, 3.0, 4.0, 5.0, 6.0});
+  auto u= v.subvector(3, 0, 2); // elements 0, 2, 4
+  gsl::pow(u, 2, u);
+  REQUIRE(v[2] == 9.0);
+  REQUIRE(v[3] == 4.0);
+  REQUIRE(v[4] == 25.0);
+  vector<double> r(5);
+  REQUIRE_THROWS(gsl::log(v, r));
+}
+
+
+TEST_CASE("Elementwise math in parallel matches serial.", "[vmath]") {
+  thread_pool p(4), q(1);
+  size_t const n= 5 * math_grain + 3;
+  vector<double> x(n), a(n), b(n);
+  for(size_t i= 0; i < n; ++i) x[i]= 0.001 * double(i) - 7.0;
+  gsl::sin(x, a, p);
+  gsl::sin(x, b, q);
+  bool same= true;
+  for(size_t i= 0; i < n; ++i) same= same && a[i] == b[i];
+  REQUIRE(same);
+  auto const f= [](double t) { return t * t + 1.0; };
+  elementwise(x, a, f, p);
+  REQUIRE(a[n - 1] == f(x[n - 1]));
+}
+
+// EOF